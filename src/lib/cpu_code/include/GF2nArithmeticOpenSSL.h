@@ -23,8 +23,10 @@
 #define __GF2N__ARITHMETIC_OPENSSL_H__
 
 #include <openssl/bn.h>
+#include <memory>
 
 #include "GF2nArithmetic.h"
+#include "GF2nNativeKernels.h"
 
 namespace libcumffa {
 	namespace cpu {
@@ -38,6 +40,51 @@ namespace libcumffa {
 				{}
 		};
 
+		///////////////////////////////////////////////////////////////////////
+		/*
+			the modulus of a field in every form the backend needs. It is
+			created once by setFieldSize or setDummyParameters and shared by
+			the backend and all of its elements without ever changing.
+		*/
+		class GF2nOpenSSLFieldContext
+		{
+		public:
+			/* irred_poly are the exponents of the modulus terminated by -1 */
+			GF2nOpenSSLFieldContext( const uint32 field_size, const std::vector<int> &irred_poly );
+			~GF2nOpenSSLFieldContext();
+
+		public:
+			uint32 getFieldSize() const;
+			uint32 getNumLimbs() const;
+			const int *getIrredPoly() const;
+			const BIGNUM *getPoly() const;
+			const std::vector<uint32> &getInverseChain() const;
+			const native::GF2nNativeField *getNativeField() const;
+
+		private:
+			GF2nOpenSSLFieldContext( const GF2nOpenSSLFieldContext& );
+			void operator=( const GF2nOpenSSLFieldContext& );
+
+		private:
+			uint32 m_field_size;
+			uint32 m_num_limbs;
+			std::vector<int> m_irred_poly;
+			/*
+				the modulus as polynomial, saves BN_GF2m_arr2poly per
+				inversion. NULL if irred_poly does not start with the degree
+			*/
+			BIGNUM *m_poly;
+			/*
+				Itoh-Tsujii addition chain for field_size - 1, every entry
+				is either twice or one more than the entry before
+			*/
+			std::vector<uint32> m_inverse_chain;
+			/* hard coded kernels if the modulus is a NIST modulus, else NULL */
+			const native::GF2nNativeField *m_native_field;
+		};
+
+		typedef std::shared_ptr<const GF2nOpenSSLFieldContext> GF2nOpenSSLFieldContextPtr;
+
 		class GF2nArithmeticOpenSSL : public GF2nArithmeticInterface
 		{
 		public:
@@ -47,15 +94,107 @@ namespace libcumffa {
 			void setDummyParameters( const uint32 field_size, const std::string irred_poly );
 			void setDummyParameters( const uint32 field_size, const unsigned char *irred_poly, const uint32 chunks_irred_poly );
 			void setDummyParameters( const uint32 field_size, const void *irred_poly, const uint32 chunks_irred_poly );
-			void setFlags( const unsigned char flags ) {}
+			void setFlags( const unsigned char flags );
+			bool isAsync();
+			int32 resolveOp( const std::string &what );
+			uint32 getFieldSize();
+			void getModulus( std::vector<ufixn> &limbs );
+			uint32 getNumLimbs();
+			size_t getBatchTileSize();
+			void setNumWorkers( const uint32 num_workers );
+			void runBatch( const int32 op, const ufixn *a, const ufixn *b, const uint32 value, ufixn *out, const size_t count, const uint32 stride, const uint32 worker );
 			GF2nArithmeticElement getElement( const std::string value );
 			GF2nArithmeticElement getElement( const unsigned char *value, const uint32 chunks_value );
 			GF2nArithmeticElement getElement( const void *value, const uint32 chunks_value );
+			GF2nArithmeticElement getElementFromLimbs( const ufixn *limbs );
+
+			/**
+			 * @brief      Creates an element that owns value without a copy
+			 *
+			 * @throw      InvalidEncodingException if value is too large
+			 *             for the field, value is freed then
+			 */
+			GF2nArithmeticElement adoptValue( BIGNUM *value );
 		private:
-			uint32 m_field_size;
-			std::vector<int> m_irred_poly;
+			bool runNativeBatch( const int32 op, const ufixn *a, const ufixn *b, const uint32 value, ufixn *out, const size_t count, const uint32 stride );
+		private:
+			GF2nOpenSSLFieldContextPtr m_field;
+			bool m_async;
 		};
 
+		namespace openssl {
+			/**
+			 * @brief      Returns the opcode of the operation with the given name
+			 *
+			 * @throw      MethodNotFoundException if the backend has no such operation
+			 */
+			int32 resolveOp( const std::string &what );
+
+			/*
+				borrows the BN_CTX of the calling thread, or a fresh one
+				while the thread exits
+			*/
+			class ThreadCtx
+			{
+			public:
+				ThreadCtx();
+				~ThreadCtx();
+
+			public:
+				BN_CTX *get() const;
+
+			private:
+				ThreadCtx( const ThreadCtx& );
+				void operator=( const ThreadCtx& );
+
+			private:
+				BN_CTX *m_ctx;
+				bool m_owned;
+			};
+
+			/**
+			 * @brief      Returns a zero BIGNUM, reused from the pool of the
+			 *             calling thread or, if that is empty, from the
+			 *             pool shared by all threads if possible
+			 */
+			BIGNUM *newBN();
+
+			/**
+			 * @brief      Returns value to the pool of the calling thread,
+			 *             value may come from any thread. A full pool
+			 *             hands half of its BIGNUMs to the shared pool.
+			 */
+			void freeBN( BIGNUM *value );
+
+			/**
+			 * @brief      Loads num_limbs least significant first limbs into ret
+			 */
+			void limbs2bn( const ufixn *limbs, const uint32 num_limbs, BIGNUM *ret );
+
+			/**
+			 * @brief      Stores value as num_limbs least significant first limbs
+			 *
+			 * @throw      InvalidEncodingException if value needs more limbs
+			 */
+			void bn2limbs( const BIGNUM *value, ufixn *limbs, const uint32 num_limbs );
+
+			/**
+			 * @brief      Inverts x with the Itoh-Tsujii chain of field, for
+			 *             fields that BN_GF2m_mod_inv does not support
+			 *
+			 * @return     1 on success, 0 on error or if x has no inverse
+			 */
+			int inverseChain( BIGNUM *res, const BIGNUM *x, const GF2nOpenSSLFieldContext &field, BN_CTX *ctx );
+
+			/**
+			 * @brief      Inverts x in field, with the Itoh-Tsujii chain for
+			 *             fields above OPENSSL_ECC_MAX_FIELD_BITS
+			 *
+			 * @return     1 on success, 0 on error or if x has no inverse
+			 */
+			int modInverse( BIGNUM *res, const BIGNUM *x, const GF2nOpenSSLFieldContext &field, BN_CTX *ctx );
+		}
+
 		class MethodNotFoundException : public std::exception
 		{
 		public:
@@ -71,7 +210,7 @@ namespace libcumffa {
 		class GF2nArithmeticElementOpenSSL : public GF2nArithmeticElementInterface
 		{
 		public:
-			GF2nArithmeticElementOpenSSL( BIGNUM *value, const uint32 field_size, std::vector<int> irred_poly, GF2nOpenSSLMetrics metrics );
+			GF2nArithmeticElementOpenSSL( BIGNUM *value, GF2nOpenSSLFieldContextPtr const& field, GF2nOpenSSLMetrics metrics );
 			~GF2nArithmeticElementOpenSSL();
 
 		public:
@@ -83,19 +222,24 @@ namespace libcumffa {
 			GF2nArithmeticElementInterface *inverse( uint32 value );
 			GF2nArithmeticElementInterface *runWithElement( const std::string &what, GF2nArithmeticElementInterface *other );
 			GF2nArithmeticElementInterface *runWithValue( const std::string &what, uint32 value );
+			GF2nArithmeticElementInterface *runWithElement( const int32 op, GF2nArithmeticElementInterface *other );
+			GF2nArithmeticElementInterface *runWithValue( const int32 op, uint32 value );
 			std::string toString();
 			void getValue( std::vector<uint8_t> &value );
+			void getValue( uint8_t *value, const size_t num_bytes );
+			void getLimbs( ufixn *limbs, const uint32 num_limbs );
+			uint32 getFieldSize();
 			std::string getMetrics();
 			std::string getMetrics( const std::string &metrics_name );
 			void setProperty( const std::string &property_name, const std::string &property_value );
 
 		public:
-			BIGNUM *getValue();
+			/* the value is borrowed, it lives as long as the element */
+			const BIGNUM *getValue() const;
 
 		private:
 			BIGNUM *m_value;
-			uint32 m_field_size;
-			std::vector<int> m_irred_poly;
+			GF2nOpenSSLFieldContextPtr m_field;
 			GF2nOpenSSLMetrics m_metrics;
 		};
 
@@ -20,14 +20,16 @@
  */
 
 #include <openssl/crypto.h>
+#include <openssl/ec.h>
 #include <cstring>
 #include <cstdlib>
 #include <sys/time.h>
 #include <cassert>
+#include <algorithm>
+#include <mutex>
 
 #include "../include/GF2nArithmeticOpenSSL.h"
-
-void set_irrep(std::vector<int>&, unsigned int);
+#include "GF2nIrreducible.h"
 
 //openssl
 namespace libcumffa {
@@ -43,7 +45,167 @@ namespace libcumffa {
 			    return ((double)tp.tv_sec * 1000 + (double)tp.tv_usec * 1.e-3);
 			}
 
-			double add( BIGNUM *x, BIGNUM *y, BIGNUM *res )
+			/* BIGNUMs that are kept for reuse per thread */
+			const size_t BN_POOL_SIZE = 64;
+
+			/* BIGNUMs that are kept for reuse by all threads */
+			const size_t BN_SHARED_POOL_SIZE = 1024;
+
+			/*
+				BIGNUMs that one thread frees and another one allocates.
+				A thread pool that runs full moves half of its BIGNUMs
+				here, one that runs empty takes up to half a pool back.
+				It is never destroyed, threads may exit after the
+				static objects are gone.
+			*/
+			struct SharedPool
+			{
+				std::mutex mutex;
+				std::vector<BIGNUM *> free_bns;
+			};
+
+			SharedPool &sharedPool()
+			{
+				static SharedPool *pool = new SharedPool();
+				return *pool;
+			}
+
+			/* moves the BIGNUMs of free_bns from first on to the shared pool, frees the rest */
+			void spillBNs( std::vector<BIGNUM *> &free_bns, const size_t first )
+			{
+				SharedPool &shared = sharedPool();
+				size_t pos = first;
+
+				{
+					std::lock_guard<std::mutex> lock(shared.mutex);
+					for( ; pos < free_bns.size() && shared.free_bns.size() < BN_SHARED_POOL_SIZE; ++pos )
+						shared.free_bns.push_back(free_bns[pos]);
+				}
+
+				for( ; pos < free_bns.size(); ++pos )
+					BN_free(free_bns[pos]);
+
+				free_bns.resize(first);
+			}
+
+			/* the reusable BIGNUM state of a thread */
+			struct ThreadState
+			{
+				BN_CTX *ctx;
+				std::vector<BIGNUM *> free_bns;
+
+				ThreadState();
+				~ThreadState();
+			};
+
+			// set once the state of the thread is destroyed, elements that
+			// outlive it free their BIGNUMs directly
+			thread_local bool tl_state_destroyed = false;
+			thread_local ThreadState tl_state;
+
+			ThreadState::ThreadState()
+				: ctx(NULL)
+			{
+			}
+
+			ThreadState::~ThreadState()
+			{
+				tl_state_destroyed = true;
+
+				// the BIGNUMs of an exiting thread are reused by the others
+				spillBNs(free_bns, 0);
+
+				if( ctx )
+					BN_CTX_free(ctx);
+			}
+
+			// the state of the calling thread, created with the first
+			// call. NULL while the thread exits
+			ThreadState *threadState()
+			{
+				return tl_state_destroyed ? NULL : &tl_state;
+			}
+
+			ThreadCtx::ThreadCtx()
+				: m_ctx(NULL)
+				, m_owned(false)
+			{
+				ThreadState *state = threadState();
+
+				if( state )
+				{
+					if( state->ctx == NULL )
+						state->ctx = BN_CTX_new();
+
+					m_ctx = state->ctx;
+				}
+				else
+				{
+					m_ctx = BN_CTX_new();
+					m_owned = true;
+				}
+			}
+
+			ThreadCtx::~ThreadCtx()
+			{
+				if( m_owned )
+					BN_CTX_free(m_ctx);
+			}
+
+			BN_CTX *ThreadCtx::get() const
+			{
+				return m_ctx;
+			}
+
+			BIGNUM *newBN()
+			{
+				ThreadState *state = threadState();
+
+				if( state && state->free_bns.empty() )
+				{
+					SharedPool &shared = sharedPool();
+					std::lock_guard<std::mutex> lock(shared.mutex);
+
+					size_t num_bns = std::min(shared.free_bns.size(), BN_POOL_SIZE / 2);
+					state->free_bns.reserve(BN_POOL_SIZE);
+					state->free_bns.insert(state->free_bns.end(), shared.free_bns.end() - num_bns, shared.free_bns.end());
+					shared.free_bns.resize(shared.free_bns.size() - num_bns);
+				}
+
+				if( state && !state->free_bns.empty() )
+				{
+					BIGNUM *value = state->free_bns.back();
+					state->free_bns.pop_back();
+					BN_zero(value);
+					return value;
+				}
+
+				return BN_new();
+			}
+
+			void freeBN( BIGNUM *value )
+			{
+				ThreadState *state = threadState();
+
+				if( state == NULL )
+				{
+					std::vector<BIGNUM *> single(1, value);
+					spillBNs(single, 0);
+					return;
+				}
+
+				// a thread that frees the BIGNUMs of other threads hands
+				// them back through the shared pool
+				if( state->free_bns.size() == BN_POOL_SIZE )
+					spillBNs(state->free_bns, BN_POOL_SIZE / 2);
+
+				if( state->free_bns.capacity() == 0 )
+					state->free_bns.reserve(BN_POOL_SIZE);
+
+				state->free_bns.push_back(value);
+			}
+
+			double add( const BIGNUM *x, const BIGNUM *y, BIGNUM *res )
 			{
 				double iStart, iElaps;
 				iStart = cpuSecond();
@@ -55,57 +217,220 @@ namespace libcumffa {
 				return iElaps;
 			}
 
-			double mul( BIGNUM *x, BIGNUM *y, int *irred_poly, BIGNUM *res )
+			/* limbs of the largest field with native kernels, GF(2^571) */
+			const uint32 NATIVE_MAX_LIMBS = (571 + sizeof(ufixn) * 8 - 1) / (sizeof(ufixn) * 8);
+
+			/*
+				res = x^k with the native kernels of field. Returns false if
+				the field has none or x is not reduced.
+
+				Only the exponentiation of an element takes this way: the
+				BIGNUM to limb conversions cost more than the native kernel
+				saves for a single multiplication, and the Itoh-Tsujii
+				inverse is slower than BN_GF2m_mod_inv from 283 bits up.
+			*/
+			bool nativeExp( const BIGNUM *x, const uint32 k, const GF2nOpenSSLFieldContext &field, BIGNUM *res )
 			{
-				BN_CTX *ctx = BN_CTX_new();
+				const native::GF2nNativeField *native_field = field.getNativeField();
+
+				if( native_field == NULL || BN_num_bits(x) > static_cast<int>(field.getFieldSize()) )
+					return false;
+
+				uint32 num_limbs = field.getNumLimbs();
+				assert(num_limbs <= NATIVE_MAX_LIMBS);
+
+				ufixn a[NATIVE_MAX_LIMBS], out[NATIVE_MAX_LIMBS];
+
+				bn2limbs(x, a, num_limbs);
+				native_field->exp(a, k, out);
+				limbs2bn(out, num_limbs, res);
+
+				return true;
+			}
+
+			double mul( const BIGNUM *x, const BIGNUM *y, const int *irred_poly, BIGNUM *res )
+			{
+				ThreadCtx ctx;
 
 				double iStart, iElaps;
 				iStart = cpuSecond();
 
-				BN_GF2m_mod_mul_arr(res, x, y, reinterpret_cast<const int*>(irred_poly), ctx);
+				BN_GF2m_mod_mul_arr(res, x, y, irred_poly, ctx.get());
 
 				iElaps = cpuSecond() - iStart;
 
-				BN_CTX_free(ctx);
-
 				return iElaps;
 			}
 
-			double inverse( BIGNUM *x, int *irred_poly, BIGNUM *res )
+			double inverse( const BIGNUM *x, const GF2nOpenSSLFieldContext &field, BIGNUM *res )
 			{
-				BN_CTX *ctx = BN_CTX_new();
+				ThreadCtx ctx;
 
 				double iStart, iElaps;
 				iStart = cpuSecond();
 
-				BN_GF2m_mod_inv_arr(res, x, reinterpret_cast<const int*>(irred_poly), ctx);
+				// x without inverse yields 0
+				if( !modInverse(res, x, field, ctx.get()) )
+					BN_zero(res);
 				
 				iElaps = cpuSecond() - iStart;
 
-				BN_CTX_free(ctx);
-
 				return iElaps;
 			}
 
 			// res = x^k % irred_poly
-			double exp( BIGNUM *x, BIGNUM *k, int *irred_poly, BIGNUM *res )
+			double exp( const BIGNUM *x, const uint32 k, const GF2nOpenSSLFieldContext &field, BIGNUM *res )
 			{
-				BN_CTX *ctx = BN_CTX_new();
-
 				double iStart, iElaps;
 				iStart = cpuSecond();
 
-				BN_GF2m_mod_exp_arr(res, x, k, reinterpret_cast<const int*>(irred_poly), ctx);
+				if( !nativeExp(x, k, field, res) )
+				{
+					ThreadCtx ctx;
+					BN_CTX_start(ctx.get());
+
+					BIGNUM *bn_k = BN_CTX_get(ctx.get());
+					BN_set_word(bn_k, k);
+					BN_GF2m_mod_exp_arr(res, x, bn_k, field.getIrredPoly(), ctx.get());
 
-				iElaps = cpuSecond() - iStart;
+					BN_CTX_end(ctx.get());
+				}
 
-				BN_CTX_free(ctx);
+				iElaps = cpuSecond() - iStart;
 
 				return iElaps;
 			}
+
+			struct OpName
+			{
+				const char *name;
+				int32 opcode;
+			};
+
+			// names of all operations that can be passed to runWithElement
+			// and runWithValue
+			const OpName op_names[] = {
+				{ "add", 		GF2N_OP_ADD },
+				{ "sub", 		GF2N_OP_SUB },
+				{ "mul", 		GF2N_OP_MUL },
+				{ "exp", 		GF2N_OP_EXP },
+				{ "inverse", 	GF2N_OP_INVERSE }
+			};
+
+			int32 resolveOp( const std::string &what )
+			{
+				for( uint32 i=0; i<sizeof(op_names) / sizeof(op_names[0]); ++i )
+				{
+					if( what.compare(op_names[i].name) == 0 )
+						return op_names[i].opcode;
+				}
+
+				throw MethodNotFoundException(what);
+			}
+
+			void limbs2bn( const ufixn *limbs, const uint32 num_limbs, BIGNUM *ret )
+			{
+				int num_bytes = static_cast<int>(num_limbs * sizeof(ufixn));
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+				// the limbs of a little endian host already are
+				// a little endian byte string
+				BN_lebin2bn(reinterpret_cast<const unsigned char *>(limbs), num_bytes, ret);
+#else
+				const unsigned char *bytes = reinterpret_cast<const unsigned char *>(limbs);
+				std::vector<unsigned char> scratch(bytes, bytes + num_bytes);
+				std::reverse(scratch.begin(), scratch.end());
+				BN_bin2bn(&scratch[0], num_bytes, ret);
+#endif
+			}
+
+			void bn2limbs( const BIGNUM *value, ufixn *limbs, const uint32 num_limbs )
+			{
+				int num_bytes = static_cast<int>(num_limbs * sizeof(ufixn));
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+				if( BN_bn2lebinpad(value, reinterpret_cast<unsigned char *>(limbs), num_bytes) < 0 )
+					throw InvalidEncodingException("the value does not fit into the limbs");
+#else
+				int bn_num_bytes = BN_num_bytes(value);
+				if( bn_num_bytes > num_bytes )
+					throw InvalidEncodingException("the value does not fit into the limbs");
+
+				unsigned char *bytes = reinterpret_cast<unsigned char *>(limbs);
+				BN_bn2bin(value, bytes);
+				std::reverse(bytes, bytes + bn_num_bytes);
+				std::fill(bytes + bn_num_bytes, bytes + num_bytes, 0);
+#endif
+			}
+
+			int inverseChain( BIGNUM *res, const BIGNUM *x, const GF2nOpenSSLFieldContext &field, BN_CTX *ctx )
+			{
+				const std::vector<uint32> &chain = field.getInverseChain();
+				const int *irred_poly = field.getIrredPoly();
+
+				BN_CTX_start(ctx);
+				BIGNUM *b = BN_CTX_get(ctx);
+				BIGNUM *t = BN_CTX_get(ctx);
+
+				// b = x^(2^k - 1) for every k of the chain
+				int ok = t != NULL && BN_copy(b, x) != NULL;
+
+				for( size_t i=1; ok && i<chain.size(); ++i )
+				{
+					if( chain[i] == chain[i - 1] + 1 )
+					{
+						ok = BN_GF2m_mod_sqr_arr(t, b, irred_poly, ctx)
+							&& BN_GF2m_mod_mul_arr(b, t, x, irred_poly, ctx);
+					}
+					else
+					{
+						ok = BN_copy(t, b) != NULL;
+						for( uint32 j=0; ok && j<chain[i - 1]; ++j )
+							ok = BN_GF2m_mod_sqr_arr(t, t, irred_poly, ctx);
+						ok = ok && BN_GF2m_mod_mul_arr(b, t, b, irred_poly, ctx);
+					}
+				}
+
+				// x^-1 = x^(2^n - 2) = (x^(2^(n-1) - 1))^2
+				ok = ok && BN_GF2m_mod_sqr_arr(res, b, irred_poly, ctx);
+
+				// the chain does not notice a missing inverse, x = 0 or a
+				// reducible modulus, so check x * res = 1
+				ok = ok && BN_GF2m_mod_mul_arr(t, x, res, irred_poly, ctx) && BN_is_one(t);
+
+				BN_CTX_end(ctx);
+
+				return ok;
+			}
+
+			int modInverse( BIGNUM *res, const BIGNUM *x, const GF2nOpenSSLFieldContext &field, BN_CTX *ctx )
+			{
+				// BN_GF2m_mod_inv rejects fields above the OpenSSL limit,
+				// any other failure means x has no inverse
+				if( field.getFieldSize() > OPENSSL_ECC_MAX_FIELD_BITS )
+					return inverseChain(res, x, field, ctx);
+
+				const BIGNUM *poly = field.getPoly();
+
+				return poly != NULL
+					? BN_GF2m_mod_inv(res, x, poly, ctx)
+					: BN_GF2m_mod_inv_arr(res, x, field.getIrredPoly(), ctx);
+			}
+
+			std::string opName( const int32 op )
+			{
+				for( uint32 i=0; i<sizeof(op_names) / sizeof(op_names[0]); ++i )
+				{
+					if( op_names[i].opcode == op )
+						return op_names[i].name;
+				}
+
+				return std::to_string(op);
+			}
 		}
 
 		GF2nArithmeticOpenSSL::GF2nArithmeticOpenSSL()
+			: m_async(false)
 		{
 		}
 
@@ -113,10 +438,26 @@ namespace libcumffa {
 		{
 		}
 
+		void GF2nArithmeticOpenSSL::setFlags( const unsigned char flags )
+		{
+			m_async = (flags & GF2N_FLAG_ASYNC) > 0;
+		}
+
+		bool GF2nArithmeticOpenSSL::isAsync()
+		{
+			return m_async;
+		}
+
+		int32 GF2nArithmeticOpenSSL::resolveOp( const std::string &what )
+		{
+			return openssl::resolveOp(what);
+		}
+
 		void GF2nArithmeticOpenSSL::setFieldSize( const uint32 field_size )
 		{
-			m_field_size = field_size;
-			set_irrep(m_irred_poly, static_cast<unsigned int>(m_field_size));
+			std::vector<int> irred_poly;
+			irred_poly.reserve(GF2N_IRRED_MAX_TERMS + 1);
+			utils::getIrreducibleExponents(field_size, irred_poly);
 
 			// The irred poly has to be terminated with -1 
 			// because inside of the function BN_GF2m_mod_inv_arr, 
@@ -124,21 +465,18 @@ namespace libcumffa {
 			// using the function BN_GF2m_arr2poly. This function
 			// iterates over all chunks of the irred poly
 			// until it hits a -1.
-			m_irred_poly.push_back(-1);
+			irred_poly.push_back(-1);
+
+			m_field = std::make_shared<GF2nOpenSSLFieldContext>(field_size, irred_poly);
 		}
 
 		void GF2nArithmeticOpenSSL::setDummyParameters( const uint32 field_size, const std::string irred_poly )
 		{
-			m_field_size = field_size;		
-
 			uint32 num_chunks = utils::calcNumberChunks(field_size + 1, static_cast<uint32>(sizeof(int) * 8));
 			std::vector<std::string> str_arr_irred_poly;
 			utils::convertStringToArray(irred_poly, sizeof(int) * 8, static_cast<int>(num_chunks), str_arr_irred_poly);
 
-			if( !m_irred_poly.empty() )
-			{
-				m_irred_poly.clear();	
-			}
+			std::vector<int> irred_poly_arr;
 
 			for( uint32 i=0; i<num_chunks; ++i )
 			{
@@ -167,7 +505,7 @@ namespace libcumffa {
 						}
 							// calc the absolute bit position in the irred_poly string
 						unsigned int abs_pos = ((sizeof(int) * 8) * (num_chunks - 1 - i)) + ((sizeof(int) * 8) - pos);
-						m_irred_poly.push_back(abs_pos);
+						irred_poly_arr.push_back(abs_pos);
 
 						// remove bit from x
 						current_chunk=current_chunk^bit;
@@ -175,87 +513,324 @@ namespace libcumffa {
 				}
 			}	
 
-			m_irred_poly.push_back(-1);
+			irred_poly_arr.push_back(-1);
+
+			m_field = std::make_shared<GF2nOpenSSLFieldContext>(field_size, irred_poly_arr);
 		}
 
 		void GF2nArithmeticOpenSSL::setDummyParameters( const uint32 field_size, const unsigned char *irred_poly, const uint32 chunks_irred_poly )
 		{
-			m_field_size = field_size;
+			uint32 num_chunks = utils::calcNumberChunks(field_size + 1, static_cast<uint32>(sizeof(int) * 8));
 
-			uint32 num_chunks = utils::calcNumberChunks(m_field_size + 1, static_cast<uint32>(sizeof(int) * 8));
+			std::vector<int> irred_poly_arr(num_chunks);
 
-			if( !m_irred_poly.empty() )
+			assert(chunks_irred_poly <= num_chunks * sizeof(int));
+
+			std::copy_backward(irred_poly, irred_poly + chunks_irred_poly, ((unsigned char *)&irred_poly_arr[0]) + num_chunks * sizeof(int) / sizeof(unsigned char));
+
+			irred_poly_arr.push_back(-1);
+
+			m_field = std::make_shared<GF2nOpenSSLFieldContext>(field_size, irred_poly_arr);
+		}
+
+		void GF2nArithmeticOpenSSL::setDummyParameters( const uint32 field_size, const void *irred_poly, const uint32 chunks_irred_poly )
+		{
+			uint32 num_chunks = utils::calcNumberChunks(field_size + 1, static_cast<uint32>(sizeof(int) * 8));
+			assert(chunks_irred_poly <= num_chunks * sizeof(int));
+
+			int *irred_poly_p = (int *)irred_poly;
+
+			std::vector<int> irred_poly_arr(irred_poly_p, irred_poly_p + chunks_irred_poly);
+			irred_poly_arr.push_back(-1);
+
+			m_field = std::make_shared<GF2nOpenSSLFieldContext>(field_size, irred_poly_arr);
+		}		
+
+		uint32 GF2nArithmeticOpenSSL::getFieldSize()
+		{
+			return m_field->getFieldSize();
+		}
+
+		void GF2nArithmeticOpenSSL::getModulus( std::vector<ufixn> &limbs )
+		{
+			uint32 num_limbs = utils::calcNumberChunks<uint32>(m_field->getFieldSize() + 1, sizeof(ufixn) * 8);
+			limbs.assign(num_limbs, 0);
+
+			if( m_field->getPoly() )
 			{
-				m_irred_poly.clear();		
+				openssl::bn2limbs(m_field->getPoly(), &limbs[0], num_limbs);
+				return;
 			}
 
-			m_irred_poly.resize(num_chunks);
+			// the raw chunks of a dummy modulus are 32 bit values, the
+			// most significant chunk first and followed by the -1
+			const int *chunks = m_field->getIrredPoly();
+			uint32 num_chunks = 0;
+			while( chunks[num_chunks] != -1 )
+				++num_chunks;
 
-			assert(chunks_irred_poly <= num_chunks * sizeof(int));
+			for( uint32 i=0; i<num_chunks && i*32 < num_limbs * sizeof(ufixn) * 8; ++i )
+			{
+				ufixn chunk = static_cast<uint32>(chunks[num_chunks - 1 - i]);
+				limbs[(i * 32) / (sizeof(ufixn) * 8)] |= chunk << ((i * 32) % (sizeof(ufixn) * 8));
+			}
+		}
 
-			std::copy_backward(irred_poly, irred_poly + chunks_irred_poly, ((unsigned char *)&m_irred_poly[0]) + num_chunks * sizeof(int) / sizeof(unsigned char));
+		uint32 GF2nArithmeticOpenSSL::getNumLimbs()
+		{
+			return m_field->getNumLimbs();
+		}
 
-			m_irred_poly.push_back(-1);
+		size_t GF2nArithmeticOpenSSL::getBatchTileSize()
+		{
+			// the limbs of a, b and out plus the double sized product
+			// and the BIGNUM copies of the operands
+			return calcCacheTileSize(7 * getNumLimbs() * sizeof(ufixn));
 		}
 
-		void GF2nArithmeticOpenSSL::setDummyParameters( const uint32 field_size, const void *irred_poly, const uint32 chunks_irred_poly )
+		void GF2nArithmeticOpenSSL::setNumWorkers( const uint32 num_workers )
 		{
-			m_field_size = field_size;
+			// every worker thread already has its own BN_CTX
+		}
 
-			uint32 num_chunks = utils::calcNumberChunks(m_field_size + 1, static_cast<uint32>(sizeof(int) * 8));
-			assert(chunks_irred_poly <= num_chunks * sizeof(int));
+		void GF2nArithmeticOpenSSL::runBatch( const int32 op, const ufixn *a, const ufixn *b, const uint32 value, ufixn *out, const size_t count, const uint32 stride, const uint32 worker )
+		{
+			if( runNativeBatch(op, a, b, value, out, count, stride) )
+				return;
 
-			if( !m_irred_poly.empty() )
+			uint32 num_limbs = getNumLimbs();
+			const int *irred_poly = m_field->getIrredPoly();
+
+			// all temporaries are created once for the whole batch in
+			// the BN_CTX of the thread
+			openssl::ThreadCtx thread_ctx;
+			BN_CTX *ctx = thread_ctx.get();
+			BN_CTX_start(ctx);
+
+			BIGNUM *bn_a = BN_CTX_get(ctx);
+			BIGNUM *bn_b = BN_CTX_get(ctx);
+			BIGNUM *bn_k = BN_CTX_get(ctx);
+			BIGNUM *bn_res = BN_CTX_get(ctx);
+
+			BN_set_word(bn_k, value);
+
+			for( size_t i=0; i<count; ++i )
 			{
-				m_irred_poly.clear();		
+				ufixn *out_i = out + i * stride;
+
+				openssl::limbs2bn(a + i * stride, num_limbs, bn_a);
+
+				switch( op )
+				{
+				case GF2N_OP_ADD:
+				case GF2N_OP_SUB:
+					openssl::limbs2bn(b + i * stride, num_limbs, bn_b);
+					BN_GF2m_add(bn_res, bn_a, bn_b);
+					break;
+				case GF2N_OP_MUL:
+					openssl::limbs2bn(b + i * stride, num_limbs, bn_b);
+					BN_GF2m_mod_mul_arr(bn_res, bn_a, bn_b, irred_poly, ctx);
+					break;
+				case GF2N_OP_EXP:
+					BN_GF2m_mod_exp_arr(bn_res, bn_a, bn_k, irred_poly, ctx);
+					break;
+				case GF2N_OP_INVERSE:
+					if( !openssl::modInverse(bn_res, bn_a, *m_field, ctx) )
+						BN_zero(bn_res);
+					break;
+				default:
+					BN_CTX_end(ctx);
+					throw MethodNotFoundException(openssl::opName(op));
+				}
+
+				openssl::bn2limbs(bn_res, out_i, num_limbs);
+				std::fill(out_i + num_limbs, out_i + stride, 0);
 			}
 
-			m_irred_poly.resize(chunks_irred_poly);
+			BN_CTX_end(ctx);
+		}
 
-			int *irred_poly_p = (int *)irred_poly;
+		bool GF2nArithmeticOpenSSL::runNativeBatch( const int32 op, const ufixn *a, const ufixn *b, const uint32 value, ufixn *out, const size_t count, const uint32 stride )
+		{
+			const native::GF2nNativeField *native_field = m_field->getNativeField();
 
-			std::copy(irred_poly_p, irred_poly_p + chunks_irred_poly, &m_irred_poly[0]);
+			if( native_field == NULL )
+				return false;
 
-			m_irred_poly.push_back(-1);
-		}		
+			uint32 num_limbs = getNumLimbs();
+
+			for( size_t i=0; i<count; ++i )
+			{
+				ufixn *out_i = out + i * stride;
+
+				switch( op )
+				{
+				case GF2N_OP_MUL:
+					native_field->mul(a + i * stride, b + i * stride, out_i);
+					break;
+				case GF2N_OP_EXP:
+					native_field->exp(a + i * stride, value, out_i);
+					break;
+				case GF2N_OP_INVERSE:
+					native_field->inverse(a + i * stride, out_i);
+					break;
+				default:
+					// additions are cheap enough with BIGNUMs
+					return false;
+				}
+
+				std::fill(out_i + num_limbs, out_i + stride, 0);
+			}
+
+			return true;
+		}
 
 		GF2nArithmeticElement GF2nArithmeticOpenSSL::getElement( const std::string value )
 		{
-			BIGNUM *bn_value = NULL;
-			BN_dec2bn(&bn_value, value.c_str());
+			// BN_dec2bn is quadratic in the number of digits
+			std::vector<ufixn> limbs;
+			utils::decimalToLimbs(value, limbs);
+
+			uint32 num_limbs = static_cast<uint32>(limbs.size());
+			BIGNUM *bn_value = openssl::newBN();
+			openssl::limbs2bn(&limbs[0], num_limbs, bn_value);
 
 			GF2nOpenSSLMetrics metrics;
 
 			GF2nArithmeticElement element = GF2nArithmeticElement(
-				new GF2nArithmeticElementOpenSSL(bn_value, m_field_size, m_irred_poly, metrics));
+				new GF2nArithmeticElementOpenSSL(bn_value, m_field, metrics));
 
 			return element;
 		}
 
 		GF2nArithmeticElement GF2nArithmeticOpenSSL::getElement( const unsigned char *value, const uint32 chunks_value )
 		{
-			BIGNUM *bn_value = BN_bin2bn(value, static_cast<int>(chunks_value), NULL);
+			BIGNUM *bn_value = BN_bin2bn(value, static_cast<int>(chunks_value), openssl::newBN());
 
 			GF2nOpenSSLMetrics metrics;
 
 			GF2nArithmeticElement element = GF2nArithmeticElement(
-				new GF2nArithmeticElementOpenSSL(bn_value, m_field_size, m_irred_poly, metrics));
+				new GF2nArithmeticElementOpenSSL(bn_value, m_field, metrics));
 
 			return element;
 		}
 
 		GF2nArithmeticElement GF2nArithmeticOpenSSL::getElement( const void *value, const uint32 chunks_value )
 		{
-			BIGNUM *bn_value = BN_bin2bn((unsigned char *)value, static_cast<int>(chunks_value), NULL);
+			BIGNUM *bn_value = BN_bin2bn((unsigned char *)value, static_cast<int>(chunks_value), openssl::newBN());
 
 			GF2nOpenSSLMetrics metrics;
 
 			GF2nArithmeticElement element = GF2nArithmeticElement(
-				new GF2nArithmeticElementOpenSSL(bn_value, m_field_size, m_irred_poly, metrics));
+				new GF2nArithmeticElementOpenSSL(bn_value, m_field, metrics));
 
 			return element;
 		}		
 
+		GF2nArithmeticElement GF2nArithmeticOpenSSL::adoptValue( BIGNUM *value )
+		{
+			if( BN_num_bits(value) > static_cast<int>(m_field->getFieldSize()) )
+			{
+				BN_free(value);
+				throw InvalidEncodingException("the value does not fit into the field");
+			}
+
+			GF2nOpenSSLMetrics metrics;
+
+			GF2nArithmeticElement element = GF2nArithmeticElement(
+				new GF2nArithmeticElementOpenSSL(value, m_field, metrics));
+
+			return element;
+		}
+
+		GF2nArithmeticElement GF2nArithmeticOpenSSL::getElementFromLimbs( const ufixn *limbs )
+		{
+			uint32 num_limbs = getNumLimbs();
+
+			BIGNUM *bn_value = openssl::newBN();
+			openssl::limbs2bn(limbs, num_limbs, bn_value);
+
+			GF2nOpenSSLMetrics metrics;
+
+			GF2nArithmeticElement element = GF2nArithmeticElement(
+				new GF2nArithmeticElementOpenSSL(bn_value, m_field, metrics));
+
+			return element;
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		/*
+			implementations of GF2nOpenSSLFieldContext
+		*/
+		GF2nOpenSSLFieldContext::GF2nOpenSSLFieldContext( const uint32 field_size, const std::vector<int> &irred_poly )
+			: m_field_size(field_size)
+			, m_num_limbs(utils::calcNumberChunks<uint32>(field_size, sizeof(ufixn) * 8))
+			, m_irred_poly(irred_poly)
+			, m_poly(NULL)
+			, m_native_field(native::findNativeField(irred_poly, native::getIsa()))
+		{
+			assert(!m_irred_poly.empty() && m_irred_poly.back() == -1);
+
+			// only exponent arrays that start with the degree are
+			// converted, the raw chunks of a dummy modulus are not
+			if( m_irred_poly[0] == static_cast<int>(field_size) )
+			{
+				m_poly = BN_new();
+				BN_GF2m_arr2poly(&m_irred_poly[0], m_poly);
+			}
+
+			// the chain follows the bits of field_size - 1 from the top,
+			// each bit doubles k and a set bit adds one more
+			uint32 n = field_size > 1 ? field_size - 1 : 1;
+			uint32 top = 31;
+			while( (n >> top) == 0 )
+				--top;
+
+			m_inverse_chain.push_back(1);
+			for( uint32 bit=top; bit-- > 0; )
+			{
+				m_inverse_chain.push_back(2 * m_inverse_chain.back());
+				if( (n >> bit) & 1 )
+					m_inverse_chain.push_back(m_inverse_chain.back() + 1);
+			}
+		}
+
+		GF2nOpenSSLFieldContext::~GF2nOpenSSLFieldContext()
+		{
+			if( m_poly )
+				BN_free(m_poly);
+		}
+
+		uint32 GF2nOpenSSLFieldContext::getFieldSize() const
+		{
+			return m_field_size;
+		}
+
+		uint32 GF2nOpenSSLFieldContext::getNumLimbs() const
+		{
+			return m_num_limbs;
+		}
+
+		const int *GF2nOpenSSLFieldContext::getIrredPoly() const
+		{
+			return &m_irred_poly[0];
+		}
+
+		const BIGNUM *GF2nOpenSSLFieldContext::getPoly() const
+		{
+			return m_poly;
+		}
+
+		const std::vector<uint32> &GF2nOpenSSLFieldContext::getInverseChain() const
+		{
+			return m_inverse_chain;
+		}
+
+		const native::GF2nNativeField *GF2nOpenSSLFieldContext::getNativeField() const
+		{
+			return m_native_field;
+		}
+
 		///////////////////////////////////////////////////////////////////////
 		/*
 			implementations of MethodNotFoundException
@@ -275,28 +850,26 @@ namespace libcumffa {
 		/*
 			implementations of GF2nArithmeticElementOpenSSL
 		*/
-		GF2nArithmeticElementOpenSSL::GF2nArithmeticElementOpenSSL( BIGNUM *value, const uint32 field_size, std::vector<int> irred_poly, GF2nOpenSSLMetrics metrics )
+		GF2nArithmeticElementOpenSSL::GF2nArithmeticElementOpenSSL( BIGNUM *value, GF2nOpenSSLFieldContextPtr const& field, GF2nOpenSSLMetrics metrics )
 		: m_value(value)
-		, m_field_size(field_size)
-		, m_irred_poly(irred_poly)
+		, m_field(field)
 		, m_metrics(metrics) {}
 
 		GF2nArithmeticElementOpenSSL::~GF2nArithmeticElementOpenSSL()
 		{
 			if( m_value )
-				BN_free(m_value);
+				openssl::freeBN(m_value);
 		}
 
 		GF2nArithmeticElementInterface *GF2nArithmeticElementOpenSSL::add( GF2nArithmeticElementInterface *other )
 		{
-			BIGNUM *res = BN_new();
-			BIGNUM *other_value = reinterpret_cast<GF2nArithmeticElementOpenSSL *>(other)->getValue();
-
-			m_metrics.creation_time = openssl::add(m_value, other_value, res);
+			BIGNUM *res = openssl::newBN();
+			const BIGNUM *other_value = static_cast<GF2nArithmeticElementOpenSSL *>(other)->getValue();
 
-			GF2nArithmeticElementInterface *new_element = new GF2nArithmeticElementOpenSSL(res, m_field_size, m_irred_poly, m_metrics);
+			GF2nOpenSSLMetrics metrics;
+			metrics.creation_time = openssl::add(m_value, other_value, res);
 
-			BN_free(other_value);
+			GF2nArithmeticElementInterface *new_element = new GF2nArithmeticElementOpenSSL(res, m_field, metrics);
 
 			return new_element;
 		}
@@ -308,14 +881,13 @@ namespace libcumffa {
 
 		GF2nArithmeticElementInterface *GF2nArithmeticElementOpenSSL::mul( GF2nArithmeticElementInterface *other )
 		{
-			BIGNUM *res = BN_new();
-			BIGNUM *other_value = reinterpret_cast<GF2nArithmeticElementOpenSSL *>(other)->getValue();
-
-			m_metrics.creation_time = openssl::mul(m_value, other_value, &m_irred_poly[0], res);
+			BIGNUM *res = openssl::newBN();
+			const BIGNUM *other_value = static_cast<GF2nArithmeticElementOpenSSL *>(other)->getValue();
 
-			GF2nArithmeticElementInterface *new_element = new GF2nArithmeticElementOpenSSL(res, m_field_size, m_irred_poly, m_metrics);
+			GF2nOpenSSLMetrics metrics;
+			metrics.creation_time = openssl::mul(m_value, other_value, m_field->getIrredPoly(), res);
 
-			BN_free(other_value);
+			GF2nArithmeticElementInterface *new_element = new GF2nArithmeticElementOpenSSL(res, m_field, metrics);
 
 			return new_element;
 		}
@@ -327,84 +899,105 @@ namespace libcumffa {
 
 		GF2nArithmeticElementInterface *GF2nArithmeticElementOpenSSL::exp( uint32 value )
 		{
-			BIGNUM *res = BN_new();
-			BIGNUM *k = BN_new();
-
-			std::ostringstream value_str;
-			value_str << value;
-			BN_dec2bn(&k, value_str.str().c_str());
-
-			m_metrics.creation_time = openssl::exp(m_value, k, &m_irred_poly[0], res);
+			BIGNUM *res = openssl::newBN();
 
-			GF2nArithmeticElementInterface *new_element = new GF2nArithmeticElementOpenSSL(res, m_field_size, m_irred_poly, m_metrics);
+			GF2nOpenSSLMetrics metrics;
+			metrics.creation_time = openssl::exp(m_value, value, *m_field, res);
 
-			BN_free(k);
+			GF2nArithmeticElementInterface *new_element = new GF2nArithmeticElementOpenSSL(res, m_field, metrics);
 
 			return new_element;
 		}
 
 		GF2nArithmeticElementInterface *GF2nArithmeticElementOpenSSL::inverse( uint32 value )
 		{
-			BIGNUM *res = BN_new();
+			BIGNUM *res = openssl::newBN();
 
-			m_metrics.creation_time = openssl::inverse(m_value, &m_irred_poly[0], res);
+			GF2nOpenSSLMetrics metrics;
+			metrics.creation_time = openssl::inverse(m_value, *m_field, res);
 
-			GF2nArithmeticElementInterface *new_element = new GF2nArithmeticElementOpenSSL(res, m_field_size, m_irred_poly, m_metrics);
+			GF2nArithmeticElementInterface *new_element = new GF2nArithmeticElementOpenSSL(res, m_field, metrics);
 
 			return new_element;
 		}		
 
 		GF2nArithmeticElementInterface *GF2nArithmeticElementOpenSSL::runWithElement( const std::string &what, GF2nArithmeticElementInterface *other )
 		{
-			if( what.compare("add") == 0 )
+			return runWithElement(openssl::resolveOp(what), other);
+		}
+
+		GF2nArithmeticElementInterface *GF2nArithmeticElementOpenSSL::runWithValue( const std::string &what, uint32 value )
+		{
+			return runWithValue(openssl::resolveOp(what), value);
+		}
+
+		GF2nArithmeticElementInterface *GF2nArithmeticElementOpenSSL::runWithElement( const int32 op, GF2nArithmeticElementInterface *other )
+		{
+			switch( op )
 			{
+			case GF2N_OP_ADD:
 				return add(other);
-			}
-			else if( what.compare("sub") == 0 )
-			{
+			case GF2N_OP_SUB:
 				return sub(other);
-			}
-			else if( what.compare("mul") == 0 )
-			{
+			case GF2N_OP_MUL:
 				return mul(other);
+			default:
+				throw MethodNotFoundException(openssl::opName(op));
 			}
-			else
-			{
-				throw MethodNotFoundException(what);
-			}	
 		}
 
-		GF2nArithmeticElementInterface *GF2nArithmeticElementOpenSSL::runWithValue( const std::string &what, uint32 value )
+		GF2nArithmeticElementInterface *GF2nArithmeticElementOpenSSL::runWithValue( const int32 op, uint32 value )
 		{
-			if( what.compare("exp") == 0 )
+			switch( op )
 			{
+			case GF2N_OP_EXP:
 				return exp(value);
-			}
-			else if( what.compare("inverse") == 0 )
-			{
+			case GF2N_OP_INVERSE:
 				return inverse(value);
-			}
-			else
-			{
-				throw MethodNotFoundException(what);
+			default:
+				throw MethodNotFoundException(openssl::opName(op));
 			}
 		}		
 
 		std::string GF2nArithmeticElementOpenSSL::toString()
 		{
-			std::string ret(BN_bn2dec(m_value));
-			return ret;
+			// BN_bn2dec is quadratic in the number of digits
+			uint32 num_limbs = std::max<uint32>(1, utils::calcNumberChunks<uint32>(BN_num_bits(m_value), sizeof(ufixn) * 8));
+			std::vector<ufixn> limbs(num_limbs);
+			getLimbs(&limbs[0], num_limbs);
+
+			return utils::limbsToDecimal(&limbs[0], num_limbs);
 		}
 
 		void GF2nArithmeticElementOpenSSL::getValue( std::vector<uint8> &value )
 		{
-			uint32 num_uint8_chunks = utils::calcNumberChunks<uint32>(m_field_size, sizeof(uint8) * 8);
+			uint32 num_uint8_chunks = utils::calcNumberChunks<uint32>(m_field->getFieldSize(), sizeof(uint8) * 8);
+
+			value.assign(num_uint8_chunks, 0);
+			if( num_uint8_chunks > 0 )
+				getValue(&value[0], num_uint8_chunks);
+		}
+
+		void GF2nArithmeticElementOpenSSL::getValue( uint8_t *value, const size_t num_bytes )
+		{
+			size_t bn_num_bytes = static_cast<size_t>(BN_num_bytes(m_value));
 
-			uint32 bn_num_bytes = static_cast<uint32>(BN_num_bytes(m_value));
-			assert(bn_num_bytes <= num_uint8_chunks);
+			if( bn_num_bytes > num_bytes )
+				throw InvalidEncodingException("the value does not fit into the byte buffer");
+
+			// the bytes are written straight from the BIGNUM, no copy of it
+			memset(value, 0, num_bytes - bn_num_bytes);
+			BN_bn2bin(m_value, value + num_bytes - bn_num_bytes);
+		}
 
-			value.resize(num_uint8_chunks, 0);
-			BN_bn2bin(m_value, &value[num_uint8_chunks - bn_num_bytes]);
+		void GF2nArithmeticElementOpenSSL::getLimbs( ufixn *limbs, const uint32 num_limbs )
+		{
+			openssl::bn2limbs(m_value, limbs, num_limbs);
+		}
+
+		uint32 GF2nArithmeticElementOpenSSL::getFieldSize()
+		{
+			return m_field->getFieldSize();
 		}
 
 		std::string GF2nArithmeticElementOpenSSL::getMetrics()
@@ -434,10 +1027,9 @@ namespace libcumffa {
 		void GF2nArithmeticElementOpenSSL::setProperty( const std::string &property_name, const std::string &property_value )
 		{}
 
-		BIGNUM *GF2nArithmeticElementOpenSSL::getValue()
+		const BIGNUM *GF2nArithmeticElementOpenSSL::getValue() const
 		{
-			BIGNUM *res = BN_dup(m_value);
-			return res;
+			return m_value;
 		}
 	}
 }
\ No newline at end of file
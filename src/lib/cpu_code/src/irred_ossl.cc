@@ -1,12191 +0,0 @@
-// This file is auto-generated by gen_irreps.cc, don't modify
-#include <openssl/bn.h>
-#include <iostream>
-#include <cstdlib>
-#include <vector>
-using namespace std;
-void set_irrep(vector<int> &p, unsigned n) {
-switch (n) {
-case 1: {
-p.push_back(1);
-} break;
-case 2: {
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 3: {
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 4: {
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 5: {
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 6: {
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 7: {
-p.push_back(7);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 8: {
-p.push_back(8);
-p.push_back(4);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 9: {
-p.push_back(9);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 10: {
-p.push_back(10);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 11: {
-p.push_back(11);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 12: {
-p.push_back(12);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 13: {
-p.push_back(13);
-p.push_back(4);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 14: {
-p.push_back(14);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 15: {
-p.push_back(15);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 16: {
-p.push_back(16);
-p.push_back(5);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 17: {
-p.push_back(17);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 18: {
-p.push_back(18);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 19: {
-p.push_back(19);
-p.push_back(5);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 20: {
-p.push_back(20);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 21: {
-p.push_back(21);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 22: {
-p.push_back(22);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 23: {
-p.push_back(23);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 24: {
-p.push_back(24);
-p.push_back(4);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 25: {
-p.push_back(25);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 26: {
-p.push_back(26);
-p.push_back(4);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 27: {
-p.push_back(27);
-p.push_back(5);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 28: {
-p.push_back(28);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 29: {
-p.push_back(29);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 30: {
-p.push_back(30);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 31: {
-p.push_back(31);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 32: {
-p.push_back(32);
-p.push_back(7);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 33: {
-p.push_back(33);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 34: {
-p.push_back(34);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 35: {
-p.push_back(35);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 36: {
-p.push_back(36);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 37: {
-p.push_back(37);
-p.push_back(6);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 38: {
-p.push_back(38);
-p.push_back(6);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 39: {
-p.push_back(39);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 40: {
-p.push_back(40);
-p.push_back(5);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 41: {
-p.push_back(41);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 42: {
-p.push_back(42);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 43: {
-p.push_back(43);
-p.push_back(6);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 44: {
-p.push_back(44);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 45: {
-p.push_back(45);
-p.push_back(4);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 46: {
-p.push_back(46);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 47: {
-p.push_back(47);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 48: {
-p.push_back(48);
-p.push_back(5);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 49: {
-p.push_back(49);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 50: {
-p.push_back(50);
-p.push_back(4);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 51: {
-p.push_back(51);
-p.push_back(6);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 52: {
-p.push_back(52);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 53: {
-p.push_back(53);
-p.push_back(6);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 54: {
-p.push_back(54);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 55: {
-p.push_back(55);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 56: {
-p.push_back(56);
-p.push_back(7);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 57: {
-p.push_back(57);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 58: {
-p.push_back(58);
-p.push_back(19);
-p.push_back(0);
-} break;
-case 59: {
-p.push_back(59);
-p.push_back(7);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 60: {
-p.push_back(60);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 61: {
-p.push_back(61);
-p.push_back(5);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 62: {
-p.push_back(62);
-p.push_back(29);
-p.push_back(0);
-} break;
-case 63: {
-p.push_back(63);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 64: {
-p.push_back(64);
-p.push_back(4);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 65: {
-p.push_back(65);
-p.push_back(18);
-p.push_back(0);
-} break;
-case 66: {
-p.push_back(66);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 67: {
-p.push_back(67);
-p.push_back(5);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 68: {
-p.push_back(68);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 69: {
-p.push_back(69);
-p.push_back(6);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 70: {
-p.push_back(70);
-p.push_back(5);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 71: {
-p.push_back(71);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 72: {
-p.push_back(72);
-p.push_back(10);
-p.push_back(9);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 73: {
-p.push_back(73);
-p.push_back(25);
-p.push_back(0);
-} break;
-case 74: {
-p.push_back(74);
-p.push_back(35);
-p.push_back(0);
-} break;
-case 75: {
-p.push_back(75);
-p.push_back(6);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 76: {
-p.push_back(76);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 77: {
-p.push_back(77);
-p.push_back(6);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 78: {
-p.push_back(78);
-p.push_back(6);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 79: {
-p.push_back(79);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 80: {
-p.push_back(80);
-p.push_back(9);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 81: {
-p.push_back(81);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 82: {
-p.push_back(82);
-p.push_back(8);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 83: {
-p.push_back(83);
-p.push_back(7);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 84: {
-p.push_back(84);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 85: {
-p.push_back(85);
-p.push_back(8);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 86: {
-p.push_back(86);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 87: {
-p.push_back(87);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 88: {
-p.push_back(88);
-p.push_back(7);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 89: {
-p.push_back(89);
-p.push_back(38);
-p.push_back(0);
-} break;
-case 90: {
-p.push_back(90);
-p.push_back(27);
-p.push_back(0);
-} break;
-case 91: {
-p.push_back(91);
-p.push_back(8);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 92: {
-p.push_back(92);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 93: {
-p.push_back(93);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 94: {
-p.push_back(94);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 95: {
-p.push_back(95);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 96: {
-p.push_back(96);
-p.push_back(10);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 97: {
-p.push_back(97);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 98: {
-p.push_back(98);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 99: {
-p.push_back(99);
-p.push_back(6);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 100: {
-p.push_back(100);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 101: {
-p.push_back(101);
-p.push_back(7);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 102: {
-p.push_back(102);
-p.push_back(29);
-p.push_back(0);
-} break;
-case 103: {
-p.push_back(103);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 104: {
-p.push_back(104);
-p.push_back(4);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 105: {
-p.push_back(105);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 106: {
-p.push_back(106);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 107: {
-p.push_back(107);
-p.push_back(9);
-p.push_back(7);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 108: {
-p.push_back(108);
-p.push_back(17);
-p.push_back(0);
-} break;
-case 109: {
-p.push_back(109);
-p.push_back(5);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 110: {
-p.push_back(110);
-p.push_back(33);
-p.push_back(0);
-} break;
-case 111: {
-p.push_back(111);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 112: {
-p.push_back(112);
-p.push_back(5);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 113: {
-p.push_back(113);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 114: {
-p.push_back(114);
-p.push_back(5);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 115: {
-p.push_back(115);
-p.push_back(8);
-p.push_back(7);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 116: {
-p.push_back(116);
-p.push_back(4);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 117: {
-p.push_back(117);
-p.push_back(5);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 118: {
-p.push_back(118);
-p.push_back(33);
-p.push_back(0);
-} break;
-case 119: {
-p.push_back(119);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 120: {
-p.push_back(120);
-p.push_back(4);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 121: {
-p.push_back(121);
-p.push_back(18);
-p.push_back(0);
-} break;
-case 122: {
-p.push_back(122);
-p.push_back(6);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 123: {
-p.push_back(123);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 124: {
-p.push_back(124);
-p.push_back(19);
-p.push_back(0);
-} break;
-case 125: {
-p.push_back(125);
-p.push_back(7);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 126: {
-p.push_back(126);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 127: {
-p.push_back(127);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 128: {
-p.push_back(128);
-p.push_back(7);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 129: {
-p.push_back(129);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 130: {
-p.push_back(130);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 131: {
-p.push_back(131);
-p.push_back(8);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 132: {
-p.push_back(132);
-p.push_back(17);
-p.push_back(0);
-} break;
-case 133: {
-p.push_back(133);
-p.push_back(9);
-p.push_back(8);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 134: {
-p.push_back(134);
-p.push_back(57);
-p.push_back(0);
-} break;
-case 135: {
-p.push_back(135);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 136: {
-p.push_back(136);
-p.push_back(5);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 137: {
-p.push_back(137);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 138: {
-p.push_back(138);
-p.push_back(8);
-p.push_back(7);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 139: {
-p.push_back(139);
-p.push_back(8);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 140: {
-p.push_back(140);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 141: {
-p.push_back(141);
-p.push_back(10);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 142: {
-p.push_back(142);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 143: {
-p.push_back(143);
-p.push_back(5);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 144: {
-p.push_back(144);
-p.push_back(7);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 145: {
-p.push_back(145);
-p.push_back(52);
-p.push_back(0);
-} break;
-case 146: {
-p.push_back(146);
-p.push_back(71);
-p.push_back(0);
-} break;
-case 147: {
-p.push_back(147);
-p.push_back(14);
-p.push_back(0);
-} break;
-case 148: {
-p.push_back(148);
-p.push_back(27);
-p.push_back(0);
-} break;
-case 149: {
-p.push_back(149);
-p.push_back(10);
-p.push_back(9);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 150: {
-p.push_back(150);
-p.push_back(53);
-p.push_back(0);
-} break;
-case 151: {
-p.push_back(151);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 152: {
-p.push_back(152);
-p.push_back(6);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 153: {
-p.push_back(153);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 154: {
-p.push_back(154);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 155: {
-p.push_back(155);
-p.push_back(62);
-p.push_back(0);
-} break;
-case 156: {
-p.push_back(156);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 157: {
-p.push_back(157);
-p.push_back(6);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 158: {
-p.push_back(158);
-p.push_back(8);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 159: {
-p.push_back(159);
-p.push_back(31);
-p.push_back(0);
-} break;
-case 160: {
-p.push_back(160);
-p.push_back(5);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 161: {
-p.push_back(161);
-p.push_back(18);
-p.push_back(0);
-} break;
-case 162: {
-p.push_back(162);
-p.push_back(27);
-p.push_back(0);
-} break;
-case 163: {
-p.push_back(163);
-p.push_back(7);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 164: {
-p.push_back(164);
-p.push_back(10);
-p.push_back(8);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 165: {
-p.push_back(165);
-p.push_back(9);
-p.push_back(8);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 166: {
-p.push_back(166);
-p.push_back(37);
-p.push_back(0);
-} break;
-case 167: {
-p.push_back(167);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 168: {
-p.push_back(168);
-p.push_back(15);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 169: {
-p.push_back(169);
-p.push_back(34);
-p.push_back(0);
-} break;
-case 170: {
-p.push_back(170);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 171: {
-p.push_back(171);
-p.push_back(6);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 172: {
-p.push_back(172);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 173: {
-p.push_back(173);
-p.push_back(8);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 174: {
-p.push_back(174);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 175: {
-p.push_back(175);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 176: {
-p.push_back(176);
-p.push_back(11);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 177: {
-p.push_back(177);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 178: {
-p.push_back(178);
-p.push_back(31);
-p.push_back(0);
-} break;
-case 179: {
-p.push_back(179);
-p.push_back(4);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 180: {
-p.push_back(180);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 181: {
-p.push_back(181);
-p.push_back(7);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 182: {
-p.push_back(182);
-p.push_back(81);
-p.push_back(0);
-} break;
-case 183: {
-p.push_back(183);
-p.push_back(56);
-p.push_back(0);
-} break;
-case 184: {
-p.push_back(184);
-p.push_back(9);
-p.push_back(8);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 185: {
-p.push_back(185);
-p.push_back(24);
-p.push_back(0);
-} break;
-case 186: {
-p.push_back(186);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 187: {
-p.push_back(187);
-p.push_back(7);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 188: {
-p.push_back(188);
-p.push_back(6);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 189: {
-p.push_back(189);
-p.push_back(6);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 190: {
-p.push_back(190);
-p.push_back(8);
-p.push_back(7);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 191: {
-p.push_back(191);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 192: {
-p.push_back(192);
-p.push_back(7);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 193: {
-p.push_back(193);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 194: {
-p.push_back(194);
-p.push_back(87);
-p.push_back(0);
-} break;
-case 195: {
-p.push_back(195);
-p.push_back(8);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 196: {
-p.push_back(196);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 197: {
-p.push_back(197);
-p.push_back(9);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 198: {
-p.push_back(198);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 199: {
-p.push_back(199);
-p.push_back(34);
-p.push_back(0);
-} break;
-case 200: {
-p.push_back(200);
-p.push_back(5);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 201: {
-p.push_back(201);
-p.push_back(14);
-p.push_back(0);
-} break;
-case 202: {
-p.push_back(202);
-p.push_back(55);
-p.push_back(0);
-} break;
-case 203: {
-p.push_back(203);
-p.push_back(8);
-p.push_back(7);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 204: {
-p.push_back(204);
-p.push_back(27);
-p.push_back(0);
-} break;
-case 205: {
-p.push_back(205);
-p.push_back(9);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 206: {
-p.push_back(206);
-p.push_back(10);
-p.push_back(9);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 207: {
-p.push_back(207);
-p.push_back(43);
-p.push_back(0);
-} break;
-case 208: {
-p.push_back(208);
-p.push_back(9);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 209: {
-p.push_back(209);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 210: {
-p.push_back(210);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 211: {
-p.push_back(211);
-p.push_back(11);
-p.push_back(10);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 212: {
-p.push_back(212);
-p.push_back(105);
-p.push_back(0);
-} break;
-case 213: {
-p.push_back(213);
-p.push_back(6);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 214: {
-p.push_back(214);
-p.push_back(73);
-p.push_back(0);
-} break;
-case 215: {
-p.push_back(215);
-p.push_back(23);
-p.push_back(0);
-} break;
-case 216: {
-p.push_back(216);
-p.push_back(7);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 217: {
-p.push_back(217);
-p.push_back(45);
-p.push_back(0);
-} break;
-case 218: {
-p.push_back(218);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 219: {
-p.push_back(219);
-p.push_back(8);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 220: {
-p.push_back(220);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 221: {
-p.push_back(221);
-p.push_back(8);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 222: {
-p.push_back(222);
-p.push_back(5);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 223: {
-p.push_back(223);
-p.push_back(33);
-p.push_back(0);
-} break;
-case 224: {
-p.push_back(224);
-p.push_back(9);
-p.push_back(8);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 225: {
-p.push_back(225);
-p.push_back(32);
-p.push_back(0);
-} break;
-case 226: {
-p.push_back(226);
-p.push_back(10);
-p.push_back(7);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 227: {
-p.push_back(227);
-p.push_back(10);
-p.push_back(9);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 228: {
-p.push_back(228);
-p.push_back(113);
-p.push_back(0);
-} break;
-case 229: {
-p.push_back(229);
-p.push_back(10);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 230: {
-p.push_back(230);
-p.push_back(8);
-p.push_back(7);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 231: {
-p.push_back(231);
-p.push_back(26);
-p.push_back(0);
-} break;
-case 232: {
-p.push_back(232);
-p.push_back(9);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 233: {
-p.push_back(233);
-p.push_back(74);
-p.push_back(0);
-} break;
-case 234: {
-p.push_back(234);
-p.push_back(31);
-p.push_back(0);
-} break;
-case 235: {
-p.push_back(235);
-p.push_back(9);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 236: {
-p.push_back(236);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 237: {
-p.push_back(237);
-p.push_back(7);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 238: {
-p.push_back(238);
-p.push_back(73);
-p.push_back(0);
-} break;
-case 239: {
-p.push_back(239);
-p.push_back(36);
-p.push_back(0);
-} break;
-case 240: {
-p.push_back(240);
-p.push_back(8);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 241: {
-p.push_back(241);
-p.push_back(70);
-p.push_back(0);
-} break;
-case 242: {
-p.push_back(242);
-p.push_back(95);
-p.push_back(0);
-} break;
-case 243: {
-p.push_back(243);
-p.push_back(8);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 244: {
-p.push_back(244);
-p.push_back(111);
-p.push_back(0);
-} break;
-case 245: {
-p.push_back(245);
-p.push_back(6);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 246: {
-p.push_back(246);
-p.push_back(11);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 247: {
-p.push_back(247);
-p.push_back(82);
-p.push_back(0);
-} break;
-case 248: {
-p.push_back(248);
-p.push_back(15);
-p.push_back(14);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 249: {
-p.push_back(249);
-p.push_back(35);
-p.push_back(0);
-} break;
-case 250: {
-p.push_back(250);
-p.push_back(103);
-p.push_back(0);
-} break;
-case 251: {
-p.push_back(251);
-p.push_back(7);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 252: {
-p.push_back(252);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 253: {
-p.push_back(253);
-p.push_back(46);
-p.push_back(0);
-} break;
-case 254: {
-p.push_back(254);
-p.push_back(7);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 255: {
-p.push_back(255);
-p.push_back(52);
-p.push_back(0);
-} break;
-case 256: {
-p.push_back(256);
-p.push_back(10);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 257: {
-p.push_back(257);
-p.push_back(12);
-p.push_back(0);
-} break;
-case 258: {
-p.push_back(258);
-p.push_back(71);
-p.push_back(0);
-} break;
-case 259: {
-p.push_back(259);
-p.push_back(10);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 260: {
-p.push_back(260);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 261: {
-p.push_back(261);
-p.push_back(7);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 262: {
-p.push_back(262);
-p.push_back(9);
-p.push_back(8);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 263: {
-p.push_back(263);
-p.push_back(93);
-p.push_back(0);
-} break;
-case 264: {
-p.push_back(264);
-p.push_back(9);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 265: {
-p.push_back(265);
-p.push_back(42);
-p.push_back(0);
-} break;
-case 266: {
-p.push_back(266);
-p.push_back(47);
-p.push_back(0);
-} break;
-case 267: {
-p.push_back(267);
-p.push_back(8);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 268: {
-p.push_back(268);
-p.push_back(25);
-p.push_back(0);
-} break;
-case 269: {
-p.push_back(269);
-p.push_back(7);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 270: {
-p.push_back(270);
-p.push_back(53);
-p.push_back(0);
-} break;
-case 271: {
-p.push_back(271);
-p.push_back(58);
-p.push_back(0);
-} break;
-case 272: {
-p.push_back(272);
-p.push_back(9);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 273: {
-p.push_back(273);
-p.push_back(23);
-p.push_back(0);
-} break;
-case 274: {
-p.push_back(274);
-p.push_back(67);
-p.push_back(0);
-} break;
-case 275: {
-p.push_back(275);
-p.push_back(11);
-p.push_back(10);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 276: {
-p.push_back(276);
-p.push_back(63);
-p.push_back(0);
-} break;
-case 277: {
-p.push_back(277);
-p.push_back(12);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 278: {
-p.push_back(278);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 279: {
-p.push_back(279);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 280: {
-p.push_back(280);
-p.push_back(9);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 281: {
-p.push_back(281);
-p.push_back(93);
-p.push_back(0);
-} break;
-case 282: {
-p.push_back(282);
-p.push_back(35);
-p.push_back(0);
-} break;
-case 283: {
-p.push_back(283);
-p.push_back(12);
-p.push_back(7);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 284: {
-p.push_back(284);
-p.push_back(53);
-p.push_back(0);
-} break;
-case 285: {
-p.push_back(285);
-p.push_back(10);
-p.push_back(7);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 286: {
-p.push_back(286);
-p.push_back(69);
-p.push_back(0);
-} break;
-case 287: {
-p.push_back(287);
-p.push_back(71);
-p.push_back(0);
-} break;
-case 288: {
-p.push_back(288);
-p.push_back(11);
-p.push_back(10);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 289: {
-p.push_back(289);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 290: {
-p.push_back(290);
-p.push_back(5);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 291: {
-p.push_back(291);
-p.push_back(12);
-p.push_back(11);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 292: {
-p.push_back(292);
-p.push_back(37);
-p.push_back(0);
-} break;
-case 293: {
-p.push_back(293);
-p.push_back(11);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 294: {
-p.push_back(294);
-p.push_back(33);
-p.push_back(0);
-} break;
-case 295: {
-p.push_back(295);
-p.push_back(48);
-p.push_back(0);
-} break;
-case 296: {
-p.push_back(296);
-p.push_back(7);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 297: {
-p.push_back(297);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 298: {
-p.push_back(298);
-p.push_back(11);
-p.push_back(8);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 299: {
-p.push_back(299);
-p.push_back(11);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 300: {
-p.push_back(300);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 301: {
-p.push_back(301);
-p.push_back(9);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 302: {
-p.push_back(302);
-p.push_back(41);
-p.push_back(0);
-} break;
-case 303: {
-p.push_back(303);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 304: {
-p.push_back(304);
-p.push_back(11);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 305: {
-p.push_back(305);
-p.push_back(102);
-p.push_back(0);
-} break;
-case 306: {
-p.push_back(306);
-p.push_back(7);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 307: {
-p.push_back(307);
-p.push_back(8);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 308: {
-p.push_back(308);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 309: {
-p.push_back(309);
-p.push_back(10);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 310: {
-p.push_back(310);
-p.push_back(93);
-p.push_back(0);
-} break;
-case 311: {
-p.push_back(311);
-p.push_back(7);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 312: {
-p.push_back(312);
-p.push_back(9);
-p.push_back(7);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 313: {
-p.push_back(313);
-p.push_back(79);
-p.push_back(0);
-} break;
-case 314: {
-p.push_back(314);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 315: {
-p.push_back(315);
-p.push_back(10);
-p.push_back(9);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 316: {
-p.push_back(316);
-p.push_back(63);
-p.push_back(0);
-} break;
-case 317: {
-p.push_back(317);
-p.push_back(7);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 318: {
-p.push_back(318);
-p.push_back(45);
-p.push_back(0);
-} break;
-case 319: {
-p.push_back(319);
-p.push_back(36);
-p.push_back(0);
-} break;
-case 320: {
-p.push_back(320);
-p.push_back(4);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 321: {
-p.push_back(321);
-p.push_back(31);
-p.push_back(0);
-} break;
-case 322: {
-p.push_back(322);
-p.push_back(67);
-p.push_back(0);
-} break;
-case 323: {
-p.push_back(323);
-p.push_back(10);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 324: {
-p.push_back(324);
-p.push_back(51);
-p.push_back(0);
-} break;
-case 325: {
-p.push_back(325);
-p.push_back(10);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 326: {
-p.push_back(326);
-p.push_back(10);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 327: {
-p.push_back(327);
-p.push_back(34);
-p.push_back(0);
-} break;
-case 328: {
-p.push_back(328);
-p.push_back(8);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 329: {
-p.push_back(329);
-p.push_back(50);
-p.push_back(0);
-} break;
-case 330: {
-p.push_back(330);
-p.push_back(99);
-p.push_back(0);
-} break;
-case 331: {
-p.push_back(331);
-p.push_back(10);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 332: {
-p.push_back(332);
-p.push_back(89);
-p.push_back(0);
-} break;
-case 333: {
-p.push_back(333);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 334: {
-p.push_back(334);
-p.push_back(5);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 335: {
-p.push_back(335);
-p.push_back(10);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 336: {
-p.push_back(336);
-p.push_back(7);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 337: {
-p.push_back(337);
-p.push_back(55);
-p.push_back(0);
-} break;
-case 338: {
-p.push_back(338);
-p.push_back(4);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 339: {
-p.push_back(339);
-p.push_back(16);
-p.push_back(10);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 340: {
-p.push_back(340);
-p.push_back(45);
-p.push_back(0);
-} break;
-case 341: {
-p.push_back(341);
-p.push_back(10);
-p.push_back(8);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 342: {
-p.push_back(342);
-p.push_back(125);
-p.push_back(0);
-} break;
-case 343: {
-p.push_back(343);
-p.push_back(75);
-p.push_back(0);
-} break;
-case 344: {
-p.push_back(344);
-p.push_back(7);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 345: {
-p.push_back(345);
-p.push_back(22);
-p.push_back(0);
-} break;
-case 346: {
-p.push_back(346);
-p.push_back(63);
-p.push_back(0);
-} break;
-case 347: {
-p.push_back(347);
-p.push_back(11);
-p.push_back(10);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 348: {
-p.push_back(348);
-p.push_back(103);
-p.push_back(0);
-} break;
-case 349: {
-p.push_back(349);
-p.push_back(6);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 350: {
-p.push_back(350);
-p.push_back(53);
-p.push_back(0);
-} break;
-case 351: {
-p.push_back(351);
-p.push_back(34);
-p.push_back(0);
-} break;
-case 352: {
-p.push_back(352);
-p.push_back(13);
-p.push_back(11);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 353: {
-p.push_back(353);
-p.push_back(69);
-p.push_back(0);
-} break;
-case 354: {
-p.push_back(354);
-p.push_back(99);
-p.push_back(0);
-} break;
-case 355: {
-p.push_back(355);
-p.push_back(6);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 356: {
-p.push_back(356);
-p.push_back(10);
-p.push_back(9);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 357: {
-p.push_back(357);
-p.push_back(11);
-p.push_back(10);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 358: {
-p.push_back(358);
-p.push_back(57);
-p.push_back(0);
-} break;
-case 359: {
-p.push_back(359);
-p.push_back(68);
-p.push_back(0);
-} break;
-case 360: {
-p.push_back(360);
-p.push_back(5);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 361: {
-p.push_back(361);
-p.push_back(7);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 362: {
-p.push_back(362);
-p.push_back(63);
-p.push_back(0);
-} break;
-case 363: {
-p.push_back(363);
-p.push_back(8);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 364: {
-p.push_back(364);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 365: {
-p.push_back(365);
-p.push_back(9);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 366: {
-p.push_back(366);
-p.push_back(29);
-p.push_back(0);
-} break;
-case 367: {
-p.push_back(367);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 368: {
-p.push_back(368);
-p.push_back(7);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 369: {
-p.push_back(369);
-p.push_back(91);
-p.push_back(0);
-} break;
-case 370: {
-p.push_back(370);
-p.push_back(139);
-p.push_back(0);
-} break;
-case 371: {
-p.push_back(371);
-p.push_back(8);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 372: {
-p.push_back(372);
-p.push_back(111);
-p.push_back(0);
-} break;
-case 373: {
-p.push_back(373);
-p.push_back(8);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 374: {
-p.push_back(374);
-p.push_back(8);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 375: {
-p.push_back(375);
-p.push_back(16);
-p.push_back(0);
-} break;
-case 376: {
-p.push_back(376);
-p.push_back(8);
-p.push_back(7);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 377: {
-p.push_back(377);
-p.push_back(41);
-p.push_back(0);
-} break;
-case 378: {
-p.push_back(378);
-p.push_back(43);
-p.push_back(0);
-} break;
-case 379: {
-p.push_back(379);
-p.push_back(10);
-p.push_back(8);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 380: {
-p.push_back(380);
-p.push_back(47);
-p.push_back(0);
-} break;
-case 381: {
-p.push_back(381);
-p.push_back(5);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 382: {
-p.push_back(382);
-p.push_back(81);
-p.push_back(0);
-} break;
-case 383: {
-p.push_back(383);
-p.push_back(90);
-p.push_back(0);
-} break;
-case 384: {
-p.push_back(384);
-p.push_back(12);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 385: {
-p.push_back(385);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 386: {
-p.push_back(386);
-p.push_back(83);
-p.push_back(0);
-} break;
-case 387: {
-p.push_back(387);
-p.push_back(8);
-p.push_back(7);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 388: {
-p.push_back(388);
-p.push_back(159);
-p.push_back(0);
-} break;
-case 389: {
-p.push_back(389);
-p.push_back(10);
-p.push_back(9);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 390: {
-p.push_back(390);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 391: {
-p.push_back(391);
-p.push_back(28);
-p.push_back(0);
-} break;
-case 392: {
-p.push_back(392);
-p.push_back(13);
-p.push_back(10);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 393: {
-p.push_back(393);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 394: {
-p.push_back(394);
-p.push_back(135);
-p.push_back(0);
-} break;
-case 395: {
-p.push_back(395);
-p.push_back(11);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 396: {
-p.push_back(396);
-p.push_back(25);
-p.push_back(0);
-} break;
-case 397: {
-p.push_back(397);
-p.push_back(12);
-p.push_back(7);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 398: {
-p.push_back(398);
-p.push_back(7);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 399: {
-p.push_back(399);
-p.push_back(26);
-p.push_back(0);
-} break;
-case 400: {
-p.push_back(400);
-p.push_back(5);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 401: {
-p.push_back(401);
-p.push_back(152);
-p.push_back(0);
-} break;
-case 402: {
-p.push_back(402);
-p.push_back(171);
-p.push_back(0);
-} break;
-case 403: {
-p.push_back(403);
-p.push_back(9);
-p.push_back(8);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 404: {
-p.push_back(404);
-p.push_back(65);
-p.push_back(0);
-} break;
-case 405: {
-p.push_back(405);
-p.push_back(13);
-p.push_back(8);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 406: {
-p.push_back(406);
-p.push_back(141);
-p.push_back(0);
-} break;
-case 407: {
-p.push_back(407);
-p.push_back(71);
-p.push_back(0);
-} break;
-case 408: {
-p.push_back(408);
-p.push_back(5);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 409: {
-p.push_back(409);
-p.push_back(87);
-p.push_back(0);
-} break;
-case 410: {
-p.push_back(410);
-p.push_back(10);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 411: {
-p.push_back(411);
-p.push_back(12);
-p.push_back(10);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 412: {
-p.push_back(412);
-p.push_back(147);
-p.push_back(0);
-} break;
-case 413: {
-p.push_back(413);
-p.push_back(10);
-p.push_back(7);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 414: {
-p.push_back(414);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 415: {
-p.push_back(415);
-p.push_back(102);
-p.push_back(0);
-} break;
-case 416: {
-p.push_back(416);
-p.push_back(9);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 417: {
-p.push_back(417);
-p.push_back(107);
-p.push_back(0);
-} break;
-case 418: {
-p.push_back(418);
-p.push_back(199);
-p.push_back(0);
-} break;
-case 419: {
-p.push_back(419);
-p.push_back(15);
-p.push_back(5);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 420: {
-p.push_back(420);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 421: {
-p.push_back(421);
-p.push_back(5);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 422: {
-p.push_back(422);
-p.push_back(149);
-p.push_back(0);
-} break;
-case 423: {
-p.push_back(423);
-p.push_back(25);
-p.push_back(0);
-} break;
-case 424: {
-p.push_back(424);
-p.push_back(9);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 425: {
-p.push_back(425);
-p.push_back(12);
-p.push_back(0);
-} break;
-case 426: {
-p.push_back(426);
-p.push_back(63);
-p.push_back(0);
-} break;
-case 427: {
-p.push_back(427);
-p.push_back(11);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 428: {
-p.push_back(428);
-p.push_back(105);
-p.push_back(0);
-} break;
-case 429: {
-p.push_back(429);
-p.push_back(10);
-p.push_back(8);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 430: {
-p.push_back(430);
-p.push_back(14);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 431: {
-p.push_back(431);
-p.push_back(120);
-p.push_back(0);
-} break;
-case 432: {
-p.push_back(432);
-p.push_back(13);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 433: {
-p.push_back(433);
-p.push_back(33);
-p.push_back(0);
-} break;
-case 434: {
-p.push_back(434);
-p.push_back(12);
-p.push_back(11);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 435: {
-p.push_back(435);
-p.push_back(12);
-p.push_back(9);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 436: {
-p.push_back(436);
-p.push_back(165);
-p.push_back(0);
-} break;
-case 437: {
-p.push_back(437);
-p.push_back(6);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 438: {
-p.push_back(438);
-p.push_back(65);
-p.push_back(0);
-} break;
-case 439: {
-p.push_back(439);
-p.push_back(49);
-p.push_back(0);
-} break;
-case 440: {
-p.push_back(440);
-p.push_back(4);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 441: {
-p.push_back(441);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 442: {
-p.push_back(442);
-p.push_back(7);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 443: {
-p.push_back(443);
-p.push_back(10);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 444: {
-p.push_back(444);
-p.push_back(81);
-p.push_back(0);
-} break;
-case 445: {
-p.push_back(445);
-p.push_back(7);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 446: {
-p.push_back(446);
-p.push_back(105);
-p.push_back(0);
-} break;
-case 447: {
-p.push_back(447);
-p.push_back(73);
-p.push_back(0);
-} break;
-case 448: {
-p.push_back(448);
-p.push_back(11);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 449: {
-p.push_back(449);
-p.push_back(134);
-p.push_back(0);
-} break;
-case 450: {
-p.push_back(450);
-p.push_back(47);
-p.push_back(0);
-} break;
-case 451: {
-p.push_back(451);
-p.push_back(16);
-p.push_back(10);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 452: {
-p.push_back(452);
-p.push_back(6);
-p.push_back(5);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 453: {
-p.push_back(453);
-p.push_back(15);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 454: {
-p.push_back(454);
-p.push_back(8);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 455: {
-p.push_back(455);
-p.push_back(38);
-p.push_back(0);
-} break;
-case 456: {
-p.push_back(456);
-p.push_back(18);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 457: {
-p.push_back(457);
-p.push_back(16);
-p.push_back(0);
-} break;
-case 458: {
-p.push_back(458);
-p.push_back(203);
-p.push_back(0);
-} break;
-case 459: {
-p.push_back(459);
-p.push_back(12);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 460: {
-p.push_back(460);
-p.push_back(19);
-p.push_back(0);
-} break;
-case 461: {
-p.push_back(461);
-p.push_back(7);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 462: {
-p.push_back(462);
-p.push_back(73);
-p.push_back(0);
-} break;
-case 463: {
-p.push_back(463);
-p.push_back(93);
-p.push_back(0);
-} break;
-case 464: {
-p.push_back(464);
-p.push_back(19);
-p.push_back(18);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 465: {
-p.push_back(465);
-p.push_back(31);
-p.push_back(0);
-} break;
-case 466: {
-p.push_back(466);
-p.push_back(14);
-p.push_back(11);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 467: {
-p.push_back(467);
-p.push_back(11);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 468: {
-p.push_back(468);
-p.push_back(27);
-p.push_back(0);
-} break;
-case 469: {
-p.push_back(469);
-p.push_back(9);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 470: {
-p.push_back(470);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 471: {
-p.push_back(471);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 472: {
-p.push_back(472);
-p.push_back(11);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 473: {
-p.push_back(473);
-p.push_back(200);
-p.push_back(0);
-} break;
-case 474: {
-p.push_back(474);
-p.push_back(191);
-p.push_back(0);
-} break;
-case 475: {
-p.push_back(475);
-p.push_back(9);
-p.push_back(8);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 476: {
-p.push_back(476);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 477: {
-p.push_back(477);
-p.push_back(16);
-p.push_back(15);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 478: {
-p.push_back(478);
-p.push_back(121);
-p.push_back(0);
-} break;
-case 479: {
-p.push_back(479);
-p.push_back(104);
-p.push_back(0);
-} break;
-case 480: {
-p.push_back(480);
-p.push_back(15);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 481: {
-p.push_back(481);
-p.push_back(138);
-p.push_back(0);
-} break;
-case 482: {
-p.push_back(482);
-p.push_back(9);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 483: {
-p.push_back(483);
-p.push_back(9);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 484: {
-p.push_back(484);
-p.push_back(105);
-p.push_back(0);
-} break;
-case 485: {
-p.push_back(485);
-p.push_back(17);
-p.push_back(16);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 486: {
-p.push_back(486);
-p.push_back(81);
-p.push_back(0);
-} break;
-case 487: {
-p.push_back(487);
-p.push_back(94);
-p.push_back(0);
-} break;
-case 488: {
-p.push_back(488);
-p.push_back(4);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 489: {
-p.push_back(489);
-p.push_back(83);
-p.push_back(0);
-} break;
-case 490: {
-p.push_back(490);
-p.push_back(219);
-p.push_back(0);
-} break;
-case 491: {
-p.push_back(491);
-p.push_back(11);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 492: {
-p.push_back(492);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 493: {
-p.push_back(493);
-p.push_back(10);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 494: {
-p.push_back(494);
-p.push_back(17);
-p.push_back(0);
-} break;
-case 495: {
-p.push_back(495);
-p.push_back(76);
-p.push_back(0);
-} break;
-case 496: {
-p.push_back(496);
-p.push_back(16);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 497: {
-p.push_back(497);
-p.push_back(78);
-p.push_back(0);
-} break;
-case 498: {
-p.push_back(498);
-p.push_back(155);
-p.push_back(0);
-} break;
-case 499: {
-p.push_back(499);
-p.push_back(11);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 500: {
-p.push_back(500);
-p.push_back(27);
-p.push_back(0);
-} break;
-case 501: {
-p.push_back(501);
-p.push_back(5);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 502: {
-p.push_back(502);
-p.push_back(8);
-p.push_back(5);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 503: {
-p.push_back(503);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 504: {
-p.push_back(504);
-p.push_back(15);
-p.push_back(14);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 505: {
-p.push_back(505);
-p.push_back(156);
-p.push_back(0);
-} break;
-case 506: {
-p.push_back(506);
-p.push_back(23);
-p.push_back(0);
-} break;
-case 507: {
-p.push_back(507);
-p.push_back(13);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 508: {
-p.push_back(508);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 509: {
-p.push_back(509);
-p.push_back(8);
-p.push_back(7);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 510: {
-p.push_back(510);
-p.push_back(69);
-p.push_back(0);
-} break;
-case 511: {
-p.push_back(511);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 512: {
-p.push_back(512);
-p.push_back(8);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 513: {
-p.push_back(513);
-p.push_back(26);
-p.push_back(0);
-} break;
-case 514: {
-p.push_back(514);
-p.push_back(67);
-p.push_back(0);
-} break;
-case 515: {
-p.push_back(515);
-p.push_back(14);
-p.push_back(7);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 516: {
-p.push_back(516);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 517: {
-p.push_back(517);
-p.push_back(12);
-p.push_back(10);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 518: {
-p.push_back(518);
-p.push_back(33);
-p.push_back(0);
-} break;
-case 519: {
-p.push_back(519);
-p.push_back(79);
-p.push_back(0);
-} break;
-case 520: {
-p.push_back(520);
-p.push_back(15);
-p.push_back(11);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 521: {
-p.push_back(521);
-p.push_back(32);
-p.push_back(0);
-} break;
-case 522: {
-p.push_back(522);
-p.push_back(39);
-p.push_back(0);
-} break;
-case 523: {
-p.push_back(523);
-p.push_back(13);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 524: {
-p.push_back(524);
-p.push_back(167);
-p.push_back(0);
-} break;
-case 525: {
-p.push_back(525);
-p.push_back(6);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 526: {
-p.push_back(526);
-p.push_back(97);
-p.push_back(0);
-} break;
-case 527: {
-p.push_back(527);
-p.push_back(47);
-p.push_back(0);
-} break;
-case 528: {
-p.push_back(528);
-p.push_back(11);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 529: {
-p.push_back(529);
-p.push_back(42);
-p.push_back(0);
-} break;
-case 530: {
-p.push_back(530);
-p.push_back(10);
-p.push_back(7);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 531: {
-p.push_back(531);
-p.push_back(10);
-p.push_back(5);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 532: {
-p.push_back(532);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 533: {
-p.push_back(533);
-p.push_back(4);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 534: {
-p.push_back(534);
-p.push_back(161);
-p.push_back(0);
-} break;
-case 535: {
-p.push_back(535);
-p.push_back(8);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 536: {
-p.push_back(536);
-p.push_back(7);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 537: {
-p.push_back(537);
-p.push_back(94);
-p.push_back(0);
-} break;
-case 538: {
-p.push_back(538);
-p.push_back(195);
-p.push_back(0);
-} break;
-case 539: {
-p.push_back(539);
-p.push_back(10);
-p.push_back(5);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 540: {
-p.push_back(540);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 541: {
-p.push_back(541);
-p.push_back(13);
-p.push_back(10);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 542: {
-p.push_back(542);
-p.push_back(8);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 543: {
-p.push_back(543);
-p.push_back(16);
-p.push_back(0);
-} break;
-case 544: {
-p.push_back(544);
-p.push_back(8);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 545: {
-p.push_back(545);
-p.push_back(122);
-p.push_back(0);
-} break;
-case 546: {
-p.push_back(546);
-p.push_back(8);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 547: {
-p.push_back(547);
-p.push_back(13);
-p.push_back(7);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 548: {
-p.push_back(548);
-p.push_back(10);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 549: {
-p.push_back(549);
-p.push_back(16);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 550: {
-p.push_back(550);
-p.push_back(193);
-p.push_back(0);
-} break;
-case 551: {
-p.push_back(551);
-p.push_back(135);
-p.push_back(0);
-} break;
-case 552: {
-p.push_back(552);
-p.push_back(19);
-p.push_back(16);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 553: {
-p.push_back(553);
-p.push_back(39);
-p.push_back(0);
-} break;
-case 554: {
-p.push_back(554);
-p.push_back(10);
-p.push_back(8);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 555: {
-p.push_back(555);
-p.push_back(10);
-p.push_back(9);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 556: {
-p.push_back(556);
-p.push_back(153);
-p.push_back(0);
-} break;
-case 557: {
-p.push_back(557);
-p.push_back(7);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 558: {
-p.push_back(558);
-p.push_back(73);
-p.push_back(0);
-} break;
-case 559: {
-p.push_back(559);
-p.push_back(34);
-p.push_back(0);
-} break;
-case 560: {
-p.push_back(560);
-p.push_back(11);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 561: {
-p.push_back(561);
-p.push_back(71);
-p.push_back(0);
-} break;
-case 562: {
-p.push_back(562);
-p.push_back(11);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 563: {
-p.push_back(563);
-p.push_back(14);
-p.push_back(7);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 564: {
-p.push_back(564);
-p.push_back(163);
-p.push_back(0);
-} break;
-case 565: {
-p.push_back(565);
-p.push_back(11);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 566: {
-p.push_back(566);
-p.push_back(153);
-p.push_back(0);
-} break;
-case 567: {
-p.push_back(567);
-p.push_back(28);
-p.push_back(0);
-} break;
-case 568: {
-p.push_back(568);
-p.push_back(15);
-p.push_back(7);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 569: {
-p.push_back(569);
-p.push_back(77);
-p.push_back(0);
-} break;
-case 570: {
-p.push_back(570);
-p.push_back(67);
-p.push_back(0);
-} break;
-case 571: {
-p.push_back(571);
-p.push_back(10);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 572: {
-p.push_back(572);
-p.push_back(12);
-p.push_back(8);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 573: {
-p.push_back(573);
-p.push_back(10);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 574: {
-p.push_back(574);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 575: {
-p.push_back(575);
-p.push_back(146);
-p.push_back(0);
-} break;
-case 576: {
-p.push_back(576);
-p.push_back(13);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 577: {
-p.push_back(577);
-p.push_back(25);
-p.push_back(0);
-} break;
-case 578: {
-p.push_back(578);
-p.push_back(23);
-p.push_back(22);
-p.push_back(16);
-p.push_back(0);
-} break;
-case 579: {
-p.push_back(579);
-p.push_back(12);
-p.push_back(9);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 580: {
-p.push_back(580);
-p.push_back(237);
-p.push_back(0);
-} break;
-case 581: {
-p.push_back(581);
-p.push_back(13);
-p.push_back(7);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 582: {
-p.push_back(582);
-p.push_back(85);
-p.push_back(0);
-} break;
-case 583: {
-p.push_back(583);
-p.push_back(130);
-p.push_back(0);
-} break;
-case 584: {
-p.push_back(584);
-p.push_back(14);
-p.push_back(13);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 585: {
-p.push_back(585);
-p.push_back(88);
-p.push_back(0);
-} break;
-case 586: {
-p.push_back(586);
-p.push_back(7);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 587: {
-p.push_back(587);
-p.push_back(11);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 588: {
-p.push_back(588);
-p.push_back(35);
-p.push_back(0);
-} break;
-case 589: {
-p.push_back(589);
-p.push_back(10);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 590: {
-p.push_back(590);
-p.push_back(93);
-p.push_back(0);
-} break;
-case 591: {
-p.push_back(591);
-p.push_back(9);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 592: {
-p.push_back(592);
-p.push_back(13);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 593: {
-p.push_back(593);
-p.push_back(86);
-p.push_back(0);
-} break;
-case 594: {
-p.push_back(594);
-p.push_back(19);
-p.push_back(0);
-} break;
-case 595: {
-p.push_back(595);
-p.push_back(9);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 596: {
-p.push_back(596);
-p.push_back(273);
-p.push_back(0);
-} break;
-case 597: {
-p.push_back(597);
-p.push_back(14);
-p.push_back(12);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 598: {
-p.push_back(598);
-p.push_back(7);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 599: {
-p.push_back(599);
-p.push_back(30);
-p.push_back(0);
-} break;
-case 600: {
-p.push_back(600);
-p.push_back(9);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 601: {
-p.push_back(601);
-p.push_back(201);
-p.push_back(0);
-} break;
-case 602: {
-p.push_back(602);
-p.push_back(215);
-p.push_back(0);
-} break;
-case 603: {
-p.push_back(603);
-p.push_back(6);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 604: {
-p.push_back(604);
-p.push_back(105);
-p.push_back(0);
-} break;
-case 605: {
-p.push_back(605);
-p.push_back(10);
-p.push_back(7);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 606: {
-p.push_back(606);
-p.push_back(165);
-p.push_back(0);
-} break;
-case 607: {
-p.push_back(607);
-p.push_back(105);
-p.push_back(0);
-} break;
-case 608: {
-p.push_back(608);
-p.push_back(19);
-p.push_back(13);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 609: {
-p.push_back(609);
-p.push_back(31);
-p.push_back(0);
-} break;
-case 610: {
-p.push_back(610);
-p.push_back(127);
-p.push_back(0);
-} break;
-case 611: {
-p.push_back(611);
-p.push_back(10);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 612: {
-p.push_back(612);
-p.push_back(81);
-p.push_back(0);
-} break;
-case 613: {
-p.push_back(613);
-p.push_back(19);
-p.push_back(10);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 614: {
-p.push_back(614);
-p.push_back(45);
-p.push_back(0);
-} break;
-case 615: {
-p.push_back(615);
-p.push_back(211);
-p.push_back(0);
-} break;
-case 616: {
-p.push_back(616);
-p.push_back(19);
-p.push_back(10);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 617: {
-p.push_back(617);
-p.push_back(200);
-p.push_back(0);
-} break;
-case 618: {
-p.push_back(618);
-p.push_back(295);
-p.push_back(0);
-} break;
-case 619: {
-p.push_back(619);
-p.push_back(9);
-p.push_back(8);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 620: {
-p.push_back(620);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 621: {
-p.push_back(621);
-p.push_back(12);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 622: {
-p.push_back(622);
-p.push_back(297);
-p.push_back(0);
-} break;
-case 623: {
-p.push_back(623);
-p.push_back(68);
-p.push_back(0);
-} break;
-case 624: {
-p.push_back(624);
-p.push_back(11);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 625: {
-p.push_back(625);
-p.push_back(133);
-p.push_back(0);
-} break;
-case 626: {
-p.push_back(626);
-p.push_back(251);
-p.push_back(0);
-} break;
-case 627: {
-p.push_back(627);
-p.push_back(13);
-p.push_back(8);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 628: {
-p.push_back(628);
-p.push_back(223);
-p.push_back(0);
-} break;
-case 629: {
-p.push_back(629);
-p.push_back(6);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 630: {
-p.push_back(630);
-p.push_back(7);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 631: {
-p.push_back(631);
-p.push_back(307);
-p.push_back(0);
-} break;
-case 632: {
-p.push_back(632);
-p.push_back(9);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 633: {
-p.push_back(633);
-p.push_back(101);
-p.push_back(0);
-} break;
-case 634: {
-p.push_back(634);
-p.push_back(39);
-p.push_back(0);
-} break;
-case 635: {
-p.push_back(635);
-p.push_back(14);
-p.push_back(10);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 636: {
-p.push_back(636);
-p.push_back(217);
-p.push_back(0);
-} break;
-case 637: {
-p.push_back(637);
-p.push_back(14);
-p.push_back(9);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 638: {
-p.push_back(638);
-p.push_back(6);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 639: {
-p.push_back(639);
-p.push_back(16);
-p.push_back(0);
-} break;
-case 640: {
-p.push_back(640);
-p.push_back(14);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 641: {
-p.push_back(641);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 642: {
-p.push_back(642);
-p.push_back(119);
-p.push_back(0);
-} break;
-case 643: {
-p.push_back(643);
-p.push_back(11);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 644: {
-p.push_back(644);
-p.push_back(11);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 645: {
-p.push_back(645);
-p.push_back(11);
-p.push_back(8);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 646: {
-p.push_back(646);
-p.push_back(249);
-p.push_back(0);
-} break;
-case 647: {
-p.push_back(647);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 648: {
-p.push_back(648);
-p.push_back(13);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 649: {
-p.push_back(649);
-p.push_back(37);
-p.push_back(0);
-} break;
-case 650: {
-p.push_back(650);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 651: {
-p.push_back(651);
-p.push_back(14);
-p.push_back(0);
-} break;
-case 652: {
-p.push_back(652);
-p.push_back(93);
-p.push_back(0);
-} break;
-case 653: {
-p.push_back(653);
-p.push_back(10);
-p.push_back(8);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 654: {
-p.push_back(654);
-p.push_back(33);
-p.push_back(0);
-} break;
-case 655: {
-p.push_back(655);
-p.push_back(88);
-p.push_back(0);
-} break;
-case 656: {
-p.push_back(656);
-p.push_back(7);
-p.push_back(5);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 657: {
-p.push_back(657);
-p.push_back(38);
-p.push_back(0);
-} break;
-case 658: {
-p.push_back(658);
-p.push_back(55);
-p.push_back(0);
-} break;
-case 659: {
-p.push_back(659);
-p.push_back(15);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 660: {
-p.push_back(660);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 661: {
-p.push_back(661);
-p.push_back(12);
-p.push_back(11);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 662: {
-p.push_back(662);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 663: {
-p.push_back(663);
-p.push_back(107);
-p.push_back(0);
-} break;
-case 664: {
-p.push_back(664);
-p.push_back(11);
-p.push_back(9);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 665: {
-p.push_back(665);
-p.push_back(33);
-p.push_back(0);
-} break;
-case 666: {
-p.push_back(666);
-p.push_back(10);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 667: {
-p.push_back(667);
-p.push_back(18);
-p.push_back(7);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 668: {
-p.push_back(668);
-p.push_back(147);
-p.push_back(0);
-} break;
-case 669: {
-p.push_back(669);
-p.push_back(5);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 670: {
-p.push_back(670);
-p.push_back(153);
-p.push_back(0);
-} break;
-case 671: {
-p.push_back(671);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 672: {
-p.push_back(672);
-p.push_back(11);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 673: {
-p.push_back(673);
-p.push_back(28);
-p.push_back(0);
-} break;
-case 674: {
-p.push_back(674);
-p.push_back(11);
-p.push_back(7);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 675: {
-p.push_back(675);
-p.push_back(6);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 676: {
-p.push_back(676);
-p.push_back(31);
-p.push_back(0);
-} break;
-case 677: {
-p.push_back(677);
-p.push_back(8);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 678: {
-p.push_back(678);
-p.push_back(15);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 679: {
-p.push_back(679);
-p.push_back(66);
-p.push_back(0);
-} break;
-case 680: {
-p.push_back(680);
-p.push_back(23);
-p.push_back(16);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 681: {
-p.push_back(681);
-p.push_back(11);
-p.push_back(9);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 682: {
-p.push_back(682);
-p.push_back(171);
-p.push_back(0);
-} break;
-case 683: {
-p.push_back(683);
-p.push_back(11);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 684: {
-p.push_back(684);
-p.push_back(209);
-p.push_back(0);
-} break;
-case 685: {
-p.push_back(685);
-p.push_back(4);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 686: {
-p.push_back(686);
-p.push_back(197);
-p.push_back(0);
-} break;
-case 687: {
-p.push_back(687);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 688: {
-p.push_back(688);
-p.push_back(19);
-p.push_back(14);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 689: {
-p.push_back(689);
-p.push_back(14);
-p.push_back(0);
-} break;
-case 690: {
-p.push_back(690);
-p.push_back(79);
-p.push_back(0);
-} break;
-case 691: {
-p.push_back(691);
-p.push_back(13);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 692: {
-p.push_back(692);
-p.push_back(299);
-p.push_back(0);
-} break;
-case 693: {
-p.push_back(693);
-p.push_back(15);
-p.push_back(8);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 694: {
-p.push_back(694);
-p.push_back(169);
-p.push_back(0);
-} break;
-case 695: {
-p.push_back(695);
-p.push_back(177);
-p.push_back(0);
-} break;
-case 696: {
-p.push_back(696);
-p.push_back(23);
-p.push_back(10);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 697: {
-p.push_back(697);
-p.push_back(267);
-p.push_back(0);
-} break;
-case 698: {
-p.push_back(698);
-p.push_back(215);
-p.push_back(0);
-} break;
-case 699: {
-p.push_back(699);
-p.push_back(15);
-p.push_back(10);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 700: {
-p.push_back(700);
-p.push_back(75);
-p.push_back(0);
-} break;
-case 701: {
-p.push_back(701);
-p.push_back(16);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 702: {
-p.push_back(702);
-p.push_back(37);
-p.push_back(0);
-} break;
-case 703: {
-p.push_back(703);
-p.push_back(12);
-p.push_back(7);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 704: {
-p.push_back(704);
-p.push_back(8);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 705: {
-p.push_back(705);
-p.push_back(17);
-p.push_back(0);
-} break;
-case 706: {
-p.push_back(706);
-p.push_back(12);
-p.push_back(11);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 707: {
-p.push_back(707);
-p.push_back(15);
-p.push_back(8);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 708: {
-p.push_back(708);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 709: {
-p.push_back(709);
-p.push_back(4);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 710: {
-p.push_back(710);
-p.push_back(13);
-p.push_back(12);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 711: {
-p.push_back(711);
-p.push_back(92);
-p.push_back(0);
-} break;
-case 712: {
-p.push_back(712);
-p.push_back(5);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 713: {
-p.push_back(713);
-p.push_back(41);
-p.push_back(0);
-} break;
-case 714: {
-p.push_back(714);
-p.push_back(23);
-p.push_back(0);
-} break;
-case 715: {
-p.push_back(715);
-p.push_back(7);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 716: {
-p.push_back(716);
-p.push_back(183);
-p.push_back(0);
-} break;
-case 717: {
-p.push_back(717);
-p.push_back(16);
-p.push_back(7);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 718: {
-p.push_back(718);
-p.push_back(165);
-p.push_back(0);
-} break;
-case 719: {
-p.push_back(719);
-p.push_back(150);
-p.push_back(0);
-} break;
-case 720: {
-p.push_back(720);
-p.push_back(9);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 721: {
-p.push_back(721);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 722: {
-p.push_back(722);
-p.push_back(231);
-p.push_back(0);
-} break;
-case 723: {
-p.push_back(723);
-p.push_back(16);
-p.push_back(10);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 724: {
-p.push_back(724);
-p.push_back(207);
-p.push_back(0);
-} break;
-case 725: {
-p.push_back(725);
-p.push_back(9);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 726: {
-p.push_back(726);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 727: {
-p.push_back(727);
-p.push_back(180);
-p.push_back(0);
-} break;
-case 728: {
-p.push_back(728);
-p.push_back(4);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 729: {
-p.push_back(729);
-p.push_back(58);
-p.push_back(0);
-} break;
-case 730: {
-p.push_back(730);
-p.push_back(147);
-p.push_back(0);
-} break;
-case 731: {
-p.push_back(731);
-p.push_back(8);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 732: {
-p.push_back(732);
-p.push_back(343);
-p.push_back(0);
-} break;
-case 733: {
-p.push_back(733);
-p.push_back(8);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 734: {
-p.push_back(734);
-p.push_back(11);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 735: {
-p.push_back(735);
-p.push_back(44);
-p.push_back(0);
-} break;
-case 736: {
-p.push_back(736);
-p.push_back(13);
-p.push_back(8);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 737: {
-p.push_back(737);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 738: {
-p.push_back(738);
-p.push_back(347);
-p.push_back(0);
-} break;
-case 739: {
-p.push_back(739);
-p.push_back(18);
-p.push_back(16);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 740: {
-p.push_back(740);
-p.push_back(135);
-p.push_back(0);
-} break;
-case 741: {
-p.push_back(741);
-p.push_back(9);
-p.push_back(8);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 742: {
-p.push_back(742);
-p.push_back(85);
-p.push_back(0);
-} break;
-case 743: {
-p.push_back(743);
-p.push_back(90);
-p.push_back(0);
-} break;
-case 744: {
-p.push_back(744);
-p.push_back(13);
-p.push_back(11);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 745: {
-p.push_back(745);
-p.push_back(258);
-p.push_back(0);
-} break;
-case 746: {
-p.push_back(746);
-p.push_back(351);
-p.push_back(0);
-} break;
-case 747: {
-p.push_back(747);
-p.push_back(10);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 748: {
-p.push_back(748);
-p.push_back(19);
-p.push_back(0);
-} break;
-case 749: {
-p.push_back(749);
-p.push_back(7);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 750: {
-p.push_back(750);
-p.push_back(309);
-p.push_back(0);
-} break;
-case 751: {
-p.push_back(751);
-p.push_back(18);
-p.push_back(0);
-} break;
-case 752: {
-p.push_back(752);
-p.push_back(13);
-p.push_back(10);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 753: {
-p.push_back(753);
-p.push_back(158);
-p.push_back(0);
-} break;
-case 754: {
-p.push_back(754);
-p.push_back(19);
-p.push_back(0);
-} break;
-case 755: {
-p.push_back(755);
-p.push_back(12);
-p.push_back(10);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 756: {
-p.push_back(756);
-p.push_back(45);
-p.push_back(0);
-} break;
-case 757: {
-p.push_back(757);
-p.push_back(7);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 758: {
-p.push_back(758);
-p.push_back(233);
-p.push_back(0);
-} break;
-case 759: {
-p.push_back(759);
-p.push_back(98);
-p.push_back(0);
-} break;
-case 760: {
-p.push_back(760);
-p.push_back(11);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 761: {
-p.push_back(761);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 762: {
-p.push_back(762);
-p.push_back(83);
-p.push_back(0);
-} break;
-case 763: {
-p.push_back(763);
-p.push_back(16);
-p.push_back(14);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 764: {
-p.push_back(764);
-p.push_back(6);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 765: {
-p.push_back(765);
-p.push_back(9);
-p.push_back(7);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 766: {
-p.push_back(766);
-p.push_back(22);
-p.push_back(19);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 767: {
-p.push_back(767);
-p.push_back(168);
-p.push_back(0);
-} break;
-case 768: {
-p.push_back(768);
-p.push_back(19);
-p.push_back(17);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 769: {
-p.push_back(769);
-p.push_back(120);
-p.push_back(0);
-} break;
-case 770: {
-p.push_back(770);
-p.push_back(14);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 771: {
-p.push_back(771);
-p.push_back(17);
-p.push_back(15);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 772: {
-p.push_back(772);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 773: {
-p.push_back(773);
-p.push_back(10);
-p.push_back(8);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 774: {
-p.push_back(774);
-p.push_back(185);
-p.push_back(0);
-} break;
-case 775: {
-p.push_back(775);
-p.push_back(93);
-p.push_back(0);
-} break;
-case 776: {
-p.push_back(776);
-p.push_back(15);
-p.push_back(14);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 777: {
-p.push_back(777);
-p.push_back(29);
-p.push_back(0);
-} break;
-case 778: {
-p.push_back(778);
-p.push_back(375);
-p.push_back(0);
-} break;
-case 779: {
-p.push_back(779);
-p.push_back(10);
-p.push_back(8);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 780: {
-p.push_back(780);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 781: {
-p.push_back(781);
-p.push_back(17);
-p.push_back(16);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 782: {
-p.push_back(782);
-p.push_back(329);
-p.push_back(0);
-} break;
-case 783: {
-p.push_back(783);
-p.push_back(68);
-p.push_back(0);
-} break;
-case 784: {
-p.push_back(784);
-p.push_back(13);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 785: {
-p.push_back(785);
-p.push_back(92);
-p.push_back(0);
-} break;
-case 786: {
-p.push_back(786);
-p.push_back(12);
-p.push_back(10);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 787: {
-p.push_back(787);
-p.push_back(7);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 788: {
-p.push_back(788);
-p.push_back(17);
-p.push_back(10);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 789: {
-p.push_back(789);
-p.push_back(5);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 790: {
-p.push_back(790);
-p.push_back(9);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 791: {
-p.push_back(791);
-p.push_back(30);
-p.push_back(0);
-} break;
-case 792: {
-p.push_back(792);
-p.push_back(9);
-p.push_back(7);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 793: {
-p.push_back(793);
-p.push_back(253);
-p.push_back(0);
-} break;
-case 794: {
-p.push_back(794);
-p.push_back(143);
-p.push_back(0);
-} break;
-case 795: {
-p.push_back(795);
-p.push_back(7);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 796: {
-p.push_back(796);
-p.push_back(9);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 797: {
-p.push_back(797);
-p.push_back(12);
-p.push_back(10);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 798: {
-p.push_back(798);
-p.push_back(53);
-p.push_back(0);
-} break;
-case 799: {
-p.push_back(799);
-p.push_back(25);
-p.push_back(0);
-} break;
-case 800: {
-p.push_back(800);
-p.push_back(9);
-p.push_back(7);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 801: {
-p.push_back(801);
-p.push_back(217);
-p.push_back(0);
-} break;
-case 802: {
-p.push_back(802);
-p.push_back(15);
-p.push_back(13);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 803: {
-p.push_back(803);
-p.push_back(14);
-p.push_back(9);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 804: {
-p.push_back(804);
-p.push_back(75);
-p.push_back(0);
-} break;
-case 805: {
-p.push_back(805);
-p.push_back(8);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 806: {
-p.push_back(806);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 807: {
-p.push_back(807);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 808: {
-p.push_back(808);
-p.push_back(14);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 809: {
-p.push_back(809);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 810: {
-p.push_back(810);
-p.push_back(159);
-p.push_back(0);
-} break;
-case 811: {
-p.push_back(811);
-p.push_back(12);
-p.push_back(10);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 812: {
-p.push_back(812);
-p.push_back(29);
-p.push_back(0);
-} break;
-case 813: {
-p.push_back(813);
-p.push_back(10);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 814: {
-p.push_back(814);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 815: {
-p.push_back(815);
-p.push_back(333);
-p.push_back(0);
-} break;
-case 816: {
-p.push_back(816);
-p.push_back(11);
-p.push_back(8);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 817: {
-p.push_back(817);
-p.push_back(52);
-p.push_back(0);
-} break;
-case 818: {
-p.push_back(818);
-p.push_back(119);
-p.push_back(0);
-} break;
-case 819: {
-p.push_back(819);
-p.push_back(16);
-p.push_back(9);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 820: {
-p.push_back(820);
-p.push_back(123);
-p.push_back(0);
-} break;
-case 821: {
-p.push_back(821);
-p.push_back(15);
-p.push_back(11);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 822: {
-p.push_back(822);
-p.push_back(17);
-p.push_back(0);
-} break;
-case 823: {
-p.push_back(823);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 824: {
-p.push_back(824);
-p.push_back(11);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 825: {
-p.push_back(825);
-p.push_back(38);
-p.push_back(0);
-} break;
-case 826: {
-p.push_back(826);
-p.push_back(255);
-p.push_back(0);
-} break;
-case 827: {
-p.push_back(827);
-p.push_back(12);
-p.push_back(10);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 828: {
-p.push_back(828);
-p.push_back(189);
-p.push_back(0);
-} break;
-case 829: {
-p.push_back(829);
-p.push_back(4);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 830: {
-p.push_back(830);
-p.push_back(17);
-p.push_back(10);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 831: {
-p.push_back(831);
-p.push_back(49);
-p.push_back(0);
-} break;
-case 832: {
-p.push_back(832);
-p.push_back(13);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 833: {
-p.push_back(833);
-p.push_back(149);
-p.push_back(0);
-} break;
-case 834: {
-p.push_back(834);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 835: {
-p.push_back(835);
-p.push_back(14);
-p.push_back(7);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 836: {
-p.push_back(836);
-p.push_back(10);
-p.push_back(9);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 837: {
-p.push_back(837);
-p.push_back(8);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 838: {
-p.push_back(838);
-p.push_back(61);
-p.push_back(0);
-} break;
-case 839: {
-p.push_back(839);
-p.push_back(54);
-p.push_back(0);
-} break;
-case 840: {
-p.push_back(840);
-p.push_back(11);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 841: {
-p.push_back(841);
-p.push_back(144);
-p.push_back(0);
-} break;
-case 842: {
-p.push_back(842);
-p.push_back(47);
-p.push_back(0);
-} break;
-case 843: {
-p.push_back(843);
-p.push_back(11);
-p.push_back(10);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 844: {
-p.push_back(844);
-p.push_back(105);
-p.push_back(0);
-} break;
-case 845: {
-p.push_back(845);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 846: {
-p.push_back(846);
-p.push_back(105);
-p.push_back(0);
-} break;
-case 847: {
-p.push_back(847);
-p.push_back(136);
-p.push_back(0);
-} break;
-case 848: {
-p.push_back(848);
-p.push_back(11);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 849: {
-p.push_back(849);
-p.push_back(253);
-p.push_back(0);
-} break;
-case 850: {
-p.push_back(850);
-p.push_back(111);
-p.push_back(0);
-} break;
-case 851: {
-p.push_back(851);
-p.push_back(13);
-p.push_back(10);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 852: {
-p.push_back(852);
-p.push_back(159);
-p.push_back(0);
-} break;
-case 853: {
-p.push_back(853);
-p.push_back(10);
-p.push_back(7);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 854: {
-p.push_back(854);
-p.push_back(7);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 855: {
-p.push_back(855);
-p.push_back(29);
-p.push_back(0);
-} break;
-case 856: {
-p.push_back(856);
-p.push_back(19);
-p.push_back(10);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 857: {
-p.push_back(857);
-p.push_back(119);
-p.push_back(0);
-} break;
-case 858: {
-p.push_back(858);
-p.push_back(207);
-p.push_back(0);
-} break;
-case 859: {
-p.push_back(859);
-p.push_back(17);
-p.push_back(15);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 860: {
-p.push_back(860);
-p.push_back(35);
-p.push_back(0);
-} break;
-case 861: {
-p.push_back(861);
-p.push_back(14);
-p.push_back(0);
-} break;
-case 862: {
-p.push_back(862);
-p.push_back(349);
-p.push_back(0);
-} break;
-case 863: {
-p.push_back(863);
-p.push_back(6);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 864: {
-p.push_back(864);
-p.push_back(21);
-p.push_back(10);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 865: {
-p.push_back(865);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 866: {
-p.push_back(866);
-p.push_back(75);
-p.push_back(0);
-} break;
-case 867: {
-p.push_back(867);
-p.push_back(9);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 868: {
-p.push_back(868);
-p.push_back(145);
-p.push_back(0);
-} break;
-case 869: {
-p.push_back(869);
-p.push_back(11);
-p.push_back(7);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 870: {
-p.push_back(870);
-p.push_back(301);
-p.push_back(0);
-} break;
-case 871: {
-p.push_back(871);
-p.push_back(378);
-p.push_back(0);
-} break;
-case 872: {
-p.push_back(872);
-p.push_back(13);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 873: {
-p.push_back(873);
-p.push_back(352);
-p.push_back(0);
-} break;
-case 874: {
-p.push_back(874);
-p.push_back(12);
-p.push_back(7);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 875: {
-p.push_back(875);
-p.push_back(12);
-p.push_back(8);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 876: {
-p.push_back(876);
-p.push_back(149);
-p.push_back(0);
-} break;
-case 877: {
-p.push_back(877);
-p.push_back(6);
-p.push_back(5);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 878: {
-p.push_back(878);
-p.push_back(12);
-p.push_back(9);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 879: {
-p.push_back(879);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 880: {
-p.push_back(880);
-p.push_back(15);
-p.push_back(7);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 881: {
-p.push_back(881);
-p.push_back(78);
-p.push_back(0);
-} break;
-case 882: {
-p.push_back(882);
-p.push_back(99);
-p.push_back(0);
-} break;
-case 883: {
-p.push_back(883);
-p.push_back(17);
-p.push_back(16);
-p.push_back(12);
-p.push_back(0);
-} break;
-case 884: {
-p.push_back(884);
-p.push_back(173);
-p.push_back(0);
-} break;
-case 885: {
-p.push_back(885);
-p.push_back(8);
-p.push_back(7);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 886: {
-p.push_back(886);
-p.push_back(13);
-p.push_back(9);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 887: {
-p.push_back(887);
-p.push_back(147);
-p.push_back(0);
-} break;
-case 888: {
-p.push_back(888);
-p.push_back(19);
-p.push_back(18);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 889: {
-p.push_back(889);
-p.push_back(127);
-p.push_back(0);
-} break;
-case 890: {
-p.push_back(890);
-p.push_back(183);
-p.push_back(0);
-} break;
-case 891: {
-p.push_back(891);
-p.push_back(12);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 892: {
-p.push_back(892);
-p.push_back(31);
-p.push_back(0);
-} break;
-case 893: {
-p.push_back(893);
-p.push_back(11);
-p.push_back(8);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 894: {
-p.push_back(894);
-p.push_back(173);
-p.push_back(0);
-} break;
-case 895: {
-p.push_back(895);
-p.push_back(12);
-p.push_back(0);
-} break;
-case 896: {
-p.push_back(896);
-p.push_back(7);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 897: {
-p.push_back(897);
-p.push_back(113);
-p.push_back(0);
-} break;
-case 898: {
-p.push_back(898);
-p.push_back(207);
-p.push_back(0);
-} break;
-case 899: {
-p.push_back(899);
-p.push_back(18);
-p.push_back(15);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 900: {
-p.push_back(900);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 901: {
-p.push_back(901);
-p.push_back(13);
-p.push_back(7);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 902: {
-p.push_back(902);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 903: {
-p.push_back(903);
-p.push_back(35);
-p.push_back(0);
-} break;
-case 904: {
-p.push_back(904);
-p.push_back(12);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 905: {
-p.push_back(905);
-p.push_back(117);
-p.push_back(0);
-} break;
-case 906: {
-p.push_back(906);
-p.push_back(123);
-p.push_back(0);
-} break;
-case 907: {
-p.push_back(907);
-p.push_back(12);
-p.push_back(10);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 908: {
-p.push_back(908);
-p.push_back(143);
-p.push_back(0);
-} break;
-case 909: {
-p.push_back(909);
-p.push_back(14);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 910: {
-p.push_back(910);
-p.push_back(15);
-p.push_back(9);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 911: {
-p.push_back(911);
-p.push_back(204);
-p.push_back(0);
-} break;
-case 912: {
-p.push_back(912);
-p.push_back(7);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 913: {
-p.push_back(913);
-p.push_back(91);
-p.push_back(0);
-} break;
-case 914: {
-p.push_back(914);
-p.push_back(4);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 915: {
-p.push_back(915);
-p.push_back(8);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 916: {
-p.push_back(916);
-p.push_back(183);
-p.push_back(0);
-} break;
-case 917: {
-p.push_back(917);
-p.push_back(12);
-p.push_back(10);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 918: {
-p.push_back(918);
-p.push_back(77);
-p.push_back(0);
-} break;
-case 919: {
-p.push_back(919);
-p.push_back(36);
-p.push_back(0);
-} break;
-case 920: {
-p.push_back(920);
-p.push_back(14);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 921: {
-p.push_back(921);
-p.push_back(221);
-p.push_back(0);
-} break;
-case 922: {
-p.push_back(922);
-p.push_back(7);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 923: {
-p.push_back(923);
-p.push_back(16);
-p.push_back(14);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 924: {
-p.push_back(924);
-p.push_back(31);
-p.push_back(0);
-} break;
-case 925: {
-p.push_back(925);
-p.push_back(16);
-p.push_back(15);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 926: {
-p.push_back(926);
-p.push_back(365);
-p.push_back(0);
-} break;
-case 927: {
-p.push_back(927);
-p.push_back(403);
-p.push_back(0);
-} break;
-case 928: {
-p.push_back(928);
-p.push_back(10);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 929: {
-p.push_back(929);
-p.push_back(11);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 930: {
-p.push_back(930);
-p.push_back(31);
-p.push_back(0);
-} break;
-case 931: {
-p.push_back(931);
-p.push_back(10);
-p.push_back(9);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 932: {
-p.push_back(932);
-p.push_back(177);
-p.push_back(0);
-} break;
-case 933: {
-p.push_back(933);
-p.push_back(16);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 934: {
-p.push_back(934);
-p.push_back(22);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 935: {
-p.push_back(935);
-p.push_back(417);
-p.push_back(0);
-} break;
-case 936: {
-p.push_back(936);
-p.push_back(15);
-p.push_back(13);
-p.push_back(12);
-p.push_back(0);
-} break;
-case 937: {
-p.push_back(937);
-p.push_back(217);
-p.push_back(0);
-} break;
-case 938: {
-p.push_back(938);
-p.push_back(207);
-p.push_back(0);
-} break;
-case 939: {
-p.push_back(939);
-p.push_back(7);
-p.push_back(5);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 940: {
-p.push_back(940);
-p.push_back(10);
-p.push_back(7);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 941: {
-p.push_back(941);
-p.push_back(11);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 942: {
-p.push_back(942);
-p.push_back(45);
-p.push_back(0);
-} break;
-case 943: {
-p.push_back(943);
-p.push_back(24);
-p.push_back(0);
-} break;
-case 944: {
-p.push_back(944);
-p.push_back(12);
-p.push_back(11);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 945: {
-p.push_back(945);
-p.push_back(77);
-p.push_back(0);
-} break;
-case 946: {
-p.push_back(946);
-p.push_back(21);
-p.push_back(20);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 947: {
-p.push_back(947);
-p.push_back(9);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 948: {
-p.push_back(948);
-p.push_back(189);
-p.push_back(0);
-} break;
-case 949: {
-p.push_back(949);
-p.push_back(8);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 950: {
-p.push_back(950);
-p.push_back(13);
-p.push_back(12);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 951: {
-p.push_back(951);
-p.push_back(260);
-p.push_back(0);
-} break;
-case 952: {
-p.push_back(952);
-p.push_back(16);
-p.push_back(9);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 953: {
-p.push_back(953);
-p.push_back(168);
-p.push_back(0);
-} break;
-case 954: {
-p.push_back(954);
-p.push_back(131);
-p.push_back(0);
-} break;
-case 955: {
-p.push_back(955);
-p.push_back(7);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 956: {
-p.push_back(956);
-p.push_back(305);
-p.push_back(0);
-} break;
-case 957: {
-p.push_back(957);
-p.push_back(10);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 958: {
-p.push_back(958);
-p.push_back(13);
-p.push_back(9);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 959: {
-p.push_back(959);
-p.push_back(143);
-p.push_back(0);
-} break;
-case 960: {
-p.push_back(960);
-p.push_back(12);
-p.push_back(9);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 961: {
-p.push_back(961);
-p.push_back(18);
-p.push_back(0);
-} break;
-case 962: {
-p.push_back(962);
-p.push_back(15);
-p.push_back(8);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 963: {
-p.push_back(963);
-p.push_back(20);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 964: {
-p.push_back(964);
-p.push_back(103);
-p.push_back(0);
-} break;
-case 965: {
-p.push_back(965);
-p.push_back(15);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 966: {
-p.push_back(966);
-p.push_back(201);
-p.push_back(0);
-} break;
-case 967: {
-p.push_back(967);
-p.push_back(36);
-p.push_back(0);
-} break;
-case 968: {
-p.push_back(968);
-p.push_back(9);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 969: {
-p.push_back(969);
-p.push_back(31);
-p.push_back(0);
-} break;
-case 970: {
-p.push_back(970);
-p.push_back(11);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 971: {
-p.push_back(971);
-p.push_back(6);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 972: {
-p.push_back(972);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 973: {
-p.push_back(973);
-p.push_back(13);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 974: {
-p.push_back(974);
-p.push_back(9);
-p.push_back(8);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 975: {
-p.push_back(975);
-p.push_back(19);
-p.push_back(0);
-} break;
-case 976: {
-p.push_back(976);
-p.push_back(17);
-p.push_back(10);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 977: {
-p.push_back(977);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 978: {
-p.push_back(978);
-p.push_back(9);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 979: {
-p.push_back(979);
-p.push_back(178);
-p.push_back(0);
-} break;
-case 980: {
-p.push_back(980);
-p.push_back(8);
-p.push_back(7);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 981: {
-p.push_back(981);
-p.push_back(12);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 982: {
-p.push_back(982);
-p.push_back(177);
-p.push_back(0);
-} break;
-case 983: {
-p.push_back(983);
-p.push_back(230);
-p.push_back(0);
-} break;
-case 984: {
-p.push_back(984);
-p.push_back(24);
-p.push_back(9);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 985: {
-p.push_back(985);
-p.push_back(222);
-p.push_back(0);
-} break;
-case 986: {
-p.push_back(986);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 987: {
-p.push_back(987);
-p.push_back(16);
-p.push_back(13);
-p.push_back(12);
-p.push_back(0);
-} break;
-case 988: {
-p.push_back(988);
-p.push_back(121);
-p.push_back(0);
-} break;
-case 989: {
-p.push_back(989);
-p.push_back(10);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 990: {
-p.push_back(990);
-p.push_back(161);
-p.push_back(0);
-} break;
-case 991: {
-p.push_back(991);
-p.push_back(39);
-p.push_back(0);
-} break;
-case 992: {
-p.push_back(992);
-p.push_back(17);
-p.push_back(15);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 993: {
-p.push_back(993);
-p.push_back(62);
-p.push_back(0);
-} break;
-case 994: {
-p.push_back(994);
-p.push_back(223);
-p.push_back(0);
-} break;
-case 995: {
-p.push_back(995);
-p.push_back(15);
-p.push_back(12);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 996: {
-p.push_back(996);
-p.push_back(65);
-p.push_back(0);
-} break;
-case 997: {
-p.push_back(997);
-p.push_back(12);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 998: {
-p.push_back(998);
-p.push_back(101);
-p.push_back(0);
-} break;
-case 999: {
-p.push_back(999);
-p.push_back(59);
-p.push_back(0);
-} break;
-case 1000: {
-p.push_back(1000);
-p.push_back(5);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1001: {
-p.push_back(1001);
-p.push_back(17);
-p.push_back(0);
-} break;
-case 1002: {
-p.push_back(1002);
-p.push_back(5);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1003: {
-p.push_back(1003);
-p.push_back(13);
-p.push_back(8);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1004: {
-p.push_back(1004);
-p.push_back(10);
-p.push_back(9);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1005: {
-p.push_back(1005);
-p.push_back(12);
-p.push_back(8);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1006: {
-p.push_back(1006);
-p.push_back(5);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1007: {
-p.push_back(1007);
-p.push_back(75);
-p.push_back(0);
-} break;
-case 1008: {
-p.push_back(1008);
-p.push_back(19);
-p.push_back(17);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1009: {
-p.push_back(1009);
-p.push_back(55);
-p.push_back(0);
-} break;
-case 1010: {
-p.push_back(1010);
-p.push_back(99);
-p.push_back(0);
-} break;
-case 1011: {
-p.push_back(1011);
-p.push_back(10);
-p.push_back(7);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1012: {
-p.push_back(1012);
-p.push_back(115);
-p.push_back(0);
-} break;
-case 1013: {
-p.push_back(1013);
-p.push_back(9);
-p.push_back(8);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1014: {
-p.push_back(1014);
-p.push_back(385);
-p.push_back(0);
-} break;
-case 1015: {
-p.push_back(1015);
-p.push_back(186);
-p.push_back(0);
-} break;
-case 1016: {
-p.push_back(1016);
-p.push_back(15);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1017: {
-p.push_back(1017);
-p.push_back(9);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1018: {
-p.push_back(1018);
-p.push_back(12);
-p.push_back(10);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1019: {
-p.push_back(1019);
-p.push_back(10);
-p.push_back(8);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1020: {
-p.push_back(1020);
-p.push_back(135);
-p.push_back(0);
-} break;
-case 1021: {
-p.push_back(1021);
-p.push_back(5);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1022: {
-p.push_back(1022);
-p.push_back(317);
-p.push_back(0);
-} break;
-case 1023: {
-p.push_back(1023);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1024: {
-p.push_back(1024);
-p.push_back(19);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1025: {
-p.push_back(1025);
-p.push_back(294);
-p.push_back(0);
-} break;
-case 1026: {
-p.push_back(1026);
-p.push_back(35);
-p.push_back(0);
-} break;
-case 1027: {
-p.push_back(1027);
-p.push_back(13);
-p.push_back(12);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1028: {
-p.push_back(1028);
-p.push_back(119);
-p.push_back(0);
-} break;
-case 1029: {
-p.push_back(1029);
-p.push_back(98);
-p.push_back(0);
-} break;
-case 1030: {
-p.push_back(1030);
-p.push_back(93);
-p.push_back(0);
-} break;
-case 1031: {
-p.push_back(1031);
-p.push_back(68);
-p.push_back(0);
-} break;
-case 1032: {
-p.push_back(1032);
-p.push_back(21);
-p.push_back(15);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1033: {
-p.push_back(1033);
-p.push_back(108);
-p.push_back(0);
-} break;
-case 1034: {
-p.push_back(1034);
-p.push_back(75);
-p.push_back(0);
-} break;
-case 1035: {
-p.push_back(1035);
-p.push_back(12);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1036: {
-p.push_back(1036);
-p.push_back(411);
-p.push_back(0);
-} break;
-case 1037: {
-p.push_back(1037);
-p.push_back(12);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1038: {
-p.push_back(1038);
-p.push_back(13);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1039: {
-p.push_back(1039);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 1040: {
-p.push_back(1040);
-p.push_back(15);
-p.push_back(10);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1041: {
-p.push_back(1041);
-p.push_back(412);
-p.push_back(0);
-} break;
-case 1042: {
-p.push_back(1042);
-p.push_back(439);
-p.push_back(0);
-} break;
-case 1043: {
-p.push_back(1043);
-p.push_back(10);
-p.push_back(7);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1044: {
-p.push_back(1044);
-p.push_back(41);
-p.push_back(0);
-} break;
-case 1045: {
-p.push_back(1045);
-p.push_back(13);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1046: {
-p.push_back(1046);
-p.push_back(8);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1047: {
-p.push_back(1047);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1048: {
-p.push_back(1048);
-p.push_back(15);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1049: {
-p.push_back(1049);
-p.push_back(141);
-p.push_back(0);
-} break;
-case 1050: {
-p.push_back(1050);
-p.push_back(159);
-p.push_back(0);
-} break;
-case 1051: {
-p.push_back(1051);
-p.push_back(13);
-p.push_back(12);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1052: {
-p.push_back(1052);
-p.push_back(291);
-p.push_back(0);
-} break;
-case 1053: {
-p.push_back(1053);
-p.push_back(10);
-p.push_back(9);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1054: {
-p.push_back(1054);
-p.push_back(105);
-p.push_back(0);
-} break;
-case 1055: {
-p.push_back(1055);
-p.push_back(24);
-p.push_back(0);
-} break;
-case 1056: {
-p.push_back(1056);
-p.push_back(11);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1057: {
-p.push_back(1057);
-p.push_back(198);
-p.push_back(0);
-} break;
-case 1058: {
-p.push_back(1058);
-p.push_back(27);
-p.push_back(0);
-} break;
-case 1059: {
-p.push_back(1059);
-p.push_back(6);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1060: {
-p.push_back(1060);
-p.push_back(439);
-p.push_back(0);
-} break;
-case 1061: {
-p.push_back(1061);
-p.push_back(10);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1062: {
-p.push_back(1062);
-p.push_back(49);
-p.push_back(0);
-} break;
-case 1063: {
-p.push_back(1063);
-p.push_back(168);
-p.push_back(0);
-} break;
-case 1064: {
-p.push_back(1064);
-p.push_back(13);
-p.push_back(11);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1065: {
-p.push_back(1065);
-p.push_back(463);
-p.push_back(0);
-} break;
-case 1066: {
-p.push_back(1066);
-p.push_back(10);
-p.push_back(9);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1067: {
-p.push_back(1067);
-p.push_back(13);
-p.push_back(9);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1068: {
-p.push_back(1068);
-p.push_back(15);
-p.push_back(8);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1069: {
-p.push_back(1069);
-p.push_back(18);
-p.push_back(16);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1070: {
-p.push_back(1070);
-p.push_back(15);
-p.push_back(14);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 1071: {
-p.push_back(1071);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1072: {
-p.push_back(1072);
-p.push_back(19);
-p.push_back(9);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1073: {
-p.push_back(1073);
-p.push_back(12);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1074: {
-p.push_back(1074);
-p.push_back(7);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1075: {
-p.push_back(1075);
-p.push_back(15);
-p.push_back(14);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1076: {
-p.push_back(1076);
-p.push_back(8);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1077: {
-p.push_back(1077);
-p.push_back(10);
-p.push_back(9);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1078: {
-p.push_back(1078);
-p.push_back(361);
-p.push_back(0);
-} break;
-case 1079: {
-p.push_back(1079);
-p.push_back(230);
-p.push_back(0);
-} break;
-case 1080: {
-p.push_back(1080);
-p.push_back(15);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1081: {
-p.push_back(1081);
-p.push_back(24);
-p.push_back(0);
-} break;
-case 1082: {
-p.push_back(1082);
-p.push_back(407);
-p.push_back(0);
-} break;
-case 1083: {
-p.push_back(1083);
-p.push_back(16);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1084: {
-p.push_back(1084);
-p.push_back(189);
-p.push_back(0);
-} break;
-case 1085: {
-p.push_back(1085);
-p.push_back(62);
-p.push_back(0);
-} break;
-case 1086: {
-p.push_back(1086);
-p.push_back(189);
-p.push_back(0);
-} break;
-case 1087: {
-p.push_back(1087);
-p.push_back(112);
-p.push_back(0);
-} break;
-case 1088: {
-p.push_back(1088);
-p.push_back(22);
-p.push_back(21);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1089: {
-p.push_back(1089);
-p.push_back(91);
-p.push_back(0);
-} break;
-case 1090: {
-p.push_back(1090);
-p.push_back(79);
-p.push_back(0);
-} break;
-case 1091: {
-p.push_back(1091);
-p.push_back(12);
-p.push_back(10);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1092: {
-p.push_back(1092);
-p.push_back(23);
-p.push_back(0);
-} break;
-case 1093: {
-p.push_back(1093);
-p.push_back(7);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1094: {
-p.push_back(1094);
-p.push_back(57);
-p.push_back(0);
-} break;
-case 1095: {
-p.push_back(1095);
-p.push_back(139);
-p.push_back(0);
-} break;
-case 1096: {
-p.push_back(1096);
-p.push_back(24);
-p.push_back(15);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1097: {
-p.push_back(1097);
-p.push_back(14);
-p.push_back(0);
-} break;
-case 1098: {
-p.push_back(1098);
-p.push_back(83);
-p.push_back(0);
-} break;
-case 1099: {
-p.push_back(1099);
-p.push_back(16);
-p.push_back(9);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1100: {
-p.push_back(1100);
-p.push_back(35);
-p.push_back(0);
-} break;
-case 1101: {
-p.push_back(1101);
-p.push_back(9);
-p.push_back(7);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1102: {
-p.push_back(1102);
-p.push_back(117);
-p.push_back(0);
-} break;
-case 1103: {
-p.push_back(1103);
-p.push_back(65);
-p.push_back(0);
-} break;
-case 1104: {
-p.push_back(1104);
-p.push_back(21);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1105: {
-p.push_back(1105);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 1106: {
-p.push_back(1106);
-p.push_back(195);
-p.push_back(0);
-} break;
-case 1107: {
-p.push_back(1107);
-p.push_back(23);
-p.push_back(11);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1108: {
-p.push_back(1108);
-p.push_back(327);
-p.push_back(0);
-} break;
-case 1109: {
-p.push_back(1109);
-p.push_back(17);
-p.push_back(14);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1110: {
-p.push_back(1110);
-p.push_back(417);
-p.push_back(0);
-} break;
-case 1111: {
-p.push_back(1111);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 1112: {
-p.push_back(1112);
-p.push_back(15);
-p.push_back(8);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1113: {
-p.push_back(1113);
-p.push_back(107);
-p.push_back(0);
-} break;
-case 1114: {
-p.push_back(1114);
-p.push_back(19);
-p.push_back(10);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1115: {
-p.push_back(1115);
-p.push_back(18);
-p.push_back(15);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1116: {
-p.push_back(1116);
-p.push_back(59);
-p.push_back(0);
-} break;
-case 1117: {
-p.push_back(1117);
-p.push_back(12);
-p.push_back(10);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1118: {
-p.push_back(1118);
-p.push_back(9);
-p.push_back(7);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1119: {
-p.push_back(1119);
-p.push_back(283);
-p.push_back(0);
-} break;
-case 1120: {
-p.push_back(1120);
-p.push_back(13);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1121: {
-p.push_back(1121);
-p.push_back(62);
-p.push_back(0);
-} break;
-case 1122: {
-p.push_back(1122);
-p.push_back(427);
-p.push_back(0);
-} break;
-case 1123: {
-p.push_back(1123);
-p.push_back(14);
-p.push_back(7);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1124: {
-p.push_back(1124);
-p.push_back(8);
-p.push_back(7);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1125: {
-p.push_back(1125);
-p.push_back(15);
-p.push_back(8);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1126: {
-p.push_back(1126);
-p.push_back(105);
-p.push_back(0);
-} break;
-case 1127: {
-p.push_back(1127);
-p.push_back(27);
-p.push_back(0);
-} break;
-case 1128: {
-p.push_back(1128);
-p.push_back(7);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1129: {
-p.push_back(1129);
-p.push_back(103);
-p.push_back(0);
-} break;
-case 1130: {
-p.push_back(1130);
-p.push_back(551);
-p.push_back(0);
-} break;
-case 1131: {
-p.push_back(1131);
-p.push_back(10);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1132: {
-p.push_back(1132);
-p.push_back(6);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1133: {
-p.push_back(1133);
-p.push_back(11);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1134: {
-p.push_back(1134);
-p.push_back(129);
-p.push_back(0);
-} break;
-case 1135: {
-p.push_back(1135);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1136: {
-p.push_back(1136);
-p.push_back(9);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1137: {
-p.push_back(1137);
-p.push_back(277);
-p.push_back(0);
-} break;
-case 1138: {
-p.push_back(1138);
-p.push_back(31);
-p.push_back(0);
-} break;
-case 1139: {
-p.push_back(1139);
-p.push_back(13);
-p.push_back(12);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1140: {
-p.push_back(1140);
-p.push_back(141);
-p.push_back(0);
-} break;
-case 1141: {
-p.push_back(1141);
-p.push_back(12);
-p.push_back(7);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1142: {
-p.push_back(1142);
-p.push_back(357);
-p.push_back(0);
-} break;
-case 1143: {
-p.push_back(1143);
-p.push_back(7);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1144: {
-p.push_back(1144);
-p.push_back(11);
-p.push_back(9);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1145: {
-p.push_back(1145);
-p.push_back(227);
-p.push_back(0);
-} break;
-case 1146: {
-p.push_back(1146);
-p.push_back(131);
-p.push_back(0);
-} break;
-case 1147: {
-p.push_back(1147);
-p.push_back(7);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1148: {
-p.push_back(1148);
-p.push_back(23);
-p.push_back(0);
-} break;
-case 1149: {
-p.push_back(1149);
-p.push_back(20);
-p.push_back(17);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1150: {
-p.push_back(1150);
-p.push_back(13);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1151: {
-p.push_back(1151);
-p.push_back(90);
-p.push_back(0);
-} break;
-case 1152: {
-p.push_back(1152);
-p.push_back(15);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1153: {
-p.push_back(1153);
-p.push_back(241);
-p.push_back(0);
-} break;
-case 1154: {
-p.push_back(1154);
-p.push_back(75);
-p.push_back(0);
-} break;
-case 1155: {
-p.push_back(1155);
-p.push_back(13);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1156: {
-p.push_back(1156);
-p.push_back(307);
-p.push_back(0);
-} break;
-case 1157: {
-p.push_back(1157);
-p.push_back(8);
-p.push_back(7);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1158: {
-p.push_back(1158);
-p.push_back(245);
-p.push_back(0);
-} break;
-case 1159: {
-p.push_back(1159);
-p.push_back(66);
-p.push_back(0);
-} break;
-case 1160: {
-p.push_back(1160);
-p.push_back(15);
-p.push_back(11);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1161: {
-p.push_back(1161);
-p.push_back(365);
-p.push_back(0);
-} break;
-case 1162: {
-p.push_back(1162);
-p.push_back(18);
-p.push_back(16);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 1163: {
-p.push_back(1163);
-p.push_back(11);
-p.push_back(10);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1164: {
-p.push_back(1164);
-p.push_back(19);
-p.push_back(0);
-} break;
-case 1165: {
-p.push_back(1165);
-p.push_back(8);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1166: {
-p.push_back(1166);
-p.push_back(189);
-p.push_back(0);
-} break;
-case 1167: {
-p.push_back(1167);
-p.push_back(133);
-p.push_back(0);
-} break;
-case 1168: {
-p.push_back(1168);
-p.push_back(12);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1169: {
-p.push_back(1169);
-p.push_back(114);
-p.push_back(0);
-} break;
-case 1170: {
-p.push_back(1170);
-p.push_back(27);
-p.push_back(0);
-} break;
-case 1171: {
-p.push_back(1171);
-p.push_back(6);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1172: {
-p.push_back(1172);
-p.push_back(15);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1173: {
-p.push_back(1173);
-p.push_back(17);
-p.push_back(14);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1174: {
-p.push_back(1174);
-p.push_back(133);
-p.push_back(0);
-} break;
-case 1175: {
-p.push_back(1175);
-p.push_back(476);
-p.push_back(0);
-} break;
-case 1176: {
-p.push_back(1176);
-p.push_back(11);
-p.push_back(9);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1177: {
-p.push_back(1177);
-p.push_back(16);
-p.push_back(0);
-} break;
-case 1178: {
-p.push_back(1178);
-p.push_back(375);
-p.push_back(0);
-} break;
-case 1179: {
-p.push_back(1179);
-p.push_back(15);
-p.push_back(8);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1180: {
-p.push_back(1180);
-p.push_back(25);
-p.push_back(0);
-} break;
-case 1181: {
-p.push_back(1181);
-p.push_back(17);
-p.push_back(11);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1182: {
-p.push_back(1182);
-p.push_back(77);
-p.push_back(0);
-} break;
-case 1183: {
-p.push_back(1183);
-p.push_back(87);
-p.push_back(0);
-} break;
-case 1184: {
-p.push_back(1184);
-p.push_back(5);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1185: {
-p.push_back(1185);
-p.push_back(134);
-p.push_back(0);
-} break;
-case 1186: {
-p.push_back(1186);
-p.push_back(171);
-p.push_back(0);
-} break;
-case 1187: {
-p.push_back(1187);
-p.push_back(13);
-p.push_back(8);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1188: {
-p.push_back(1188);
-p.push_back(75);
-p.push_back(0);
-} break;
-case 1189: {
-p.push_back(1189);
-p.push_back(8);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1190: {
-p.push_back(1190);
-p.push_back(233);
-p.push_back(0);
-} break;
-case 1191: {
-p.push_back(1191);
-p.push_back(196);
-p.push_back(0);
-} break;
-case 1192: {
-p.push_back(1192);
-p.push_back(9);
-p.push_back(8);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1193: {
-p.push_back(1193);
-p.push_back(173);
-p.push_back(0);
-} break;
-case 1194: {
-p.push_back(1194);
-p.push_back(15);
-p.push_back(14);
-p.push_back(12);
-p.push_back(0);
-} break;
-case 1195: {
-p.push_back(1195);
-p.push_back(13);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1196: {
-p.push_back(1196);
-p.push_back(281);
-p.push_back(0);
-} break;
-case 1197: {
-p.push_back(1197);
-p.push_back(9);
-p.push_back(8);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1198: {
-p.push_back(1198);
-p.push_back(405);
-p.push_back(0);
-} break;
-case 1199: {
-p.push_back(1199);
-p.push_back(114);
-p.push_back(0);
-} break;
-case 1200: {
-p.push_back(1200);
-p.push_back(15);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1201: {
-p.push_back(1201);
-p.push_back(171);
-p.push_back(0);
-} break;
-case 1202: {
-p.push_back(1202);
-p.push_back(287);
-p.push_back(0);
-} break;
-case 1203: {
-p.push_back(1203);
-p.push_back(8);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1204: {
-p.push_back(1204);
-p.push_back(43);
-p.push_back(0);
-} break;
-case 1205: {
-p.push_back(1205);
-p.push_back(4);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1206: {
-p.push_back(1206);
-p.push_back(513);
-p.push_back(0);
-} break;
-case 1207: {
-p.push_back(1207);
-p.push_back(273);
-p.push_back(0);
-} break;
-case 1208: {
-p.push_back(1208);
-p.push_back(11);
-p.push_back(10);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1209: {
-p.push_back(1209);
-p.push_back(118);
-p.push_back(0);
-} break;
-case 1210: {
-p.push_back(1210);
-p.push_back(243);
-p.push_back(0);
-} break;
-case 1211: {
-p.push_back(1211);
-p.push_back(14);
-p.push_back(7);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1212: {
-p.push_back(1212);
-p.push_back(203);
-p.push_back(0);
-} break;
-case 1213: {
-p.push_back(1213);
-p.push_back(9);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1214: {
-p.push_back(1214);
-p.push_back(257);
-p.push_back(0);
-} break;
-case 1215: {
-p.push_back(1215);
-p.push_back(302);
-p.push_back(0);
-} break;
-case 1216: {
-p.push_back(1216);
-p.push_back(27);
-p.push_back(25);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1217: {
-p.push_back(1217);
-p.push_back(393);
-p.push_back(0);
-} break;
-case 1218: {
-p.push_back(1218);
-p.push_back(91);
-p.push_back(0);
-} break;
-case 1219: {
-p.push_back(1219);
-p.push_back(12);
-p.push_back(10);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1220: {
-p.push_back(1220);
-p.push_back(413);
-p.push_back(0);
-} break;
-case 1221: {
-p.push_back(1221);
-p.push_back(15);
-p.push_back(14);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1222: {
-p.push_back(1222);
-p.push_back(18);
-p.push_back(16);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1223: {
-p.push_back(1223);
-p.push_back(255);
-p.push_back(0);
-} break;
-case 1224: {
-p.push_back(1224);
-p.push_back(12);
-p.push_back(9);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1225: {
-p.push_back(1225);
-p.push_back(234);
-p.push_back(0);
-} break;
-case 1226: {
-p.push_back(1226);
-p.push_back(167);
-p.push_back(0);
-} break;
-case 1227: {
-p.push_back(1227);
-p.push_back(16);
-p.push_back(13);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1228: {
-p.push_back(1228);
-p.push_back(27);
-p.push_back(0);
-} break;
-case 1229: {
-p.push_back(1229);
-p.push_back(15);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1230: {
-p.push_back(1230);
-p.push_back(433);
-p.push_back(0);
-} break;
-case 1231: {
-p.push_back(1231);
-p.push_back(105);
-p.push_back(0);
-} break;
-case 1232: {
-p.push_back(1232);
-p.push_back(25);
-p.push_back(10);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1233: {
-p.push_back(1233);
-p.push_back(151);
-p.push_back(0);
-} break;
-case 1234: {
-p.push_back(1234);
-p.push_back(427);
-p.push_back(0);
-} break;
-case 1235: {
-p.push_back(1235);
-p.push_back(13);
-p.push_back(9);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1236: {
-p.push_back(1236);
-p.push_back(49);
-p.push_back(0);
-} break;
-case 1237: {
-p.push_back(1237);
-p.push_back(10);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1238: {
-p.push_back(1238);
-p.push_back(153);
-p.push_back(0);
-} break;
-case 1239: {
-p.push_back(1239);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1240: {
-p.push_back(1240);
-p.push_back(17);
-p.push_back(7);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1241: {
-p.push_back(1241);
-p.push_back(54);
-p.push_back(0);
-} break;
-case 1242: {
-p.push_back(1242);
-p.push_back(203);
-p.push_back(0);
-} break;
-case 1243: {
-p.push_back(1243);
-p.push_back(16);
-p.push_back(15);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1244: {
-p.push_back(1244);
-p.push_back(16);
-p.push_back(14);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1245: {
-p.push_back(1245);
-p.push_back(13);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1246: {
-p.push_back(1246);
-p.push_back(25);
-p.push_back(0);
-} break;
-case 1247: {
-p.push_back(1247);
-p.push_back(14);
-p.push_back(0);
-} break;
-case 1248: {
-p.push_back(1248);
-p.push_back(15);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1249: {
-p.push_back(1249);
-p.push_back(187);
-p.push_back(0);
-} break;
-case 1250: {
-p.push_back(1250);
-p.push_back(15);
-p.push_back(13);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1251: {
-p.push_back(1251);
-p.push_back(13);
-p.push_back(10);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1252: {
-p.push_back(1252);
-p.push_back(97);
-p.push_back(0);
-} break;
-case 1253: {
-p.push_back(1253);
-p.push_back(11);
-p.push_back(10);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1254: {
-p.push_back(1254);
-p.push_back(19);
-p.push_back(10);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1255: {
-p.push_back(1255);
-p.push_back(589);
-p.push_back(0);
-} break;
-case 1256: {
-p.push_back(1256);
-p.push_back(31);
-p.push_back(30);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1257: {
-p.push_back(1257);
-p.push_back(289);
-p.push_back(0);
-} break;
-case 1258: {
-p.push_back(1258);
-p.push_back(9);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1259: {
-p.push_back(1259);
-p.push_back(11);
-p.push_back(8);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1260: {
-p.push_back(1260);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 1261: {
-p.push_back(1261);
-p.push_back(7);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1262: {
-p.push_back(1262);
-p.push_back(7);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1263: {
-p.push_back(1263);
-p.push_back(77);
-p.push_back(0);
-} break;
-case 1264: {
-p.push_back(1264);
-p.push_back(5);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1265: {
-p.push_back(1265);
-p.push_back(119);
-p.push_back(0);
-} break;
-case 1266: {
-p.push_back(1266);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1267: {
-p.push_back(1267);
-p.push_back(9);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1268: {
-p.push_back(1268);
-p.push_back(345);
-p.push_back(0);
-} break;
-case 1269: {
-p.push_back(1269);
-p.push_back(17);
-p.push_back(10);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1270: {
-p.push_back(1270);
-p.push_back(333);
-p.push_back(0);
-} break;
-case 1271: {
-p.push_back(1271);
-p.push_back(17);
-p.push_back(0);
-} break;
-case 1272: {
-p.push_back(1272);
-p.push_back(16);
-p.push_back(9);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1273: {
-p.push_back(1273);
-p.push_back(168);
-p.push_back(0);
-} break;
-case 1274: {
-p.push_back(1274);
-p.push_back(15);
-p.push_back(13);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1275: {
-p.push_back(1275);
-p.push_back(11);
-p.push_back(10);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1276: {
-p.push_back(1276);
-p.push_back(217);
-p.push_back(0);
-} break;
-case 1277: {
-p.push_back(1277);
-p.push_back(18);
-p.push_back(11);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1278: {
-p.push_back(1278);
-p.push_back(189);
-p.push_back(0);
-} break;
-case 1279: {
-p.push_back(1279);
-p.push_back(216);
-p.push_back(0);
-} break;
-case 1280: {
-p.push_back(1280);
-p.push_back(12);
-p.push_back(7);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1281: {
-p.push_back(1281);
-p.push_back(229);
-p.push_back(0);
-} break;
-case 1282: {
-p.push_back(1282);
-p.push_back(231);
-p.push_back(0);
-} break;
-case 1283: {
-p.push_back(1283);
-p.push_back(12);
-p.push_back(9);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1284: {
-p.push_back(1284);
-p.push_back(223);
-p.push_back(0);
-} break;
-case 1285: {
-p.push_back(1285);
-p.push_back(10);
-p.push_back(9);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1286: {
-p.push_back(1286);
-p.push_back(153);
-p.push_back(0);
-} break;
-case 1287: {
-p.push_back(1287);
-p.push_back(470);
-p.push_back(0);
-} break;
-case 1288: {
-p.push_back(1288);
-p.push_back(23);
-p.push_back(16);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1289: {
-p.push_back(1289);
-p.push_back(99);
-p.push_back(0);
-} break;
-case 1290: {
-p.push_back(1290);
-p.push_back(10);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1291: {
-p.push_back(1291);
-p.push_back(9);
-p.push_back(8);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1292: {
-p.push_back(1292);
-p.push_back(12);
-p.push_back(10);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1293: {
-p.push_back(1293);
-p.push_back(14);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1294: {
-p.push_back(1294);
-p.push_back(201);
-p.push_back(0);
-} break;
-case 1295: {
-p.push_back(1295);
-p.push_back(38);
-p.push_back(0);
-} break;
-case 1296: {
-p.push_back(1296);
-p.push_back(15);
-p.push_back(14);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1297: {
-p.push_back(1297);
-p.push_back(198);
-p.push_back(0);
-} break;
-case 1298: {
-p.push_back(1298);
-p.push_back(399);
-p.push_back(0);
-} break;
-case 1299: {
-p.push_back(1299);
-p.push_back(14);
-p.push_back(11);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1300: {
-p.push_back(1300);
-p.push_back(75);
-p.push_back(0);
-} break;
-case 1301: {
-p.push_back(1301);
-p.push_back(11);
-p.push_back(10);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1302: {
-p.push_back(1302);
-p.push_back(77);
-p.push_back(0);
-} break;
-case 1303: {
-p.push_back(1303);
-p.push_back(16);
-p.push_back(12);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1304: {
-p.push_back(1304);
-p.push_back(20);
-p.push_back(17);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 1305: {
-p.push_back(1305);
-p.push_back(326);
-p.push_back(0);
-} break;
-case 1306: {
-p.push_back(1306);
-p.push_back(39);
-p.push_back(0);
-} break;
-case 1307: {
-p.push_back(1307);
-p.push_back(14);
-p.push_back(12);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1308: {
-p.push_back(1308);
-p.push_back(495);
-p.push_back(0);
-} break;
-case 1309: {
-p.push_back(1309);
-p.push_back(8);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1310: {
-p.push_back(1310);
-p.push_back(333);
-p.push_back(0);
-} break;
-case 1311: {
-p.push_back(1311);
-p.push_back(476);
-p.push_back(0);
-} break;
-case 1312: {
-p.push_back(1312);
-p.push_back(15);
-p.push_back(14);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1313: {
-p.push_back(1313);
-p.push_back(164);
-p.push_back(0);
-} break;
-case 1314: {
-p.push_back(1314);
-p.push_back(19);
-p.push_back(0);
-} break;
-case 1315: {
-p.push_back(1315);
-p.push_back(12);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1316: {
-p.push_back(1316);
-p.push_back(8);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1317: {
-p.push_back(1317);
-p.push_back(13);
-p.push_back(12);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1318: {
-p.push_back(1318);
-p.push_back(12);
-p.push_back(11);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1319: {
-p.push_back(1319);
-p.push_back(129);
-p.push_back(0);
-} break;
-case 1320: {
-p.push_back(1320);
-p.push_back(12);
-p.push_back(9);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1321: {
-p.push_back(1321);
-p.push_back(52);
-p.push_back(0);
-} break;
-case 1322: {
-p.push_back(1322);
-p.push_back(10);
-p.push_back(8);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1323: {
-p.push_back(1323);
-p.push_back(17);
-p.push_back(16);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1324: {
-p.push_back(1324);
-p.push_back(337);
-p.push_back(0);
-} break;
-case 1325: {
-p.push_back(1325);
-p.push_back(12);
-p.push_back(9);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1326: {
-p.push_back(1326);
-p.push_back(397);
-p.push_back(0);
-} break;
-case 1327: {
-p.push_back(1327);
-p.push_back(277);
-p.push_back(0);
-} break;
-case 1328: {
-p.push_back(1328);
-p.push_back(21);
-p.push_back(11);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1329: {
-p.push_back(1329);
-p.push_back(73);
-p.push_back(0);
-} break;
-case 1330: {
-p.push_back(1330);
-p.push_back(11);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1331: {
-p.push_back(1331);
-p.push_back(7);
-p.push_back(5);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1332: {
-p.push_back(1332);
-p.push_back(95);
-p.push_back(0);
-} break;
-case 1333: {
-p.push_back(1333);
-p.push_back(11);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1334: {
-p.push_back(1334);
-p.push_back(617);
-p.push_back(0);
-} break;
-case 1335: {
-p.push_back(1335);
-p.push_back(392);
-p.push_back(0);
-} break;
-case 1336: {
-p.push_back(1336);
-p.push_back(8);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1337: {
-p.push_back(1337);
-p.push_back(75);
-p.push_back(0);
-} break;
-case 1338: {
-p.push_back(1338);
-p.push_back(315);
-p.push_back(0);
-} break;
-case 1339: {
-p.push_back(1339);
-p.push_back(15);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1340: {
-p.push_back(1340);
-p.push_back(125);
-p.push_back(0);
-} break;
-case 1341: {
-p.push_back(1341);
-p.push_back(6);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1342: {
-p.push_back(1342);
-p.push_back(15);
-p.push_back(9);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1343: {
-p.push_back(1343);
-p.push_back(348);
-p.push_back(0);
-} break;
-case 1344: {
-p.push_back(1344);
-p.push_back(15);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1345: {
-p.push_back(1345);
-p.push_back(553);
-p.push_back(0);
-} break;
-case 1346: {
-p.push_back(1346);
-p.push_back(6);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1347: {
-p.push_back(1347);
-p.push_back(10);
-p.push_back(9);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1348: {
-p.push_back(1348);
-p.push_back(553);
-p.push_back(0);
-} break;
-case 1349: {
-p.push_back(1349);
-p.push_back(14);
-p.push_back(10);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1350: {
-p.push_back(1350);
-p.push_back(237);
-p.push_back(0);
-} break;
-case 1351: {
-p.push_back(1351);
-p.push_back(39);
-p.push_back(0);
-} break;
-case 1352: {
-p.push_back(1352);
-p.push_back(17);
-p.push_back(14);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1353: {
-p.push_back(1353);
-p.push_back(371);
-p.push_back(0);
-} break;
-case 1354: {
-p.push_back(1354);
-p.push_back(255);
-p.push_back(0);
-} break;
-case 1355: {
-p.push_back(1355);
-p.push_back(8);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1356: {
-p.push_back(1356);
-p.push_back(131);
-p.push_back(0);
-} break;
-case 1357: {
-p.push_back(1357);
-p.push_back(14);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1358: {
-p.push_back(1358);
-p.push_back(117);
-p.push_back(0);
-} break;
-case 1359: {
-p.push_back(1359);
-p.push_back(98);
-p.push_back(0);
-} break;
-case 1360: {
-p.push_back(1360);
-p.push_back(5);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1361: {
-p.push_back(1361);
-p.push_back(56);
-p.push_back(0);
-} break;
-case 1362: {
-p.push_back(1362);
-p.push_back(655);
-p.push_back(0);
-} break;
-case 1363: {
-p.push_back(1363);
-p.push_back(9);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1364: {
-p.push_back(1364);
-p.push_back(239);
-p.push_back(0);
-} break;
-case 1365: {
-p.push_back(1365);
-p.push_back(11);
-p.push_back(8);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1366: {
-p.push_back(1366);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1367: {
-p.push_back(1367);
-p.push_back(134);
-p.push_back(0);
-} break;
-case 1368: {
-p.push_back(1368);
-p.push_back(15);
-p.push_back(9);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1369: {
-p.push_back(1369);
-p.push_back(88);
-p.push_back(0);
-} break;
-case 1370: {
-p.push_back(1370);
-p.push_back(10);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1371: {
-p.push_back(1371);
-p.push_back(10);
-p.push_back(9);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1372: {
-p.push_back(1372);
-p.push_back(181);
-p.push_back(0);
-} break;
-case 1373: {
-p.push_back(1373);
-p.push_back(15);
-p.push_back(11);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1374: {
-p.push_back(1374);
-p.push_back(609);
-p.push_back(0);
-} break;
-case 1375: {
-p.push_back(1375);
-p.push_back(52);
-p.push_back(0);
-} break;
-case 1376: {
-p.push_back(1376);
-p.push_back(19);
-p.push_back(18);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1377: {
-p.push_back(1377);
-p.push_back(100);
-p.push_back(0);
-} break;
-case 1378: {
-p.push_back(1378);
-p.push_back(7);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1379: {
-p.push_back(1379);
-p.push_back(15);
-p.push_back(8);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1380: {
-p.push_back(1380);
-p.push_back(183);
-p.push_back(0);
-} break;
-case 1381: {
-p.push_back(1381);
-p.push_back(18);
-p.push_back(7);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1382: {
-p.push_back(1382);
-p.push_back(10);
-p.push_back(9);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1383: {
-p.push_back(1383);
-p.push_back(130);
-p.push_back(0);
-} break;
-case 1384: {
-p.push_back(1384);
-p.push_back(11);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1385: {
-p.push_back(1385);
-p.push_back(12);
-p.push_back(0);
-} break;
-case 1386: {
-p.push_back(1386);
-p.push_back(219);
-p.push_back(0);
-} break;
-case 1387: {
-p.push_back(1387);
-p.push_back(13);
-p.push_back(10);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1388: {
-p.push_back(1388);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 1389: {
-p.push_back(1389);
-p.push_back(19);
-p.push_back(9);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1390: {
-p.push_back(1390);
-p.push_back(129);
-p.push_back(0);
-} break;
-case 1391: {
-p.push_back(1391);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1392: {
-p.push_back(1392);
-p.push_back(17);
-p.push_back(15);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1393: {
-p.push_back(1393);
-p.push_back(300);
-p.push_back(0);
-} break;
-case 1394: {
-p.push_back(1394);
-p.push_back(17);
-p.push_back(13);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1395: {
-p.push_back(1395);
-p.push_back(14);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1396: {
-p.push_back(1396);
-p.push_back(97);
-p.push_back(0);
-} break;
-case 1397: {
-p.push_back(1397);
-p.push_back(13);
-p.push_back(8);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1398: {
-p.push_back(1398);
-p.push_back(601);
-p.push_back(0);
-} break;
-case 1399: {
-p.push_back(1399);
-p.push_back(55);
-p.push_back(0);
-} break;
-case 1400: {
-p.push_back(1400);
-p.push_back(8);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1401: {
-p.push_back(1401);
-p.push_back(92);
-p.push_back(0);
-} break;
-case 1402: {
-p.push_back(1402);
-p.push_back(127);
-p.push_back(0);
-} break;
-case 1403: {
-p.push_back(1403);
-p.push_back(12);
-p.push_back(11);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1404: {
-p.push_back(1404);
-p.push_back(81);
-p.push_back(0);
-} break;
-case 1405: {
-p.push_back(1405);
-p.push_back(15);
-p.push_back(10);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1406: {
-p.push_back(1406);
-p.push_back(13);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1407: {
-p.push_back(1407);
-p.push_back(47);
-p.push_back(0);
-} break;
-case 1408: {
-p.push_back(1408);
-p.push_back(14);
-p.push_back(13);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1409: {
-p.push_back(1409);
-p.push_back(194);
-p.push_back(0);
-} break;
-case 1410: {
-p.push_back(1410);
-p.push_back(383);
-p.push_back(0);
-} break;
-case 1411: {
-p.push_back(1411);
-p.push_back(25);
-p.push_back(14);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 1412: {
-p.push_back(1412);
-p.push_back(125);
-p.push_back(0);
-} break;
-case 1413: {
-p.push_back(1413);
-p.push_back(20);
-p.push_back(19);
-p.push_back(16);
-p.push_back(0);
-} break;
-case 1414: {
-p.push_back(1414);
-p.push_back(429);
-p.push_back(0);
-} break;
-case 1415: {
-p.push_back(1415);
-p.push_back(282);
-p.push_back(0);
-} break;
-case 1416: {
-p.push_back(1416);
-p.push_back(10);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1417: {
-p.push_back(1417);
-p.push_back(342);
-p.push_back(0);
-} break;
-case 1418: {
-p.push_back(1418);
-p.push_back(5);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1419: {
-p.push_back(1419);
-p.push_back(15);
-p.push_back(9);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1420: {
-p.push_back(1420);
-p.push_back(33);
-p.push_back(0);
-} break;
-case 1421: {
-p.push_back(1421);
-p.push_back(9);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1422: {
-p.push_back(1422);
-p.push_back(49);
-p.push_back(0);
-} break;
-case 1423: {
-p.push_back(1423);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 1424: {
-p.push_back(1424);
-p.push_back(11);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1425: {
-p.push_back(1425);
-p.push_back(28);
-p.push_back(0);
-} break;
-case 1426: {
-p.push_back(1426);
-p.push_back(103);
-p.push_back(0);
-} break;
-case 1427: {
-p.push_back(1427);
-p.push_back(18);
-p.push_back(17);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1428: {
-p.push_back(1428);
-p.push_back(27);
-p.push_back(0);
-} break;
-case 1429: {
-p.push_back(1429);
-p.push_back(11);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1430: {
-p.push_back(1430);
-p.push_back(33);
-p.push_back(0);
-} break;
-case 1431: {
-p.push_back(1431);
-p.push_back(17);
-p.push_back(0);
-} break;
-case 1432: {
-p.push_back(1432);
-p.push_back(11);
-p.push_back(10);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1433: {
-p.push_back(1433);
-p.push_back(387);
-p.push_back(0);
-} break;
-case 1434: {
-p.push_back(1434);
-p.push_back(363);
-p.push_back(0);
-} break;
-case 1435: {
-p.push_back(1435);
-p.push_back(15);
-p.push_back(10);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1436: {
-p.push_back(1436);
-p.push_back(83);
-p.push_back(0);
-} break;
-case 1437: {
-p.push_back(1437);
-p.push_back(7);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1438: {
-p.push_back(1438);
-p.push_back(357);
-p.push_back(0);
-} break;
-case 1439: {
-p.push_back(1439);
-p.push_back(13);
-p.push_back(12);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1440: {
-p.push_back(1440);
-p.push_back(14);
-p.push_back(13);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1441: {
-p.push_back(1441);
-p.push_back(322);
-p.push_back(0);
-} break;
-case 1442: {
-p.push_back(1442);
-p.push_back(395);
-p.push_back(0);
-} break;
-case 1443: {
-p.push_back(1443);
-p.push_back(16);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1444: {
-p.push_back(1444);
-p.push_back(595);
-p.push_back(0);
-} break;
-case 1445: {
-p.push_back(1445);
-p.push_back(13);
-p.push_back(10);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1446: {
-p.push_back(1446);
-p.push_back(421);
-p.push_back(0);
-} break;
-case 1447: {
-p.push_back(1447);
-p.push_back(195);
-p.push_back(0);
-} break;
-case 1448: {
-p.push_back(1448);
-p.push_back(11);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1449: {
-p.push_back(1449);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 1450: {
-p.push_back(1450);
-p.push_back(16);
-p.push_back(12);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1451: {
-p.push_back(1451);
-p.push_back(14);
-p.push_back(3);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1452: {
-p.push_back(1452);
-p.push_back(315);
-p.push_back(0);
-} break;
-case 1453: {
-p.push_back(1453);
-p.push_back(26);
-p.push_back(10);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1454: {
-p.push_back(1454);
-p.push_back(297);
-p.push_back(0);
-} break;
-case 1455: {
-p.push_back(1455);
-p.push_back(52);
-p.push_back(0);
-} break;
-case 1456: {
-p.push_back(1456);
-p.push_back(9);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1457: {
-p.push_back(1457);
-p.push_back(314);
-p.push_back(0);
-} break;
-case 1458: {
-p.push_back(1458);
-p.push_back(243);
-p.push_back(0);
-} break;
-case 1459: {
-p.push_back(1459);
-p.push_back(16);
-p.push_back(14);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1460: {
-p.push_back(1460);
-p.push_back(185);
-p.push_back(0);
-} break;
-case 1461: {
-p.push_back(1461);
-p.push_back(12);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1462: {
-p.push_back(1462);
-p.push_back(13);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1463: {
-p.push_back(1463);
-p.push_back(575);
-p.push_back(0);
-} break;
-case 1464: {
-p.push_back(1464);
-p.push_back(12);
-p.push_back(9);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1465: {
-p.push_back(1465);
-p.push_back(39);
-p.push_back(0);
-} break;
-case 1466: {
-p.push_back(1466);
-p.push_back(311);
-p.push_back(0);
-} break;
-case 1467: {
-p.push_back(1467);
-p.push_back(13);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1468: {
-p.push_back(1468);
-p.push_back(181);
-p.push_back(0);
-} break;
-case 1469: {
-p.push_back(1469);
-p.push_back(20);
-p.push_back(18);
-p.push_back(14);
-p.push_back(0);
-} break;
-case 1470: {
-p.push_back(1470);
-p.push_back(49);
-p.push_back(0);
-} break;
-case 1471: {
-p.push_back(1471);
-p.push_back(25);
-p.push_back(0);
-} break;
-case 1472: {
-p.push_back(1472);
-p.push_back(11);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1473: {
-p.push_back(1473);
-p.push_back(77);
-p.push_back(0);
-} break;
-case 1474: {
-p.push_back(1474);
-p.push_back(17);
-p.push_back(11);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1475: {
-p.push_back(1475);
-p.push_back(15);
-p.push_back(14);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1476: {
-p.push_back(1476);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 1477: {
-p.push_back(1477);
-p.push_back(17);
-p.push_back(10);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1478: {
-p.push_back(1478);
-p.push_back(69);
-p.push_back(0);
-} break;
-case 1479: {
-p.push_back(1479);
-p.push_back(49);
-p.push_back(0);
-} break;
-case 1480: {
-p.push_back(1480);
-p.push_back(11);
-p.push_back(10);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1481: {
-p.push_back(1481);
-p.push_back(32);
-p.push_back(0);
-} break;
-case 1482: {
-p.push_back(1482);
-p.push_back(411);
-p.push_back(0);
-} break;
-case 1483: {
-p.push_back(1483);
-p.push_back(21);
-p.push_back(16);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1484: {
-p.push_back(1484);
-p.push_back(11);
-p.push_back(7);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1485: {
-p.push_back(1485);
-p.push_back(22);
-p.push_back(10);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1486: {
-p.push_back(1486);
-p.push_back(85);
-p.push_back(0);
-} break;
-case 1487: {
-p.push_back(1487);
-p.push_back(140);
-p.push_back(0);
-} break;
-case 1488: {
-p.push_back(1488);
-p.push_back(9);
-p.push_back(8);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1489: {
-p.push_back(1489);
-p.push_back(252);
-p.push_back(0);
-} break;
-case 1490: {
-p.push_back(1490);
-p.push_back(279);
-p.push_back(0);
-} break;
-case 1491: {
-p.push_back(1491);
-p.push_back(9);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1492: {
-p.push_back(1492);
-p.push_back(307);
-p.push_back(0);
-} break;
-case 1493: {
-p.push_back(1493);
-p.push_back(17);
-p.push_back(10);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1494: {
-p.push_back(1494);
-p.push_back(13);
-p.push_back(12);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1495: {
-p.push_back(1495);
-p.push_back(94);
-p.push_back(0);
-} break;
-case 1496: {
-p.push_back(1496);
-p.push_back(13);
-p.push_back(11);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1497: {
-p.push_back(1497);
-p.push_back(49);
-p.push_back(0);
-} break;
-case 1498: {
-p.push_back(1498);
-p.push_back(17);
-p.push_back(11);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1499: {
-p.push_back(1499);
-p.push_back(16);
-p.push_back(12);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1500: {
-p.push_back(1500);
-p.push_back(25);
-p.push_back(0);
-} break;
-case 1501: {
-p.push_back(1501);
-p.push_back(6);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1502: {
-p.push_back(1502);
-p.push_back(12);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1503: {
-p.push_back(1503);
-p.push_back(80);
-p.push_back(0);
-} break;
-case 1504: {
-p.push_back(1504);
-p.push_back(8);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1505: {
-p.push_back(1505);
-p.push_back(246);
-p.push_back(0);
-} break;
-case 1506: {
-p.push_back(1506);
-p.push_back(11);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1507: {
-p.push_back(1507);
-p.push_back(11);
-p.push_back(10);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1508: {
-p.push_back(1508);
-p.push_back(599);
-p.push_back(0);
-} break;
-case 1509: {
-p.push_back(1509);
-p.push_back(18);
-p.push_back(12);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1510: {
-p.push_back(1510);
-p.push_back(189);
-p.push_back(0);
-} break;
-case 1511: {
-p.push_back(1511);
-p.push_back(278);
-p.push_back(0);
-} break;
-case 1512: {
-p.push_back(1512);
-p.push_back(10);
-p.push_back(9);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1513: {
-p.push_back(1513);
-p.push_back(399);
-p.push_back(0);
-} break;
-case 1514: {
-p.push_back(1514);
-p.push_back(299);
-p.push_back(0);
-} break;
-case 1515: {
-p.push_back(1515);
-p.push_back(13);
-p.push_back(10);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1516: {
-p.push_back(1516);
-p.push_back(277);
-p.push_back(0);
-} break;
-case 1517: {
-p.push_back(1517);
-p.push_back(13);
-p.push_back(10);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1518: {
-p.push_back(1518);
-p.push_back(69);
-p.push_back(0);
-} break;
-case 1519: {
-p.push_back(1519);
-p.push_back(220);
-p.push_back(0);
-} break;
-case 1520: {
-p.push_back(1520);
-p.push_back(13);
-p.push_back(10);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1521: {
-p.push_back(1521);
-p.push_back(229);
-p.push_back(0);
-} break;
-case 1522: {
-p.push_back(1522);
-p.push_back(18);
-p.push_back(11);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1523: {
-p.push_back(1523);
-p.push_back(16);
-p.push_back(15);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1524: {
-p.push_back(1524);
-p.push_back(27);
-p.push_back(0);
-} break;
-case 1525: {
-p.push_back(1525);
-p.push_back(18);
-p.push_back(9);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1526: {
-p.push_back(1526);
-p.push_back(473);
-p.push_back(0);
-} break;
-case 1527: {
-p.push_back(1527);
-p.push_back(373);
-p.push_back(0);
-} break;
-case 1528: {
-p.push_back(1528);
-p.push_back(18);
-p.push_back(17);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1529: {
-p.push_back(1529);
-p.push_back(60);
-p.push_back(0);
-} break;
-case 1530: {
-p.push_back(1530);
-p.push_back(207);
-p.push_back(0);
-} break;
-case 1531: {
-p.push_back(1531);
-p.push_back(13);
-p.push_back(9);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1532: {
-p.push_back(1532);
-p.push_back(22);
-p.push_back(20);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 1533: {
-p.push_back(1533);
-p.push_back(25);
-p.push_back(18);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1534: {
-p.push_back(1534);
-p.push_back(225);
-p.push_back(0);
-} break;
-case 1535: {
-p.push_back(1535);
-p.push_back(404);
-p.push_back(0);
-} break;
-case 1536: {
-p.push_back(1536);
-p.push_back(21);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1537: {
-p.push_back(1537);
-p.push_back(46);
-p.push_back(0);
-} break;
-case 1538: {
-p.push_back(1538);
-p.push_back(6);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1539: {
-p.push_back(1539);
-p.push_back(17);
-p.push_back(12);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1540: {
-p.push_back(1540);
-p.push_back(75);
-p.push_back(0);
-} break;
-case 1541: {
-p.push_back(1541);
-p.push_back(4);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1542: {
-p.push_back(1542);
-p.push_back(365);
-p.push_back(0);
-} break;
-case 1543: {
-p.push_back(1543);
-p.push_back(445);
-p.push_back(0);
-} break;
-case 1544: {
-p.push_back(1544);
-p.push_back(11);
-p.push_back(7);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1545: {
-p.push_back(1545);
-p.push_back(44);
-p.push_back(0);
-} break;
-case 1546: {
-p.push_back(1546);
-p.push_back(10);
-p.push_back(8);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1547: {
-p.push_back(1547);
-p.push_back(12);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1548: {
-p.push_back(1548);
-p.push_back(63);
-p.push_back(0);
-} break;
-case 1549: {
-p.push_back(1549);
-p.push_back(17);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1550: {
-p.push_back(1550);
-p.push_back(189);
-p.push_back(0);
-} break;
-case 1551: {
-p.push_back(1551);
-p.push_back(557);
-p.push_back(0);
-} break;
-case 1552: {
-p.push_back(1552);
-p.push_back(19);
-p.push_back(12);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1553: {
-p.push_back(1553);
-p.push_back(252);
-p.push_back(0);
-} break;
-case 1554: {
-p.push_back(1554);
-p.push_back(99);
-p.push_back(0);
-} break;
-case 1555: {
-p.push_back(1555);
-p.push_back(10);
-p.push_back(8);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1556: {
-p.push_back(1556);
-p.push_back(65);
-p.push_back(0);
-} break;
-case 1557: {
-p.push_back(1557);
-p.push_back(14);
-p.push_back(9);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1558: {
-p.push_back(1558);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1559: {
-p.push_back(1559);
-p.push_back(119);
-p.push_back(0);
-} break;
-case 1560: {
-p.push_back(1560);
-p.push_back(8);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1561: {
-p.push_back(1561);
-p.push_back(339);
-p.push_back(0);
-} break;
-case 1562: {
-p.push_back(1562);
-p.push_back(95);
-p.push_back(0);
-} break;
-case 1563: {
-p.push_back(1563);
-p.push_back(12);
-p.push_back(9);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1564: {
-p.push_back(1564);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1565: {
-p.push_back(1565);
-p.push_back(13);
-p.push_back(10);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1566: {
-p.push_back(1566);
-p.push_back(77);
-p.push_back(0);
-} break;
-case 1567: {
-p.push_back(1567);
-p.push_back(127);
-p.push_back(0);
-} break;
-case 1568: {
-p.push_back(1568);
-p.push_back(21);
-p.push_back(10);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1569: {
-p.push_back(1569);
-p.push_back(319);
-p.push_back(0);
-} break;
-case 1570: {
-p.push_back(1570);
-p.push_back(667);
-p.push_back(0);
-} break;
-case 1571: {
-p.push_back(1571);
-p.push_back(17);
-p.push_back(10);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1572: {
-p.push_back(1572);
-p.push_back(501);
-p.push_back(0);
-} break;
-case 1573: {
-p.push_back(1573);
-p.push_back(18);
-p.push_back(12);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1574: {
-p.push_back(1574);
-p.push_back(9);
-p.push_back(8);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1575: {
-p.push_back(1575);
-p.push_back(17);
-p.push_back(0);
-} break;
-case 1576: {
-p.push_back(1576);
-p.push_back(20);
-p.push_back(9);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1577: {
-p.push_back(1577);
-p.push_back(341);
-p.push_back(0);
-} break;
-case 1578: {
-p.push_back(1578);
-p.push_back(731);
-p.push_back(0);
-} break;
-case 1579: {
-p.push_back(1579);
-p.push_back(7);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1580: {
-p.push_back(1580);
-p.push_back(647);
-p.push_back(0);
-} break;
-case 1581: {
-p.push_back(1581);
-p.push_back(10);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1582: {
-p.push_back(1582);
-p.push_back(121);
-p.push_back(0);
-} break;
-case 1583: {
-p.push_back(1583);
-p.push_back(20);
-p.push_back(0);
-} break;
-case 1584: {
-p.push_back(1584);
-p.push_back(21);
-p.push_back(19);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 1585: {
-p.push_back(1585);
-p.push_back(574);
-p.push_back(0);
-} break;
-case 1586: {
-p.push_back(1586);
-p.push_back(399);
-p.push_back(0);
-} break;
-case 1587: {
-p.push_back(1587);
-p.push_back(15);
-p.push_back(10);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1588: {
-p.push_back(1588);
-p.push_back(85);
-p.push_back(0);
-} break;
-case 1589: {
-p.push_back(1589);
-p.push_back(16);
-p.push_back(8);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1590: {
-p.push_back(1590);
-p.push_back(169);
-p.push_back(0);
-} break;
-case 1591: {
-p.push_back(1591);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 1592: {
-p.push_back(1592);
-p.push_back(12);
-p.push_back(7);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1593: {
-p.push_back(1593);
-p.push_back(568);
-p.push_back(0);
-} break;
-case 1594: {
-p.push_back(1594);
-p.push_back(10);
-p.push_back(7);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1595: {
-p.push_back(1595);
-p.push_back(18);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1596: {
-p.push_back(1596);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1597: {
-p.push_back(1597);
-p.push_back(14);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1598: {
-p.push_back(1598);
-p.push_back(13);
-p.push_back(7);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1599: {
-p.push_back(1599);
-p.push_back(643);
-p.push_back(0);
-} break;
-case 1600: {
-p.push_back(1600);
-p.push_back(14);
-p.push_back(11);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1601: {
-p.push_back(1601);
-p.push_back(548);
-p.push_back(0);
-} break;
-case 1602: {
-p.push_back(1602);
-p.push_back(783);
-p.push_back(0);
-} break;
-case 1603: {
-p.push_back(1603);
-p.push_back(14);
-p.push_back(11);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1604: {
-p.push_back(1604);
-p.push_back(317);
-p.push_back(0);
-} break;
-case 1605: {
-p.push_back(1605);
-p.push_back(7);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1606: {
-p.push_back(1606);
-p.push_back(153);
-p.push_back(0);
-} break;
-case 1607: {
-p.push_back(1607);
-p.push_back(87);
-p.push_back(0);
-} break;
-case 1608: {
-p.push_back(1608);
-p.push_back(15);
-p.push_back(13);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1609: {
-p.push_back(1609);
-p.push_back(231);
-p.push_back(0);
-} break;
-case 1610: {
-p.push_back(1610);
-p.push_back(11);
-p.push_back(5);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1611: {
-p.push_back(1611);
-p.push_back(18);
-p.push_back(13);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1612: {
-p.push_back(1612);
-p.push_back(771);
-p.push_back(0);
-} break;
-case 1613: {
-p.push_back(1613);
-p.push_back(30);
-p.push_back(20);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 1614: {
-p.push_back(1614);
-p.push_back(15);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1615: {
-p.push_back(1615);
-p.push_back(103);
-p.push_back(0);
-} break;
-case 1616: {
-p.push_back(1616);
-p.push_back(13);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1617: {
-p.push_back(1617);
-p.push_back(182);
-p.push_back(0);
-} break;
-case 1618: {
-p.push_back(1618);
-p.push_back(211);
-p.push_back(0);
-} break;
-case 1619: {
-p.push_back(1619);
-p.push_back(17);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1620: {
-p.push_back(1620);
-p.push_back(27);
-p.push_back(0);
-} break;
-case 1621: {
-p.push_back(1621);
-p.push_back(13);
-p.push_back(12);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1622: {
-p.push_back(1622);
-p.push_back(15);
-p.push_back(14);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1623: {
-p.push_back(1623);
-p.push_back(17);
-p.push_back(0);
-} break;
-case 1624: {
-p.push_back(1624);
-p.push_back(13);
-p.push_back(11);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1625: {
-p.push_back(1625);
-p.push_back(69);
-p.push_back(0);
-} break;
-case 1626: {
-p.push_back(1626);
-p.push_back(11);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1627: {
-p.push_back(1627);
-p.push_back(18);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1628: {
-p.push_back(1628);
-p.push_back(603);
-p.push_back(0);
-} break;
-case 1629: {
-p.push_back(1629);
-p.push_back(10);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1630: {
-p.push_back(1630);
-p.push_back(741);
-p.push_back(0);
-} break;
-case 1631: {
-p.push_back(1631);
-p.push_back(668);
-p.push_back(0);
-} break;
-case 1632: {
-p.push_back(1632);
-p.push_back(17);
-p.push_back(15);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1633: {
-p.push_back(1633);
-p.push_back(147);
-p.push_back(0);
-} break;
-case 1634: {
-p.push_back(1634);
-p.push_back(227);
-p.push_back(0);
-} break;
-case 1635: {
-p.push_back(1635);
-p.push_back(15);
-p.push_back(10);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1636: {
-p.push_back(1636);
-p.push_back(37);
-p.push_back(0);
-} break;
-case 1637: {
-p.push_back(1637);
-p.push_back(16);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1638: {
-p.push_back(1638);
-p.push_back(173);
-p.push_back(0);
-} break;
-case 1639: {
-p.push_back(1639);
-p.push_back(427);
-p.push_back(0);
-} break;
-case 1640: {
-p.push_back(1640);
-p.push_back(7);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1641: {
-p.push_back(1641);
-p.push_back(287);
-p.push_back(0);
-} break;
-case 1642: {
-p.push_back(1642);
-p.push_back(231);
-p.push_back(0);
-} break;
-case 1643: {
-p.push_back(1643);
-p.push_back(20);
-p.push_back(15);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1644: {
-p.push_back(1644);
-p.push_back(18);
-p.push_back(9);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1645: {
-p.push_back(1645);
-p.push_back(14);
-p.push_back(12);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1646: {
-p.push_back(1646);
-p.push_back(16);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1647: {
-p.push_back(1647);
-p.push_back(310);
-p.push_back(0);
-} break;
-case 1648: {
-p.push_back(1648);
-p.push_back(18);
-p.push_back(13);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1649: {
-p.push_back(1649);
-p.push_back(434);
-p.push_back(0);
-} break;
-case 1650: {
-p.push_back(1650);
-p.push_back(579);
-p.push_back(0);
-} break;
-case 1651: {
-p.push_back(1651);
-p.push_back(18);
-p.push_back(13);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1652: {
-p.push_back(1652);
-p.push_back(45);
-p.push_back(0);
-} break;
-case 1653: {
-p.push_back(1653);
-p.push_back(12);
-p.push_back(8);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1654: {
-p.push_back(1654);
-p.push_back(16);
-p.push_back(9);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1655: {
-p.push_back(1655);
-p.push_back(53);
-p.push_back(0);
-} break;
-case 1656: {
-p.push_back(1656);
-p.push_back(19);
-p.push_back(15);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1657: {
-p.push_back(1657);
-p.push_back(16);
-p.push_back(0);
-} break;
-case 1658: {
-p.push_back(1658);
-p.push_back(17);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1659: {
-p.push_back(1659);
-p.push_back(17);
-p.push_back(10);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1660: {
-p.push_back(1660);
-p.push_back(37);
-p.push_back(0);
-} break;
-case 1661: {
-p.push_back(1661);
-p.push_back(17);
-p.push_back(10);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1662: {
-p.push_back(1662);
-p.push_back(21);
-p.push_back(13);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1663: {
-p.push_back(1663);
-p.push_back(99);
-p.push_back(0);
-} break;
-case 1664: {
-p.push_back(1664);
-p.push_back(17);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1665: {
-p.push_back(1665);
-p.push_back(176);
-p.push_back(0);
-} break;
-case 1666: {
-p.push_back(1666);
-p.push_back(271);
-p.push_back(0);
-} break;
-case 1667: {
-p.push_back(1667);
-p.push_back(18);
-p.push_back(17);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 1668: {
-p.push_back(1668);
-p.push_back(459);
-p.push_back(0);
-} break;
-case 1669: {
-p.push_back(1669);
-p.push_back(21);
-p.push_back(17);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1670: {
-p.push_back(1670);
-p.push_back(6);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1671: {
-p.push_back(1671);
-p.push_back(202);
-p.push_back(0);
-} break;
-case 1672: {
-p.push_back(1672);
-p.push_back(5);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1673: {
-p.push_back(1673);
-p.push_back(90);
-p.push_back(0);
-} break;
-case 1674: {
-p.push_back(1674);
-p.push_back(755);
-p.push_back(0);
-} break;
-case 1675: {
-p.push_back(1675);
-p.push_back(15);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1676: {
-p.push_back(1676);
-p.push_back(363);
-p.push_back(0);
-} break;
-case 1677: {
-p.push_back(1677);
-p.push_back(8);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1678: {
-p.push_back(1678);
-p.push_back(129);
-p.push_back(0);
-} break;
-case 1679: {
-p.push_back(1679);
-p.push_back(20);
-p.push_back(0);
-} break;
-case 1680: {
-p.push_back(1680);
-p.push_back(11);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1681: {
-p.push_back(1681);
-p.push_back(135);
-p.push_back(0);
-} break;
-case 1682: {
-p.push_back(1682);
-p.push_back(15);
-p.push_back(8);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1683: {
-p.push_back(1683);
-p.push_back(14);
-p.push_back(13);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1684: {
-p.push_back(1684);
-p.push_back(10);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1685: {
-p.push_back(1685);
-p.push_back(24);
-p.push_back(13);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1686: {
-p.push_back(1686);
-p.push_back(19);
-p.push_back(14);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 1687: {
-p.push_back(1687);
-p.push_back(31);
-p.push_back(0);
-} break;
-case 1688: {
-p.push_back(1688);
-p.push_back(15);
-p.push_back(8);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1689: {
-p.push_back(1689);
-p.push_back(758);
-p.push_back(0);
-} break;
-case 1690: {
-p.push_back(1690);
-p.push_back(16);
-p.push_back(11);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1691: {
-p.push_back(1691);
-p.push_back(16);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1692: {
-p.push_back(1692);
-p.push_back(359);
-p.push_back(0);
-} break;
-case 1693: {
-p.push_back(1693);
-p.push_back(23);
-p.push_back(18);
-p.push_back(17);
-p.push_back(0);
-} break;
-case 1694: {
-p.push_back(1694);
-p.push_back(501);
-p.push_back(0);
-} break;
-case 1695: {
-p.push_back(1695);
-p.push_back(29);
-p.push_back(0);
-} break;
-case 1696: {
-p.push_back(1696);
-p.push_back(15);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1697: {
-p.push_back(1697);
-p.push_back(201);
-p.push_back(0);
-} break;
-case 1698: {
-p.push_back(1698);
-p.push_back(459);
-p.push_back(0);
-} break;
-case 1699: {
-p.push_back(1699);
-p.push_back(12);
-p.push_back(10);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1700: {
-p.push_back(1700);
-p.push_back(225);
-p.push_back(0);
-} break;
-case 1701: {
-p.push_back(1701);
-p.push_back(22);
-p.push_back(17);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 1702: {
-p.push_back(1702);
-p.push_back(24);
-p.push_back(22);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1703: {
-p.push_back(1703);
-p.push_back(161);
-p.push_back(0);
-} break;
-case 1704: {
-p.push_back(1704);
-p.push_back(14);
-p.push_back(11);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1705: {
-p.push_back(1705);
-p.push_back(52);
-p.push_back(0);
-} break;
-case 1706: {
-p.push_back(1706);
-p.push_back(19);
-p.push_back(17);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1707: {
-p.push_back(1707);
-p.push_back(21);
-p.push_back(14);
-p.push_back(12);
-p.push_back(0);
-} break;
-case 1708: {
-p.push_back(1708);
-p.push_back(93);
-p.push_back(0);
-} break;
-case 1709: {
-p.push_back(1709);
-p.push_back(13);
-p.push_back(10);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1710: {
-p.push_back(1710);
-p.push_back(201);
-p.push_back(0);
-} break;
-case 1711: {
-p.push_back(1711);
-p.push_back(178);
-p.push_back(0);
-} break;
-case 1712: {
-p.push_back(1712);
-p.push_back(15);
-p.push_back(12);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1713: {
-p.push_back(1713);
-p.push_back(250);
-p.push_back(0);
-} break;
-case 1714: {
-p.push_back(1714);
-p.push_back(7);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1715: {
-p.push_back(1715);
-p.push_back(17);
-p.push_back(13);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1716: {
-p.push_back(1716);
-p.push_back(221);
-p.push_back(0);
-} break;
-case 1717: {
-p.push_back(1717);
-p.push_back(13);
-p.push_back(11);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1718: {
-p.push_back(1718);
-p.push_back(17);
-p.push_back(14);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1719: {
-p.push_back(1719);
-p.push_back(113);
-p.push_back(0);
-} break;
-case 1720: {
-p.push_back(1720);
-p.push_back(17);
-p.push_back(14);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1721: {
-p.push_back(1721);
-p.push_back(300);
-p.push_back(0);
-} break;
-case 1722: {
-p.push_back(1722);
-p.push_back(39);
-p.push_back(0);
-} break;
-case 1723: {
-p.push_back(1723);
-p.push_back(18);
-p.push_back(13);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1724: {
-p.push_back(1724);
-p.push_back(261);
-p.push_back(0);
-} break;
-case 1725: {
-p.push_back(1725);
-p.push_back(15);
-p.push_back(14);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1726: {
-p.push_back(1726);
-p.push_back(753);
-p.push_back(0);
-} break;
-case 1727: {
-p.push_back(1727);
-p.push_back(8);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1728: {
-p.push_back(1728);
-p.push_back(11);
-p.push_back(10);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1729: {
-p.push_back(1729);
-p.push_back(94);
-p.push_back(0);
-} break;
-case 1730: {
-p.push_back(1730);
-p.push_back(15);
-p.push_back(13);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1731: {
-p.push_back(1731);
-p.push_back(10);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1732: {
-p.push_back(1732);
-p.push_back(14);
-p.push_back(11);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1733: {
-p.push_back(1733);
-p.push_back(8);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1734: {
-p.push_back(1734);
-p.push_back(461);
-p.push_back(0);
-} break;
-case 1735: {
-p.push_back(1735);
-p.push_back(418);
-p.push_back(0);
-} break;
-case 1736: {
-p.push_back(1736);
-p.push_back(19);
-p.push_back(14);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1737: {
-p.push_back(1737);
-p.push_back(403);
-p.push_back(0);
-} break;
-case 1738: {
-p.push_back(1738);
-p.push_back(267);
-p.push_back(0);
-} break;
-case 1739: {
-p.push_back(1739);
-p.push_back(10);
-p.push_back(9);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1740: {
-p.push_back(1740);
-p.push_back(259);
-p.push_back(0);
-} break;
-case 1741: {
-p.push_back(1741);
-p.push_back(20);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1742: {
-p.push_back(1742);
-p.push_back(869);
-p.push_back(0);
-} break;
-case 1743: {
-p.push_back(1743);
-p.push_back(173);
-p.push_back(0);
-} break;
-case 1744: {
-p.push_back(1744);
-p.push_back(19);
-p.push_back(18);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1745: {
-p.push_back(1745);
-p.push_back(369);
-p.push_back(0);
-} break;
-case 1746: {
-p.push_back(1746);
-p.push_back(255);
-p.push_back(0);
-} break;
-case 1747: {
-p.push_back(1747);
-p.push_back(22);
-p.push_back(12);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1748: {
-p.push_back(1748);
-p.push_back(567);
-p.push_back(0);
-} break;
-case 1749: {
-p.push_back(1749);
-p.push_back(20);
-p.push_back(11);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1750: {
-p.push_back(1750);
-p.push_back(457);
-p.push_back(0);
-} break;
-case 1751: {
-p.push_back(1751);
-p.push_back(482);
-p.push_back(0);
-} break;
-case 1752: {
-p.push_back(1752);
-p.push_back(6);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1753: {
-p.push_back(1753);
-p.push_back(775);
-p.push_back(0);
-} break;
-case 1754: {
-p.push_back(1754);
-p.push_back(19);
-p.push_back(17);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1755: {
-p.push_back(1755);
-p.push_back(6);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1756: {
-p.push_back(1756);
-p.push_back(99);
-p.push_back(0);
-} break;
-case 1757: {
-p.push_back(1757);
-p.push_back(15);
-p.push_back(14);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1758: {
-p.push_back(1758);
-p.push_back(6);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1759: {
-p.push_back(1759);
-p.push_back(165);
-p.push_back(0);
-} break;
-case 1760: {
-p.push_back(1760);
-p.push_back(8);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1761: {
-p.push_back(1761);
-p.push_back(13);
-p.push_back(12);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1762: {
-p.push_back(1762);
-p.push_back(25);
-p.push_back(21);
-p.push_back(17);
-p.push_back(0);
-} break;
-case 1763: {
-p.push_back(1763);
-p.push_back(17);
-p.push_back(14);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1764: {
-p.push_back(1764);
-p.push_back(105);
-p.push_back(0);
-} break;
-case 1765: {
-p.push_back(1765);
-p.push_back(17);
-p.push_back(15);
-p.push_back(14);
-p.push_back(0);
-} break;
-case 1766: {
-p.push_back(1766);
-p.push_back(10);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1767: {
-p.push_back(1767);
-p.push_back(250);
-p.push_back(0);
-} break;
-case 1768: {
-p.push_back(1768);
-p.push_back(25);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1769: {
-p.push_back(1769);
-p.push_back(327);
-p.push_back(0);
-} break;
-case 1770: {
-p.push_back(1770);
-p.push_back(279);
-p.push_back(0);
-} break;
-case 1771: {
-p.push_back(1771);
-p.push_back(13);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1772: {
-p.push_back(1772);
-p.push_back(371);
-p.push_back(0);
-} break;
-case 1773: {
-p.push_back(1773);
-p.push_back(15);
-p.push_back(9);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1774: {
-p.push_back(1774);
-p.push_back(117);
-p.push_back(0);
-} break;
-case 1775: {
-p.push_back(1775);
-p.push_back(486);
-p.push_back(0);
-} break;
-case 1776: {
-p.push_back(1776);
-p.push_back(10);
-p.push_back(9);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1777: {
-p.push_back(1777);
-p.push_back(217);
-p.push_back(0);
-} break;
-case 1778: {
-p.push_back(1778);
-p.push_back(635);
-p.push_back(0);
-} break;
-case 1779: {
-p.push_back(1779);
-p.push_back(30);
-p.push_back(27);
-p.push_back(17);
-p.push_back(0);
-} break;
-case 1780: {
-p.push_back(1780);
-p.push_back(457);
-p.push_back(0);
-} break;
-case 1781: {
-p.push_back(1781);
-p.push_back(16);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1782: {
-p.push_back(1782);
-p.push_back(57);
-p.push_back(0);
-} break;
-case 1783: {
-p.push_back(1783);
-p.push_back(439);
-p.push_back(0);
-} break;
-case 1784: {
-p.push_back(1784);
-p.push_back(23);
-p.push_back(21);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1785: {
-p.push_back(1785);
-p.push_back(214);
-p.push_back(0);
-} break;
-case 1786: {
-p.push_back(1786);
-p.push_back(20);
-p.push_back(13);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1787: {
-p.push_back(1787);
-p.push_back(20);
-p.push_back(16);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1788: {
-p.push_back(1788);
-p.push_back(819);
-p.push_back(0);
-} break;
-case 1789: {
-p.push_back(1789);
-p.push_back(15);
-p.push_back(11);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1790: {
-p.push_back(1790);
-p.push_back(593);
-p.push_back(0);
-} break;
-case 1791: {
-p.push_back(1791);
-p.push_back(190);
-p.push_back(0);
-} break;
-case 1792: {
-p.push_back(1792);
-p.push_back(17);
-p.push_back(14);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1793: {
-p.push_back(1793);
-p.push_back(114);
-p.push_back(0);
-} break;
-case 1794: {
-p.push_back(1794);
-p.push_back(21);
-p.push_back(18);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1795: {
-p.push_back(1795);
-p.push_back(10);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1796: {
-p.push_back(1796);
-p.push_back(12);
-p.push_back(9);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1797: {
-p.push_back(1797);
-p.push_back(8);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1798: {
-p.push_back(1798);
-p.push_back(69);
-p.push_back(0);
-} break;
-case 1799: {
-p.push_back(1799);
-p.push_back(312);
-p.push_back(0);
-} break;
-case 1800: {
-p.push_back(1800);
-p.push_back(22);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1801: {
-p.push_back(1801);
-p.push_back(502);
-p.push_back(0);
-} break;
-case 1802: {
-p.push_back(1802);
-p.push_back(843);
-p.push_back(0);
-} break;
-case 1803: {
-p.push_back(1803);
-p.push_back(15);
-p.push_back(10);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1804: {
-p.push_back(1804);
-p.push_back(747);
-p.push_back(0);
-} break;
-case 1805: {
-p.push_back(1805);
-p.push_back(6);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1806: {
-p.push_back(1806);
-p.push_back(101);
-p.push_back(0);
-} break;
-case 1807: {
-p.push_back(1807);
-p.push_back(123);
-p.push_back(0);
-} break;
-case 1808: {
-p.push_back(1808);
-p.push_back(19);
-p.push_back(16);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1809: {
-p.push_back(1809);
-p.push_back(521);
-p.push_back(0);
-} break;
-case 1810: {
-p.push_back(1810);
-p.push_back(171);
-p.push_back(0);
-} break;
-case 1811: {
-p.push_back(1811);
-p.push_back(16);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1812: {
-p.push_back(1812);
-p.push_back(12);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1813: {
-p.push_back(1813);
-p.push_back(22);
-p.push_back(21);
-p.push_back(20);
-p.push_back(0);
-} break;
-case 1814: {
-p.push_back(1814);
-p.push_back(545);
-p.push_back(0);
-} break;
-case 1815: {
-p.push_back(1815);
-p.push_back(163);
-p.push_back(0);
-} break;
-case 1816: {
-p.push_back(1816);
-p.push_back(23);
-p.push_back(18);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1817: {
-p.push_back(1817);
-p.push_back(479);
-p.push_back(0);
-} break;
-case 1818: {
-p.push_back(1818);
-p.push_back(495);
-p.push_back(0);
-} break;
-case 1819: {
-p.push_back(1819);
-p.push_back(13);
-p.push_back(6);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1820: {
-p.push_back(1820);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 1821: {
-p.push_back(1821);
-p.push_back(17);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1822: {
-p.push_back(1822);
-p.push_back(18);
-p.push_back(8);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1823: {
-p.push_back(1823);
-p.push_back(684);
-p.push_back(0);
-} break;
-case 1824: {
-p.push_back(1824);
-p.push_back(7);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1825: {
-p.push_back(1825);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1826: {
-p.push_back(1826);
-p.push_back(18);
-p.push_back(11);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1827: {
-p.push_back(1827);
-p.push_back(22);
-p.push_back(20);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 1828: {
-p.push_back(1828);
-p.push_back(273);
-p.push_back(0);
-} break;
-case 1829: {
-p.push_back(1829);
-p.push_back(4);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1830: {
-p.push_back(1830);
-p.push_back(381);
-p.push_back(0);
-} break;
-case 1831: {
-p.push_back(1831);
-p.push_back(51);
-p.push_back(0);
-} break;
-case 1832: {
-p.push_back(1832);
-p.push_back(18);
-p.push_back(13);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1833: {
-p.push_back(1833);
-p.push_back(518);
-p.push_back(0);
-} break;
-case 1834: {
-p.push_back(1834);
-p.push_back(9);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1835: {
-p.push_back(1835);
-p.push_back(14);
-p.push_back(12);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1836: {
-p.push_back(1836);
-p.push_back(243);
-p.push_back(0);
-} break;
-case 1837: {
-p.push_back(1837);
-p.push_back(21);
-p.push_back(17);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1838: {
-p.push_back(1838);
-p.push_back(53);
-p.push_back(0);
-} break;
-case 1839: {
-p.push_back(1839);
-p.push_back(836);
-p.push_back(0);
-} break;
-case 1840: {
-p.push_back(1840);
-p.push_back(21);
-p.push_back(10);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1841: {
-p.push_back(1841);
-p.push_back(66);
-p.push_back(0);
-} break;
-case 1842: {
-p.push_back(1842);
-p.push_back(12);
-p.push_back(10);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1843: {
-p.push_back(1843);
-p.push_back(13);
-p.push_back(9);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1844: {
-p.push_back(1844);
-p.push_back(339);
-p.push_back(0);
-} break;
-case 1845: {
-p.push_back(1845);
-p.push_back(16);
-p.push_back(11);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1846: {
-p.push_back(1846);
-p.push_back(901);
-p.push_back(0);
-} break;
-case 1847: {
-p.push_back(1847);
-p.push_back(180);
-p.push_back(0);
-} break;
-case 1848: {
-p.push_back(1848);
-p.push_back(16);
-p.push_back(13);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1849: {
-p.push_back(1849);
-p.push_back(49);
-p.push_back(0);
-} break;
-case 1850: {
-p.push_back(1850);
-p.push_back(6);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1851: {
-p.push_back(1851);
-p.push_back(15);
-p.push_back(4);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1852: {
-p.push_back(1852);
-p.push_back(16);
-p.push_back(13);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1853: {
-p.push_back(1853);
-p.push_back(18);
-p.push_back(15);
-p.push_back(12);
-p.push_back(0);
-} break;
-case 1854: {
-p.push_back(1854);
-p.push_back(885);
-p.push_back(0);
-} break;
-case 1855: {
-p.push_back(1855);
-p.push_back(39);
-p.push_back(0);
-} break;
-case 1856: {
-p.push_back(1856);
-p.push_back(11);
-p.push_back(9);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1857: {
-p.push_back(1857);
-p.push_back(688);
-p.push_back(0);
-} break;
-case 1858: {
-p.push_back(1858);
-p.push_back(16);
-p.push_back(15);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1859: {
-p.push_back(1859);
-p.push_back(13);
-p.push_back(10);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1860: {
-p.push_back(1860);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 1861: {
-p.push_back(1861);
-p.push_back(25);
-p.push_back(23);
-p.push_back(12);
-p.push_back(0);
-} break;
-case 1862: {
-p.push_back(1862);
-p.push_back(149);
-p.push_back(0);
-} break;
-case 1863: {
-p.push_back(1863);
-p.push_back(260);
-p.push_back(0);
-} break;
-case 1864: {
-p.push_back(1864);
-p.push_back(11);
-p.push_back(9);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1865: {
-p.push_back(1865);
-p.push_back(53);
-p.push_back(0);
-} break;
-case 1866: {
-p.push_back(1866);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 1867: {
-p.push_back(1867);
-p.push_back(12);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1868: {
-p.push_back(1868);
-p.push_back(9);
-p.push_back(7);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1869: {
-p.push_back(1869);
-p.push_back(11);
-p.push_back(8);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1870: {
-p.push_back(1870);
-p.push_back(121);
-p.push_back(0);
-} break;
-case 1871: {
-p.push_back(1871);
-p.push_back(261);
-p.push_back(0);
-} break;
-case 1872: {
-p.push_back(1872);
-p.push_back(10);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1873: {
-p.push_back(1873);
-p.push_back(199);
-p.push_back(0);
-} break;
-case 1874: {
-p.push_back(1874);
-p.push_back(20);
-p.push_back(4);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1875: {
-p.push_back(1875);
-p.push_back(17);
-p.push_back(9);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1876: {
-p.push_back(1876);
-p.push_back(13);
-p.push_back(9);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1877: {
-p.push_back(1877);
-p.push_back(12);
-p.push_back(8);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1878: {
-p.push_back(1878);
-p.push_back(253);
-p.push_back(0);
-} break;
-case 1879: {
-p.push_back(1879);
-p.push_back(174);
-p.push_back(0);
-} break;
-case 1880: {
-p.push_back(1880);
-p.push_back(15);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1881: {
-p.push_back(1881);
-p.push_back(370);
-p.push_back(0);
-} break;
-case 1882: {
-p.push_back(1882);
-p.push_back(9);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1883: {
-p.push_back(1883);
-p.push_back(16);
-p.push_back(10);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1884: {
-p.push_back(1884);
-p.push_back(669);
-p.push_back(0);
-} break;
-case 1885: {
-p.push_back(1885);
-p.push_back(20);
-p.push_back(10);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1886: {
-p.push_back(1886);
-p.push_back(833);
-p.push_back(0);
-} break;
-case 1887: {
-p.push_back(1887);
-p.push_back(353);
-p.push_back(0);
-} break;
-case 1888: {
-p.push_back(1888);
-p.push_back(17);
-p.push_back(13);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1889: {
-p.push_back(1889);
-p.push_back(29);
-p.push_back(0);
-} break;
-case 1890: {
-p.push_back(1890);
-p.push_back(371);
-p.push_back(0);
-} break;
-case 1891: {
-p.push_back(1891);
-p.push_back(9);
-p.push_back(8);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1892: {
-p.push_back(1892);
-p.push_back(8);
-p.push_back(7);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1893: {
-p.push_back(1893);
-p.push_back(19);
-p.push_back(8);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1894: {
-p.push_back(1894);
-p.push_back(12);
-p.push_back(11);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1895: {
-p.push_back(1895);
-p.push_back(873);
-p.push_back(0);
-} break;
-case 1896: {
-p.push_back(1896);
-p.push_back(26);
-p.push_back(11);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1897: {
-p.push_back(1897);
-p.push_back(12);
-p.push_back(9);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1898: {
-p.push_back(1898);
-p.push_back(10);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1899: {
-p.push_back(1899);
-p.push_back(13);
-p.push_back(6);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1900: {
-p.push_back(1900);
-p.push_back(235);
-p.push_back(0);
-} break;
-case 1901: {
-p.push_back(1901);
-p.push_back(26);
-p.push_back(24);
-p.push_back(19);
-p.push_back(0);
-} break;
-case 1902: {
-p.push_back(1902);
-p.push_back(733);
-p.push_back(0);
-} break;
-case 1903: {
-p.push_back(1903);
-p.push_back(778);
-p.push_back(0);
-} break;
-case 1904: {
-p.push_back(1904);
-p.push_back(12);
-p.push_back(11);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1905: {
-p.push_back(1905);
-p.push_back(344);
-p.push_back(0);
-} break;
-case 1906: {
-p.push_back(1906);
-p.push_back(931);
-p.push_back(0);
-} break;
-case 1907: {
-p.push_back(1907);
-p.push_back(16);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1908: {
-p.push_back(1908);
-p.push_back(945);
-p.push_back(0);
-} break;
-case 1909: {
-p.push_back(1909);
-p.push_back(21);
-p.push_back(19);
-p.push_back(14);
-p.push_back(0);
-} break;
-case 1910: {
-p.push_back(1910);
-p.push_back(18);
-p.push_back(13);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 1911: {
-p.push_back(1911);
-p.push_back(67);
-p.push_back(0);
-} break;
-case 1912: {
-p.push_back(1912);
-p.push_back(20);
-p.push_back(15);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1913: {
-p.push_back(1913);
-p.push_back(462);
-p.push_back(0);
-} break;
-case 1914: {
-p.push_back(1914);
-p.push_back(14);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1915: {
-p.push_back(1915);
-p.push_back(10);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1916: {
-p.push_back(1916);
-p.push_back(18);
-p.push_back(11);
-p.push_back(10);
-p.push_back(0);
-} break;
-case 1917: {
-p.push_back(1917);
-p.push_back(16);
-p.push_back(9);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1918: {
-p.push_back(1918);
-p.push_back(477);
-p.push_back(0);
-} break;
-case 1919: {
-p.push_back(1919);
-p.push_back(105);
-p.push_back(0);
-} break;
-case 1920: {
-p.push_back(1920);
-p.push_back(11);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1921: {
-p.push_back(1921);
-p.push_back(468);
-p.push_back(0);
-} break;
-case 1922: {
-p.push_back(1922);
-p.push_back(23);
-p.push_back(16);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 1923: {
-p.push_back(1923);
-p.push_back(16);
-p.push_back(15);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1924: {
-p.push_back(1924);
-p.push_back(327);
-p.push_back(0);
-} break;
-case 1925: {
-p.push_back(1925);
-p.push_back(23);
-p.push_back(10);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1926: {
-p.push_back(1926);
-p.push_back(357);
-p.push_back(0);
-} break;
-case 1927: {
-p.push_back(1927);
-p.push_back(25);
-p.push_back(0);
-} break;
-case 1928: {
-p.push_back(1928);
-p.push_back(17);
-p.push_back(16);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1929: {
-p.push_back(1929);
-p.push_back(31);
-p.push_back(0);
-} break;
-case 1930: {
-p.push_back(1930);
-p.push_back(7);
-p.push_back(5);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1931: {
-p.push_back(1931);
-p.push_back(16);
-p.push_back(7);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1932: {
-p.push_back(1932);
-p.push_back(277);
-p.push_back(0);
-} break;
-case 1933: {
-p.push_back(1933);
-p.push_back(14);
-p.push_back(13);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1934: {
-p.push_back(1934);
-p.push_back(413);
-p.push_back(0);
-} break;
-case 1935: {
-p.push_back(1935);
-p.push_back(103);
-p.push_back(0);
-} break;
-case 1936: {
-p.push_back(1936);
-p.push_back(15);
-p.push_back(10);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1937: {
-p.push_back(1937);
-p.push_back(231);
-p.push_back(0);
-} break;
-case 1938: {
-p.push_back(1938);
-p.push_back(747);
-p.push_back(0);
-} break;
-case 1939: {
-p.push_back(1939);
-p.push_back(5);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1940: {
-p.push_back(1940);
-p.push_back(113);
-p.push_back(0);
-} break;
-case 1941: {
-p.push_back(1941);
-p.push_back(20);
-p.push_back(10);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 1942: {
-p.push_back(1942);
-p.push_back(15);
-p.push_back(9);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1943: {
-p.push_back(1943);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 1944: {
-p.push_back(1944);
-p.push_back(27);
-p.push_back(22);
-p.push_back(18);
-p.push_back(0);
-} break;
-case 1945: {
-p.push_back(1945);
-p.push_back(91);
-p.push_back(0);
-} break;
-case 1946: {
-p.push_back(1946);
-p.push_back(51);
-p.push_back(0);
-} break;
-case 1947: {
-p.push_back(1947);
-p.push_back(18);
-p.push_back(13);
-p.push_back(12);
-p.push_back(0);
-} break;
-case 1948: {
-p.push_back(1948);
-p.push_back(603);
-p.push_back(0);
-} break;
-case 1949: {
-p.push_back(1949);
-p.push_back(10);
-p.push_back(7);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1950: {
-p.push_back(1950);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 1951: {
-p.push_back(1951);
-p.push_back(121);
-p.push_back(0);
-} break;
-case 1952: {
-p.push_back(1952);
-p.push_back(15);
-p.push_back(14);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1953: {
-p.push_back(1953);
-p.push_back(17);
-p.push_back(0);
-} break;
-case 1954: {
-p.push_back(1954);
-p.push_back(16);
-p.push_back(11);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1955: {
-p.push_back(1955);
-p.push_back(23);
-p.push_back(15);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1956: {
-p.push_back(1956);
-p.push_back(279);
-p.push_back(0);
-} break;
-case 1957: {
-p.push_back(1957);
-p.push_back(16);
-p.push_back(12);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1958: {
-p.push_back(1958);
-p.push_back(89);
-p.push_back(0);
-} break;
-case 1959: {
-p.push_back(1959);
-p.push_back(371);
-p.push_back(0);
-} break;
-case 1960: {
-p.push_back(1960);
-p.push_back(17);
-p.push_back(15);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1961: {
-p.push_back(1961);
-p.push_back(771);
-p.push_back(0);
-} break;
-case 1962: {
-p.push_back(1962);
-p.push_back(99);
-p.push_back(0);
-} break;
-case 1963: {
-p.push_back(1963);
-p.push_back(7);
-p.push_back(6);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1964: {
-p.push_back(1964);
-p.push_back(21);
-p.push_back(0);
-} break;
-case 1965: {
-p.push_back(1965);
-p.push_back(10);
-p.push_back(7);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1966: {
-p.push_back(1966);
-p.push_back(801);
-p.push_back(0);
-} break;
-case 1967: {
-p.push_back(1967);
-p.push_back(26);
-p.push_back(0);
-} break;
-case 1968: {
-p.push_back(1968);
-p.push_back(25);
-p.push_back(19);
-p.push_back(14);
-p.push_back(0);
-} break;
-case 1969: {
-p.push_back(1969);
-p.push_back(175);
-p.push_back(0);
-} break;
-case 1970: {
-p.push_back(1970);
-p.push_back(10);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1971: {
-p.push_back(1971);
-p.push_back(20);
-p.push_back(5);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1972: {
-p.push_back(1972);
-p.push_back(12);
-p.push_back(11);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1973: {
-p.push_back(1973);
-p.push_back(22);
-p.push_back(5);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1974: {
-p.push_back(1974);
-p.push_back(165);
-p.push_back(0);
-} break;
-case 1975: {
-p.push_back(1975);
-p.push_back(841);
-p.push_back(0);
-} break;
-case 1976: {
-p.push_back(1976);
-p.push_back(25);
-p.push_back(19);
-p.push_back(17);
-p.push_back(0);
-} break;
-case 1977: {
-p.push_back(1977);
-p.push_back(238);
-p.push_back(0);
-} break;
-case 1978: {
-p.push_back(1978);
-p.push_back(11);
-p.push_back(8);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1979: {
-p.push_back(1979);
-p.push_back(22);
-p.push_back(21);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 1980: {
-p.push_back(1980);
-p.push_back(33);
-p.push_back(0);
-} break;
-case 1981: {
-p.push_back(1981);
-p.push_back(8);
-p.push_back(7);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 1982: {
-p.push_back(1982);
-p.push_back(14);
-p.push_back(9);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1983: {
-p.push_back(1983);
-p.push_back(113);
-p.push_back(0);
-} break;
-case 1984: {
-p.push_back(1984);
-p.push_back(13);
-p.push_back(11);
-p.push_back(5);
-p.push_back(0);
-} break;
-case 1985: {
-p.push_back(1985);
-p.push_back(311);
-p.push_back(0);
-} break;
-case 1986: {
-p.push_back(1986);
-p.push_back(891);
-p.push_back(0);
-} break;
-case 1987: {
-p.push_back(1987);
-p.push_back(20);
-p.push_back(16);
-p.push_back(14);
-p.push_back(0);
-} break;
-case 1988: {
-p.push_back(1988);
-p.push_back(555);
-p.push_back(0);
-} break;
-case 1989: {
-p.push_back(1989);
-p.push_back(23);
-p.push_back(14);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 1990: {
-p.push_back(1990);
-p.push_back(133);
-p.push_back(0);
-} break;
-case 1991: {
-p.push_back(1991);
-p.push_back(546);
-p.push_back(0);
-} break;
-case 1992: {
-p.push_back(1992);
-p.push_back(6);
-p.push_back(3);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1993: {
-p.push_back(1993);
-p.push_back(103);
-p.push_back(0);
-} break;
-case 1994: {
-p.push_back(1994);
-p.push_back(15);
-p.push_back(0);
-} break;
-case 1995: {
-p.push_back(1995);
-p.push_back(10);
-p.push_back(7);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 1996: {
-p.push_back(1996);
-p.push_back(307);
-p.push_back(0);
-} break;
-case 1997: {
-p.push_back(1997);
-p.push_back(14);
-p.push_back(10);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 1998: {
-p.push_back(1998);
-p.push_back(15);
-p.push_back(12);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 1999: {
-p.push_back(1999);
-p.push_back(367);
-p.push_back(0);
-} break;
-case 2000: {
-p.push_back(2000);
-p.push_back(13);
-p.push_back(10);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 2001: {
-p.push_back(2001);
-p.push_back(169);
-p.push_back(0);
-} break;
-case 2002: {
-p.push_back(2002);
-p.push_back(22);
-p.push_back(21);
-p.push_back(11);
-p.push_back(0);
-} break;
-case 2003: {
-p.push_back(2003);
-p.push_back(12);
-p.push_back(10);
-p.push_back(8);
-p.push_back(0);
-} break;
-case 2004: {
-p.push_back(2004);
-p.push_back(441);
-p.push_back(0);
-} break;
-case 2005: {
-p.push_back(2005);
-p.push_back(17);
-p.push_back(12);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 2006: {
-p.push_back(2006);
-p.push_back(917);
-p.push_back(0);
-} break;
-case 2007: {
-p.push_back(2007);
-p.push_back(205);
-p.push_back(0);
-} break;
-case 2008: {
-p.push_back(2008);
-p.push_back(26);
-p.push_back(23);
-p.push_back(13);
-p.push_back(0);
-} break;
-case 2009: {
-p.push_back(2009);
-p.push_back(54);
-p.push_back(0);
-} break;
-case 2010: {
-p.push_back(2010);
-p.push_back(459);
-p.push_back(0);
-} break;
-case 2011: {
-p.push_back(2011);
-p.push_back(17);
-p.push_back(15);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 2012: {
-p.push_back(2012);
-p.push_back(19);
-p.push_back(15);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 2013: {
-p.push_back(2013);
-p.push_back(5);
-p.push_back(4);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 2014: {
-p.push_back(2014);
-p.push_back(9);
-p.push_back(7);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 2015: {
-p.push_back(2015);
-p.push_back(42);
-p.push_back(0);
-} break;
-case 2016: {
-p.push_back(2016);
-p.push_back(21);
-p.push_back(15);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 2017: {
-p.push_back(2017);
-p.push_back(330);
-p.push_back(0);
-} break;
-case 2018: {
-p.push_back(2018);
-p.push_back(20);
-p.push_back(7);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 2019: {
-p.push_back(2019);
-p.push_back(20);
-p.push_back(7);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 2020: {
-p.push_back(2020);
-p.push_back(81);
-p.push_back(0);
-} break;
-case 2021: {
-p.push_back(2021);
-p.push_back(19);
-p.push_back(14);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 2022: {
-p.push_back(2022);
-p.push_back(349);
-p.push_back(0);
-} break;
-case 2023: {
-p.push_back(2023);
-p.push_back(165);
-p.push_back(0);
-} break;
-case 2024: {
-p.push_back(2024);
-p.push_back(40);
-p.push_back(35);
-p.push_back(9);
-p.push_back(0);
-} break;
-case 2025: {
-p.push_back(2025);
-p.push_back(274);
-p.push_back(0);
-} break;
-case 2026: {
-p.push_back(2026);
-p.push_back(475);
-p.push_back(0);
-} break;
-case 2027: {
-p.push_back(2027);
-p.push_back(11);
-p.push_back(10);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 2028: {
-p.push_back(2028);
-p.push_back(93);
-p.push_back(0);
-} break;
-case 2029: {
-p.push_back(2029);
-p.push_back(12);
-p.push_back(7);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 2030: {
-p.push_back(2030);
-p.push_back(13);
-p.push_back(12);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 2031: {
-p.push_back(2031);
-p.push_back(386);
-p.push_back(0);
-} break;
-case 2032: {
-p.push_back(2032);
-p.push_back(7);
-p.push_back(6);
-p.push_back(2);
-p.push_back(0);
-} break;
-case 2033: {
-p.push_back(2033);
-p.push_back(881);
-p.push_back(0);
-} break;
-case 2034: {
-p.push_back(2034);
-p.push_back(143);
-p.push_back(0);
-} break;
-case 2035: {
-p.push_back(2035);
-p.push_back(9);
-p.push_back(8);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 2036: {
-p.push_back(2036);
-p.push_back(71);
-p.push_back(0);
-} break;
-case 2037: {
-p.push_back(2037);
-p.push_back(19);
-p.push_back(18);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 2038: {
-p.push_back(2038);
-p.push_back(16);
-p.push_back(11);
-p.push_back(6);
-p.push_back(0);
-} break;
-case 2039: {
-p.push_back(2039);
-p.push_back(155);
-p.push_back(0);
-} break;
-case 2040: {
-p.push_back(2040);
-p.push_back(7);
-p.push_back(2);
-p.push_back(1);
-p.push_back(0);
-} break;
-case 2041: {
-p.push_back(2041);
-p.push_back(735);
-p.push_back(0);
-} break;
-case 2042: {
-p.push_back(2042);
-p.push_back(16);
-p.push_back(8);
-p.push_back(7);
-p.push_back(0);
-} break;
-case 2043: {
-p.push_back(2043);
-p.push_back(9);
-p.push_back(7);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 2044: {
-p.push_back(2044);
-p.push_back(45);
-p.push_back(0);
-} break;
-case 2045: {
-p.push_back(2045);
-p.push_back(7);
-p.push_back(6);
-p.push_back(4);
-p.push_back(0);
-} break;
-case 2046: {
-p.push_back(2046);
-p.push_back(12);
-p.push_back(11);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 2047: {
-p.push_back(2047);
-p.push_back(3);
-p.push_back(0);
-} break;
-case 2048: {
-p.push_back(2048);
-p.push_back(19);
-p.push_back(14);
-p.push_back(13);
-p.push_back(0);
-} break;
-default:
-	cerr << "Internal error: n out of bounds!";
-	exit(-1);
-}
-}
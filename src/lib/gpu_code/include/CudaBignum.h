@@ -34,6 +34,7 @@ typedef std::vector<CUDA_BIGNUM> CUDA_BIGNUM_VEC;
 
 namespace libcumffa {
     namespace gpu {
+        // the result is cache line aligned, free it with freeAligned
         CUDA_BIGNUM *bin2bn( const unsigned char *bin_value, uint32 len );
     }
 }
@@ -30,8 +30,7 @@
 #include "GF2nArithmetic.h"
 #include "CudaBignum.h"
 #include "GF2nArithmeticCudaDataPool.h"
-
-void set_irrep(std::vector<int>&, unsigned int);
+#include "GF2nIrreducible.h"
 
 #define LENDIAN 0
 #define BENDIAN 1
@@ -59,6 +58,32 @@ namespace libcumffa {
 				{}
 		};
 
+		/*
+			opcodes of the cuda specific operations
+		*/
+		enum GF2nCudaOpcode
+		{
+			CUDA_OP_PAR_ADD = GF2N_OP_BACKEND,
+			CUDA_OP_PAR_ADD_LOOP,
+			CUDA_OP_PAR_ADD_TIME,
+			CUDA_OP_PAR_ADD_WITH_EVENTS,
+			CUDA_OP_PAR_ADD_OWN_STREAM,
+			CUDA_OP_PAR_ADD_OWN_STREAM_1024_THREADS,
+			CUDA_OP_PAR_ADD_OWN_STREAM_512_THREADS,
+			CUDA_OP_PAR_ADD_OWN_STREAM_256_THREADS,
+			CUDA_OP_PAR_ADD_OWN_STREAM_128_THREADS,
+			CUDA_OP_PAR_ADD_2_OWN_STREAM,
+			CUDA_OP_PAR_ADD_4_OWN_STREAM,
+			CUDA_OP_PAR_ADD_8_OWN_STREAM,
+			CUDA_OP_PAR_ADD_SHARED_MEM,
+			CUDA_OP_PAR_MUL,
+			CUDA_OP_PAR_MUL_CHUNKED_BAR_RED,
+			CUDA_OP_MEASURE_KERNEL_LAUNCH_OVERHEAD,
+			CUDA_OP_PAR_EXPONENTIATION,
+			CUDA_OP_PAR_INVERSE_ELEMENT,
+			CUDA_OP_PAR_INVERSE_ELEMENT_WITH_EXP
+		};
+
 		struct GF2nCudaProperties 
 		{
 			uint32 num_threads;
@@ -100,6 +125,15 @@ namespace libcumffa {
 			void setDummyParameters( const uint32 field_size, const unsigned char *irred_poly, const uint32 chunks_irred_poly );
 			void setDummyParameters( const uint32 field_size, const void *irred_poly, const uint32 chunks_irred_poly );
 			void setFlags( const unsigned char flags );
+			bool isAsync();
+			int32 resolveOp( const std::string &what );
+			uint32 getFieldSize();
+			void getModulus( std::vector<ufixn> &limbs );
+			uint32 getNumLimbs();
+			/* the batch is already spread over the device, no host tiles */
+			size_t getBatchTileSize() { return 0; }
+			void setNumWorkers( const uint32 num_workers ) {}
+			void runBatch( const int32 op, const ufixn *a, const ufixn *b, const uint32 value, ufixn *out, const size_t count, const uint32 stride, const uint32 worker );
 
 			/** @brief Prints character ch at the current location
 			 *         of the cursor.
@@ -121,6 +155,7 @@ namespace libcumffa {
 			GF2nArithmeticElement getElement( const std::string value );
 			GF2nArithmeticElement getElement( const unsigned char *value, const uint32 bytes_value );
 			GF2nArithmeticElement getElement( const void *value, const uint32 chunks_value );
+			GF2nArithmeticElement getElementFromLimbs( const ufixn *limbs );
 
 		private:
 			void initChunkSizes( uint32 field_size );
@@ -141,6 +176,15 @@ namespace libcumffa {
 			GF2nArithmeticCudaDataPool *m_d_data_pool;
 		};
 
+		namespace cuda {
+			/**
+			 * @brief      Returns the opcode of the operation with the given name
+			 *
+			 * @throw      MethodNotFoundException if the backend has no such operation
+			 */
+			int32 resolveOp( const std::string &what );
+		}
+
 		class MethodNotFoundException : public std::exception
 		{
 		public:
@@ -177,8 +221,13 @@ namespace libcumffa {
 			GF2nArithmeticElementInterface *div( GF2nArithmeticElementInterface *other );
 			GF2nArithmeticElementInterface *runWithElement( const std::string &what, GF2nArithmeticElementInterface *other );
 			GF2nArithmeticElementInterface *runWithValue( const std::string &what, uint32 value );
+			GF2nArithmeticElementInterface *runWithElement( const int32 op, GF2nArithmeticElementInterface *other );
+			GF2nArithmeticElementInterface *runWithValue( const int32 op, uint32 value );
 			std::string toString();
 			void getValue( std::vector<uint8> &value );
+			void getValue( uint8 *value, const size_t num_bytes );
+			void getLimbs( ufixn *limbs, const uint32 num_limbs );
+			uint32 getFieldSize();
 			double getCreationTime();
 			double getCopyToDeviceTime();
 			std::string getMetrics();
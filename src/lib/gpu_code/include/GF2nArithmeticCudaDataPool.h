@@ -23,23 +23,14 @@
 #define __GF2N_ARITHMETIC_CUDA_DATAPOOL_H__
 
 #include <exception>
-#include <map>
-#include <list>
 #include <memory>
 
 #include "CudaBignum.h"
+#include "GF2nLimbPool.h"
 
 namespace libcumffa {
 	namespace gpu {		
 
-		class EmptyDataPoolException : public std::exception 
-		{
-			virtual const char* what() const throw() 
-			{
-				return "The datapool has no more free elements!!!";
-			}
-		};
-
 		class InvalidDataPoolElementException : public std::exception
 		{
 			virtual const char* what() const throw()
@@ -50,9 +41,16 @@ namespace libcumffa {
 
 		class GF2nArithmeticCudaDataPoolElement;
 
+		/* slabs of a data pool in device memory */
+		class GF2nCudaSlabAllocator : public GF2nSlabAllocatorInterface
+		{
+		public:
+			virtual void *allocate( const size_t num_bytes );
+			virtual void free( void *slab );
+		};
+
 		class GF2nArithmeticCudaDataPool
 		{
-			friend class GF2nArithmeticCudaDataPoolElementData;
 		public:
 			GF2nArithmeticCudaDataPool();
 			/**
@@ -61,7 +59,8 @@ namespace libcumffa {
 			 * @param[in]  num_bytes       the size of a data
 			 * 							   pool element in bytes
 			 * @param[in]  data_pool_size  the number of data pool elements
-			 * 							   that will be created
+			 * 							   that are created at first, the pool
+			 * 							   grows when they are used up
 			 */
 			GF2nArithmeticCudaDataPool( uint32 num_bytes, uint32 data_pool_size );
 			~GF2nArithmeticCudaDataPool();
@@ -70,47 +69,28 @@ namespace libcumffa {
 			 *
 			 * @return     the next free data pool element
 			 * 
-			 * @throw    EmptyDataPoolException This exception is thrown if now more 
-			 * 									free elements are available in the data pool
+			 * @throw    EmptyLimbPoolException This exception is thrown if the 
+			 * 									data pool can not grow any further
 			 */
 			GF2nArithmeticCudaDataPoolElement get();
+			GF2nLimbPoolStats getStats() const;
 		private:
-			void free( uint32 pool_element );
-		private:
-			// Size of a data pool elmenent
-			uint32 m_h_num_bytes;
-
-			// Current size of the data pool
-			uint32 m_h_data_pool_size;
-
-			// Pointer to the first element of the allocated data pool
-			CUDA_BIGNUM *m_d_data_pool;
-
-			// Contains the indices of all free data pool elements
-			std::list<CUDA_BIGNUM> m_h_data_pool_free;
-
-			// Contains the indices of all data pool elements that are
-			// currently in use
-			std::list<CUDA_BIGNUM> m_h_data_pool_used;
-
-			// Contains a map of all currently useed data pool elements.
-			// All elements are GF2nArithmeticCudaDataPoolElementData types.
-			// Elements can be accessed by there data pool index.
-			std::map<CUDA_BIGNUM, void*> m_h_data_pool_refs;
+			// The slots of the data pool on the device. Elements keep
+			// the pool alive, so their data stays valid after the
+			// data pool is deleted.
+			std::shared_ptr<GF2nLimbPool> m_d_pool;
 		};
 
 		class GF2nArithmeticCudaDataPoolElementData
 		{
 		public:
-			GF2nArithmeticCudaDataPoolElementData( CUDA_BIGNUM *data, uint32 pool_element, GF2nArithmeticCudaDataPool *parent );
+			GF2nArithmeticCudaDataPoolElementData( uint32 pool_element, std::shared_ptr<GF2nLimbPool> const& pool );
 			~GF2nArithmeticCudaDataPoolElementData();
-			void invalidate();
 			CUDA_BIGNUM *getData();
 		private:
 			CUDA_BIGNUM *m_data;
-			CUDA_BIGNUM m_pool_element;
-			GF2nArithmeticCudaDataPool *m_parent;
-			bool m_isValid;
+			uint32 m_pool_element;
+			std::shared_ptr<GF2nLimbPool> m_pool;
 		};
 
 		class GF2nArithmeticCudaDataPoolElement
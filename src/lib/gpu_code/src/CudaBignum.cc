@@ -20,6 +20,7 @@
  */
 
 #include "CudaBignum.h"
+#include "GF2nAlignedMemory.h"
 
 namespace libcumffa {
     namespace gpu {
@@ -35,7 +36,7 @@ namespace libcumffa {
             // l is 1 chunk
             CUDA_BIGNUM l = 0;
             // the return value
-            CUDA_BIGNUM *ret = new CUDA_BIGNUM[i];
+            CUDA_BIGNUM *ret = allocAligned<CUDA_BIGNUM>(i);
             // index for the current byte
             uint32 k = 0;
 
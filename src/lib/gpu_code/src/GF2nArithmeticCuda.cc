@@ -21,10 +21,12 @@
 
 #include <cstring>
 #include <cassert>
+#include <algorithm>
 #include <sstream>
 #include <arpa/inet.h>
 
 #include "../include/GF2nArithmeticCuda.h"
+#include "GF2nAlignedMemory.h"
 #include "../kernels/GF2nArithmeticCudaWrapper.h"
 
 
@@ -81,8 +83,6 @@ void hexDump2( char *desc, void *addr, int len )
 	printf ("  %s\n", buff);
 }
 
-void set_irrep_cuda(std::vector<ufixn> &, uint32);
-
 //cuda
 namespace libcumffa {
 	namespace gpu {
@@ -108,12 +108,73 @@ namespace libcumffa {
 			printf("\n");
 		}
 
+		namespace cuda {
+
+			struct OpName
+			{
+				const char *name;
+				int32 opcode;
+			};
+
+			// names of all operations that can be passed to runWithElement
+			// and runWithValue
+			const OpName op_names[] = {
+				{ "add", 							GF2N_OP_ADD },
+				{ "sub", 							GF2N_OP_SUB },
+				{ "mul", 							GF2N_OP_MUL },
+				{ "exp", 							GF2N_OP_EXP },
+				{ "inverse", 						GF2N_OP_INVERSE },
+				{ "parAdd", 						CUDA_OP_PAR_ADD },
+				{ "parAddLoop", 					CUDA_OP_PAR_ADD_LOOP },
+				{ "parAddTime", 					CUDA_OP_PAR_ADD_TIME },
+				{ "parAddWithEvents", 				CUDA_OP_PAR_ADD_WITH_EVENTS },
+				{ "parAddOwnStream", 				CUDA_OP_PAR_ADD_OWN_STREAM },
+				{ "parAddOwnStream1024Threads", 	CUDA_OP_PAR_ADD_OWN_STREAM_1024_THREADS },
+				{ "parAddOwnStream512Threads", 		CUDA_OP_PAR_ADD_OWN_STREAM_512_THREADS },
+				{ "parAddOwnStream256Threads", 		CUDA_OP_PAR_ADD_OWN_STREAM_256_THREADS },
+				{ "parAddOwnStream128Threads", 		CUDA_OP_PAR_ADD_OWN_STREAM_128_THREADS },
+				{ "parAdd2OwnStream", 				CUDA_OP_PAR_ADD_2_OWN_STREAM },
+				{ "parAdd4OwnStream", 				CUDA_OP_PAR_ADD_4_OWN_STREAM },
+				{ "parAdd8OwnStream", 				CUDA_OP_PAR_ADD_8_OWN_STREAM },
+				{ "parAddSharedMem", 				CUDA_OP_PAR_ADD_SHARED_MEM },
+				{ "parMul", 						CUDA_OP_PAR_MUL },
+				{ "parMulChunkedBarRed", 			CUDA_OP_PAR_MUL_CHUNKED_BAR_RED },
+				{ "measureKernelLaunchOverhead", 	CUDA_OP_MEASURE_KERNEL_LAUNCH_OVERHEAD },
+				{ "parExponentiation", 				CUDA_OP_PAR_EXPONENTIATION },
+				{ "parInverseElement", 				CUDA_OP_PAR_INVERSE_ELEMENT },
+				{ "parInverseElementWithExp", 		CUDA_OP_PAR_INVERSE_ELEMENT_WITH_EXP }
+			};
+
+			int32 resolveOp( const std::string &what )
+			{
+				for( uint32 i=0; i<sizeof(op_names) / sizeof(op_names[0]); ++i )
+				{
+					if( what.compare(op_names[i].name) == 0 )
+						return op_names[i].opcode;
+				}
+
+				throw MethodNotFoundException(what);
+			}
+
+			std::string opName( const int32 op )
+			{
+				for( uint32 i=0; i<sizeof(op_names) / sizeof(op_names[0]); ++i )
+				{
+					if( op_names[i].opcode == op )
+						return op_names[i].name;
+				}
+
+				return std::to_string(op);
+			}
+		}
+
 		///////////////////////////////////////////////////////////////////////
 		/*
 			implementations of GF2nArithmeticCuda
 		*/
 		GF2nArithmeticCuda::GF2nArithmeticCuda()
-			: m_h_field_size(0)
+			: m_async(false)
+			, m_h_field_size(0)
 			, m_h_num_chunks(0)
 			, m_h_num_bytes(0)
 			, m_h_indx_mask_bit(0)
@@ -130,10 +191,10 @@ namespace libcumffa {
 			{
 				initChunkSizes(field_size);
 
-				if( !m_h_irred_poly.empty() )
-					m_h_irred_poly.clear();
-
-				set_irrep_cuda(m_h_irred_poly, m_h_field_size);
+				// the device expects the most significant chunk first
+				m_h_irred_poly.resize(m_h_num_chunks);
+				utils::getIrreducibleLimbs(m_h_field_size, &m_h_irred_poly[0], m_h_num_chunks);
+				std::reverse(m_h_irred_poly.begin(), m_h_irred_poly.end());
 			}
 
 			initDevice();
@@ -201,7 +262,129 @@ namespace libcumffa {
 
 		void GF2nArithmeticCuda::setFlags( const unsigned char flags )
 		{
-			m_async = (flags & 0x2) > 0;
+			m_async = (flags & GF2N_FLAG_ASYNC) > 0;
+		}
+
+		bool GF2nArithmeticCuda::isAsync()
+		{
+			return m_async;
+		}
+
+		int32 GF2nArithmeticCuda::resolveOp( const std::string &what )
+		{
+			return cuda::resolveOp(what);
+		}
+
+		uint32 GF2nArithmeticCuda::getFieldSize()
+		{
+			return m_h_field_size;
+		}
+
+		void GF2nArithmeticCuda::getModulus( std::vector<ufixn> &limbs )
+		{
+			uint32 num_limbs = utils::calcNumberChunks<uint32>(m_h_field_size + 1, sizeof(ufixn) * 8);
+			uint32 chunk_bits = sizeof(CUDA_BIGNUM) * 8;
+			uint32 limb_bits = sizeof(ufixn) * 8;
+			uint32 num_chunks = static_cast<uint32>(m_h_irred_poly.size());
+			limbs.assign(num_limbs, 0);
+
+			// the host modulus is stored most significant chunk first
+			for( uint32 i=0; i<num_chunks && i*chunk_bits < num_limbs * limb_bits; ++i )
+			{
+				ufixn chunk = static_cast<ufixn>(m_h_irred_poly[num_chunks - 1 - i]);
+				limbs[(i * chunk_bits) / limb_bits] |= chunk << ((i * chunk_bits) % limb_bits);
+			}
+		}
+
+		uint32 GF2nArithmeticCuda::getNumLimbs()
+		{
+			return utils::calcNumberChunks<uint32>(m_h_field_size, sizeof(ufixn) * 8);
+		}
+
+		void GF2nArithmeticCuda::runBatch( const int32 op, const ufixn *a, const ufixn *b, const uint32 value, ufixn *out, const size_t count, const uint32 stride, const uint32 worker )
+		{
+			bool with_element = false;
+
+			switch( op )
+			{
+			case GF2N_OP_ADD:
+			case GF2N_OP_SUB:
+			case GF2N_OP_MUL:
+				with_element = true;
+				break;
+			case GF2N_OP_EXP:
+			case GF2N_OP_INVERSE:
+				break;
+			default:
+				throw MethodNotFoundException(cuda::opName(op));
+			}
+
+			uint32 num_limbs = getNumLimbs();
+			uint32 batch_num_bytes = static_cast<uint32>(count * m_h_num_bytes);
+
+			// the device expects the most significant chunk first, so the
+			// whole batch is staged once in that order
+			std::vector<CUDA_BIGNUM> h_a(count * m_h_num_chunks, 0);
+			std::vector<CUDA_BIGNUM> h_b(with_element ? count * m_h_num_chunks : 0, 0);
+
+			for( size_t i=0; i<count; ++i )
+			{
+				for( uint32 j=0; j<num_limbs; ++j )
+				{
+					h_a[i * m_h_num_chunks + m_h_num_chunks - 1 - j] = a[i * stride + j];
+					if( with_element )
+						h_b[i * m_h_num_chunks + m_h_num_chunks - 1 - j] = b[i * stride + j];
+				}
+			}
+
+			CUDA_BIGNUM *d_a = NULL;
+			CUDA_BIGNUM *d_b = NULL;
+			CUDA_BIGNUM *d_res = NULL;
+
+			cuda::device_allocate(&d_a, batch_num_bytes);
+			cuda::device_allocate(&d_res, batch_num_bytes);
+			cuda::device_set(d_a, &h_a[0], batch_num_bytes);
+
+			if( with_element )
+			{
+				cuda::device_allocate(&d_b, batch_num_bytes);
+				cuda::device_set(d_b, &h_b[0], batch_num_bytes);
+			}
+
+			switch( op )
+			{
+			case GF2N_OP_ADD:
+			case GF2N_OP_SUB:
+				// the addition is chunk wise, so one launch covers the batch
+				cuda::parAdd(d_a, d_b, static_cast<uint32>(count * m_h_num_chunks), d_res);
+				break;
+			case GF2N_OP_MUL:
+				for( size_t i=0; i<count; ++i )
+					cuda::parMul(&d_a[i * m_h_num_chunks], &d_b[i * m_h_num_chunks], m_h_num_chunks, m_d_irred_poly, m_h_indx_mask_bit, &d_res[i * m_h_num_chunks]);
+				break;
+			case GF2N_OP_EXP:
+				for( size_t i=0; i<count; ++i )
+					cuda::parExponentiation(&d_a[i * m_h_num_chunks], value, m_h_num_chunks, m_d_irred_poly, m_h_field_size, &d_res[i * m_h_num_chunks]);
+				break;
+			case GF2N_OP_INVERSE:
+				for( size_t i=0; i<count; ++i )
+					cuda::parInverseElement(&d_a[i * m_h_num_chunks], m_h_num_chunks, m_d_irred_poly, &d_res[i * m_h_num_chunks]);
+				break;
+			}
+
+			cuda::device_get(&h_a[0], d_res, batch_num_bytes);
+
+			cuda::device_delete(d_a);
+			cuda::device_delete(d_res);
+			if( d_b )
+				cuda::device_delete(d_b);
+
+			for( size_t i=0; i<count; ++i )
+			{
+				for( uint32 j=0; j<num_limbs; ++j )
+					out[i * stride + j] = h_a[i * m_h_num_chunks + m_h_num_chunks - 1 - j];
+				std::fill(out + i * stride + num_limbs, out + (i + 1) * stride, 0);
+			}
 		}
 
 		GF2nArithmeticElement GF2nArithmeticCuda::getElement( const std::string value )
@@ -210,7 +393,7 @@ namespace libcumffa {
 			utils::convertStringToArray(value, CUDA_BIGNUM_SIZE_BITS, 
 				utils::calcNumberChunks<uint32>((CUDA_BIGNUM)value.length(), CUDA_BIGNUM_SIZE_BITS), str_arr_value);
 
-			CUDA_BIGNUM* vec_value = new CUDA_BIGNUM[m_h_num_bytes];
+			CUDA_BIGNUM* vec_value = allocAligned<CUDA_BIGNUM>(m_h_num_bytes);
 			uint32 i = 0;
 
 			for( auto str_arr_value_elem : str_arr_value )
@@ -229,7 +412,7 @@ namespace libcumffa {
 		{
 			assert(bytes_value <= m_h_num_chunks * CUDA_BIGNUM_SIZE_BYTES);
 
-			CUDA_BIGNUM* vec_value = new CUDA_BIGNUM[m_h_num_chunks];
+			CUDA_BIGNUM* vec_value = allocAligned<CUDA_BIGNUM>(m_h_num_chunks);
 			memset(vec_value, 0, m_h_num_chunks * CUDA_BIGNUM_SIZE_BYTES);
 			
 			std::copy_backward(value, value + bytes_value, ((unsigned char *)&vec_value[m_h_num_chunks]));
@@ -248,7 +431,7 @@ namespace libcumffa {
 		{
 			assert(chunks_value <= m_h_num_chunks * CUDA_BIGNUM_SIZE_BYTES);
 
-			CUDA_BIGNUM *vec_value = new CUDA_BIGNUM[m_h_num_chunks];
+			CUDA_BIGNUM *vec_value = allocAligned<CUDA_BIGNUM>(m_h_num_chunks);
 			memset(vec_value, 0, m_h_num_chunks * CUDA_BIGNUM_SIZE_BYTES);
 
 			CUDA_BIGNUM *value_p = (CUDA_BIGNUM *)value;
@@ -264,6 +447,27 @@ namespace libcumffa {
 			return element;			
 		}		
 
+		GF2nArithmeticElement GF2nArithmeticCuda::getElementFromLimbs( const ufixn *limbs )
+		{
+			uint32 num_limbs = getNumLimbs();
+
+			// the limbs are stored as numeric values on the device, so no
+			// byte swap is needed after the copy
+			std::vector<CUDA_BIGNUM> h_value(m_h_num_chunks, 0);
+			for( uint32 j=0; j<num_limbs; ++j )
+				h_value[m_h_num_chunks - 1 - j] = limbs[j];
+
+			GF2nArithmeticCudaDataPoolElement d_value = m_d_data_pool->get();
+			cuda::device_set(*d_value, &h_value[0], m_h_num_bytes);
+
+			GF2nCudaMetrics metrics;
+
+			GF2nArithmeticElement element = GF2nArithmeticElement(
+				new GF2nArithmeticElementCuda(NULL, d_value, m_h_field_size, m_h_num_chunks, m_h_num_bytes, m_d_irred_poly, m_h_indx_mask_bit, m_d_data_pool, m_async, metrics));
+
+			return element;
+		}
+
 		void GF2nArithmeticCuda::initDevice()
 		{
 			clearDevice();
@@ -367,7 +571,7 @@ namespace libcumffa {
 		{
 			// delete host values
 			if( m_h_value )
-				delete [] m_h_value;
+				freeAligned(m_h_value);
 		}
 
 		GF2nArithmeticElementInterface *GF2nArithmeticElementCuda::add( GF2nArithmeticElementInterface *other )
@@ -392,105 +596,80 @@ namespace libcumffa {
 
 		GF2nArithmeticElementInterface *GF2nArithmeticElementCuda::runWithElement( const std::string &what, GF2nArithmeticElementInterface *other )
 		{
-			if( what.compare("add") == 0 )
-			{
-				return parAdd(other);
-			}
-			if( what.compare("parAdd") == 0 )
+			return runWithElement(cuda::resolveOp(what), other);
+		}
+
+		GF2nArithmeticElementInterface *GF2nArithmeticElementCuda::runWithValue( const std::string &what, uint32 value )
+		{
+			return runWithValue(cuda::resolveOp(what), value);
+		}
+
+		GF2nArithmeticElementInterface *GF2nArithmeticElementCuda::runWithElement( const int32 op, GF2nArithmeticElementInterface *other )
+		{
+			switch( op )
 			{
+			case GF2N_OP_ADD:
+			case GF2N_OP_SUB:
+			case CUDA_OP_PAR_ADD:
 				return parAdd(other);
-			}
-			if( what.compare("parAddLoop") == 0 )
-			{
+			case CUDA_OP_PAR_ADD_LOOP:
 				return parAddLoop(other);
-			}
-			if( what.compare("parAddTime") == 0 )
-			{
+			case CUDA_OP_PAR_ADD_TIME:
 				return parAddTime(other);
-			}
-			if( what.compare("parAddWithEvents") == 0 )
-			{
+			case CUDA_OP_PAR_ADD_WITH_EVENTS:
 				return parAddWithEvents(other);
-			}
-			if( what.compare("parAddOwnStream") == 0 )
-			{
+			case CUDA_OP_PAR_ADD_OWN_STREAM:
 				return parAddOwnStream(other);
-			}	
-			if( what.compare("parAddOwnStream1024Threads") == 0 )
-			{
+			case CUDA_OP_PAR_ADD_OWN_STREAM_1024_THREADS:
 				return parAddOwnStream1024Threads(other);
-			}	
-			if( what.compare("parAddOwnStream512Threads") == 0 )
-			{
+			case CUDA_OP_PAR_ADD_OWN_STREAM_512_THREADS:
 				return parAddOwnStream512Threads(other);
-			}	
-			if( what.compare("parAddOwnStream256Threads") == 0 )
-			{
+			case CUDA_OP_PAR_ADD_OWN_STREAM_256_THREADS:
 				return parAddOwnStream256Threads(other);
-			}	
-			if( what.compare("parAddOwnStream128Threads") == 0 )
-			{
+			case CUDA_OP_PAR_ADD_OWN_STREAM_128_THREADS:
 				return parAddOwnStream128Threads(other);
-			}	
-			if( what.compare("parAdd2OwnStream") == 0 )
-			{
+			case CUDA_OP_PAR_ADD_2_OWN_STREAM:
 				return parAdd2OwnStream(other);
-			}			
-			if( what.compare("parAdd4OwnStream") == 0 )
-			{
+			case CUDA_OP_PAR_ADD_4_OWN_STREAM:
 				return parAdd4OwnStream(other);
-			}			
-			if( what.compare("parAdd8OwnStream") == 0 )
-			{
+			case CUDA_OP_PAR_ADD_8_OWN_STREAM:
 				return parAdd8OwnStream(other);
-			}			
-			if( what.compare("parAddSharedMem") == 0 )
-			{
+			case CUDA_OP_PAR_ADD_SHARED_MEM:
 				return parAddSharedMem(other);
-			}
-			else if( what.compare("parMul") == 0 )
-			{
+			case GF2N_OP_MUL:
+			case CUDA_OP_PAR_MUL:
 				return parMul(other);
-			}
-			else if( what.compare("parMulChunkedBarRed") == 0 )
-			{
+			case CUDA_OP_PAR_MUL_CHUNKED_BAR_RED:
 				return parMulChunkedBarRed(other);
-			}
-			else if( what.compare("measureKernelLaunchOverhead") == 0 )
-			{
+			case CUDA_OP_MEASURE_KERNEL_LAUNCH_OVERHEAD:
 				return measureKernelLaunchOverhead(other);
+			default:
+				throw MethodNotFoundException(cuda::opName(op));
 			}
-			else
-			{
-				throw MethodNotFoundException(what);
-			}	
 		}
 
-		GF2nArithmeticElementInterface *GF2nArithmeticElementCuda::runWithValue( const std::string &what, uint32 value )
+		GF2nArithmeticElementInterface *GF2nArithmeticElementCuda::runWithValue( const int32 op, uint32 value )
 		{
-			if( what.compare("parExponentiation") == 0 )
+			switch( op )
 			{
+			case GF2N_OP_EXP:
+			case CUDA_OP_PAR_EXPONENTIATION:
 				return parExponentiation(value);
-			}	
-			else if( what.compare("parInverseElement") == 0 )
-			{
+			case GF2N_OP_INVERSE:
+			case CUDA_OP_PAR_INVERSE_ELEMENT:
 				return parInverseElement(value);
-			}	
-			else if( what.compare("parInverseElementWithExp") == 0 )
-			{
+			case CUDA_OP_PAR_INVERSE_ELEMENT_WITH_EXP:
 				return parInverseElementWithExp(value);
-			}	
-			else
-			{
-				throw MethodNotFoundException(what);
-			}	
+			default:
+				throw MethodNotFoundException(cuda::opName(op));
+			}
 		}		
 
 		std::string GF2nArithmeticElementCuda::toString()
 		{
 			if( !m_h_value )
 			{
-				m_h_value = new CUDA_BIGNUM[m_h_num_bytes];
+				m_h_value = allocAligned<CUDA_BIGNUM>(m_h_num_bytes);
 				memset(m_h_value, 0, m_h_num_bytes);
 				m_h_metrics.copyToHost_time = cuda::device_get(m_h_value, *m_d_value, m_h_num_bytes);
 			}
@@ -521,7 +700,7 @@ namespace libcumffa {
 
 			if( !m_h_value )
 			{
-				m_h_value = new CUDA_BIGNUM[m_h_num_bytes];
+				m_h_value = allocAligned<CUDA_BIGNUM>(m_h_num_bytes);
 				memset(m_h_value, 0, m_h_num_bytes);
 				m_h_metrics.copyToHost_time = cuda::device_get(m_h_value, *device_value, m_h_num_bytes);
 			}
@@ -532,7 +711,30 @@ namespace libcumffa {
 
 			memcpy(&value[0], reinterpret_cast<uint8 *>(m_h_value)+(m_h_num_bytes-num_uint8_chunks), num_uint8_chunks);
 		}
+
+		void GF2nArithmeticElementCuda::getValue( uint8 *value, const size_t num_bytes )
+		{
+			std::vector<ufixn> limbs(utils::calcNumberChunks<uint32>(m_h_field_size, sizeof(ufixn) * 8));
+			if( !limbs.empty() )
+				getLimbs(&limbs[0], static_cast<uint32>(limbs.size()));
+
+			utils::limbsToBytes(limbs.data(), static_cast<uint32>(limbs.size()), GF2N_BIG_ENDIAN, value, num_bytes);
+		}
 		
+		void GF2nArithmeticElementCuda::getLimbs( ufixn *limbs, const uint32 num_limbs )
+		{
+			std::vector<CUDA_BIGNUM> h_value(m_h_num_chunks, 0);
+			cuda::device_get(&h_value[0], *m_d_value, m_h_num_bytes);
+
+			for( uint32 j=0; j<num_limbs; ++j )
+				limbs[j] = (j < m_h_num_chunks) ? h_value[m_h_num_chunks - 1 - j] : 0;
+		}
+
+		uint32 GF2nArithmeticElementCuda::getFieldSize()
+		{
+			return m_h_field_size;
+		}
+
 		std::string GF2nArithmeticElementCuda::getMetrics()
 		{
 			std::stringstream ss;
@@ -910,7 +1112,7 @@ namespace libcumffa {
 		{
 			if( !m_h_value )
 			{
-				m_h_value = new CUDA_BIGNUM[m_h_num_bytes];
+				m_h_value = allocAligned<CUDA_BIGNUM>(m_h_num_bytes);
 				memset(m_h_value, 0, m_h_num_bytes);
 				m_h_metrics.copyToHost_time = cuda::device_get(m_h_value, *m_d_value, m_h_num_bytes);
 			}
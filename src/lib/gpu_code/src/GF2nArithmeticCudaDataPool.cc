@@ -25,80 +25,64 @@
 namespace libcumffa {
 	namespace gpu {
 
+		///////////////////////////////////////////////////////////////////////
+		/*
+			implementations of GF2nCudaSlabAllocator
+		*/
+		void *GF2nCudaSlabAllocator::allocate( const size_t num_bytes )
+		{
+			CUDA_BIGNUM *slab = NULL;
+			cuda::device_allocate(&slab, static_cast<uint32>(num_bytes));
+			return slab;
+		}
+
+		void GF2nCudaSlabAllocator::free( void *slab )
+		{
+			cuda::device_delete(static_cast<CUDA_BIGNUM *>(slab));
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		/*
+			implementations of GF2nArithmeticCudaDataPool
+		*/
 		GF2nArithmeticCudaDataPool::GF2nArithmeticCudaDataPool()
-		: m_h_num_bytes(0)
-		, m_h_data_pool_size(0) {}
+		{
+		}
 
 		GF2nArithmeticCudaDataPool::GF2nArithmeticCudaDataPool( uint32 num_bytes, uint32 data_pool_size ) 
-		: m_h_num_bytes(num_bytes)
-		, m_h_data_pool_size(data_pool_size)
+		: m_d_pool(std::make_shared<GF2nLimbPool>(num_bytes, data_pool_size, std::make_shared<GF2nCudaSlabAllocator>()))
 		{
-			cuda::device_allocate(&m_d_data_pool, m_h_num_bytes * m_h_data_pool_size);
-			for( uint32 i=0; i<data_pool_size; ++i ) 
-			{
-				m_h_data_pool_free.push_back(i);
-			}
 		}
 
 		GF2nArithmeticCudaDataPool::~GF2nArithmeticCudaDataPool()
 		{
-			cuda::device_delete(m_d_data_pool);
-			
-			for( std::map<CUDA_BIGNUM, void *>::iterator it = m_h_data_pool_refs.begin(); it != m_h_data_pool_refs.end(); ++it )
-			{
-				reinterpret_cast<GF2nArithmeticCudaDataPoolElementData *>(it->second)->invalidate();	
-				m_h_data_pool_refs.erase(it->first);
-			}
-			m_h_data_pool_free.clear();
-			m_h_data_pool_used.clear();
 		}
 
 		GF2nArithmeticCudaDataPoolElement GF2nArithmeticCudaDataPool::get() 
 		{
-			// TODO: no free data element available? -> create more?
-			if( m_h_data_pool_free.empty() )
-				throw EmptyDataPoolException();	
-
-			CUDA_BIGNUM next_data_pool_el = m_h_data_pool_free.front();
-			m_h_data_pool_used.push_back(next_data_pool_el);
-			m_h_data_pool_free.pop_front();
-
-			GF2nArithmeticCudaDataPoolElementData *newData = new GF2nArithmeticCudaDataPoolElementData(&m_d_data_pool[next_data_pool_el * m_h_num_bytes / sizeof(CUDA_BIGNUM)], next_data_pool_el, this);
-			m_h_data_pool_refs[next_data_pool_el] = newData;
-			return GF2nArithmeticCudaDataPoolElement(newData);
-		}		
+			uint32 pool_element = m_d_pool->get();
+			return GF2nArithmeticCudaDataPoolElement(new GF2nArithmeticCudaDataPoolElementData(pool_element, m_d_pool));
+		}
 
-		void GF2nArithmeticCudaDataPool::free( uint32 pool_element )
+		GF2nLimbPoolStats GF2nArithmeticCudaDataPool::getStats() const
 		{
-			m_h_data_pool_used.remove(pool_element);
-			m_h_data_pool_refs.erase(pool_element);
-			m_h_data_pool_free.push_back(pool_element);
+			return m_d_pool->getStats();
 		}
 
 		///////////////////////////////////////////////////////////////////////
 		/*
 			implementations of GF2nArithmeticCudaDataPoolElementData
 		*/
-		GF2nArithmeticCudaDataPoolElementData::GF2nArithmeticCudaDataPoolElementData( CUDA_BIGNUM *data, uint32 pool_element, GF2nArithmeticCudaDataPool *parent )
-		: m_data(data)
+		GF2nArithmeticCudaDataPoolElementData::GF2nArithmeticCudaDataPoolElementData( uint32 pool_element, std::shared_ptr<GF2nLimbPool> const& pool )
+		: m_data(static_cast<CUDA_BIGNUM *>(pool->getData(pool_element)))
 		, m_pool_element(pool_element)
-		, m_parent(parent) 
-		, m_isValid(true)
+		, m_pool(pool)
 		{
 		}
 
-
 		GF2nArithmeticCudaDataPoolElementData::~GF2nArithmeticCudaDataPoolElementData()
 		{
-			if( m_isValid )
-			{
-				m_parent->free(m_pool_element);
-			}
-		}
-
-		void GF2nArithmeticCudaDataPoolElementData::invalidate()
-		{
-			m_isValid = false;
+			m_pool->free(m_pool_element);
 		}
 
 		CUDA_BIGNUM *GF2nArithmeticCudaDataPoolElementData::getData()
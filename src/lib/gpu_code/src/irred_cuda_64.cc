@@ -1,37936 +0,0 @@
-#if OS_SIZE == 64
-#pragma message("compiling irred_cuda64.cc")
-// This file is auto-generated by gen_irreps.cc, don't modify
-#include "CumffaTypes.h"
-#include <iostream>
-#include <cstdlib>
-#include <vector>
-using namespace std;
-void set_irrep_cuda(vector<ufixn> &p, uint32 n) {
-switch (n) {
-case 1: {
-p.push_back(2ULL);
-} break;
-case 2: {
-p.push_back(7ULL);
-} break;
-case 3: {
-p.push_back(11ULL);
-} break;
-case 4: {
-p.push_back(19ULL);
-} break;
-case 5: {
-p.push_back(37ULL);
-} break;
-case 6: {
-p.push_back(67ULL);
-} break;
-case 7: {
-p.push_back(131ULL);
-} break;
-case 8: {
-p.push_back(283ULL);
-} break;
-case 9: {
-p.push_back(515ULL);
-} break;
-case 10: {
-p.push_back(1033ULL);
-} break;
-case 11: {
-p.push_back(2053ULL);
-} break;
-case 12: {
-p.push_back(4105ULL);
-} break;
-case 13: {
-p.push_back(8219ULL);
-} break;
-case 14: {
-p.push_back(16417ULL);
-} break;
-case 15: {
-p.push_back(32771ULL);
-} break;
-case 16: {
-p.push_back(65579ULL);
-} break;
-case 17: {
-p.push_back(131081ULL);
-} break;
-case 18: {
-p.push_back(262153ULL);
-} break;
-case 19: {
-p.push_back(524327ULL);
-} break;
-case 20: {
-p.push_back(1048585ULL);
-} break;
-case 21: {
-p.push_back(2097157ULL);
-} break;
-case 22: {
-p.push_back(4194307ULL);
-} break;
-case 23: {
-p.push_back(8388641ULL);
-} break;
-case 24: {
-p.push_back(16777243ULL);
-} break;
-case 25: {
-p.push_back(33554441ULL);
-} break;
-case 26: {
-p.push_back(67108891ULL);
-} break;
-case 27: {
-p.push_back(134217767ULL);
-} break;
-case 28: {
-p.push_back(268435459ULL);
-} break;
-case 29: {
-p.push_back(536870917ULL);
-} break;
-case 30: {
-p.push_back(1073741827ULL);
-} break;
-case 31: {
-p.push_back(2147483657ULL);
-} break;
-case 32: {
-p.push_back(4294967437ULL);
-} break;
-case 33: {
-p.push_back(8589935617ULL);
-} break;
-case 34: {
-p.push_back(17179869313ULL);
-} break;
-case 35: {
-p.push_back(34359738373ULL);
-} break;
-case 36: {
-p.push_back(68719477249ULL);
-} break;
-case 37: {
-p.push_back(137438953555ULL);
-} break;
-case 38: {
-p.push_back(274877907043ULL);
-} break;
-case 39: {
-p.push_back(549755813905ULL);
-} break;
-case 40: {
-p.push_back(1099511627833ULL);
-} break;
-case 41: {
-p.push_back(2199023255561ULL);
-} break;
-case 42: {
-p.push_back(4398046511233ULL);
-} break;
-case 43: {
-p.push_back(8796093022297ULL);
-} break;
-case 44: {
-p.push_back(17592186044449ULL);
-} break;
-case 45: {
-p.push_back(35184372088859ULL);
-} break;
-case 46: {
-p.push_back(70368744177667ULL);
-} break;
-case 47: {
-p.push_back(140737488355361ULL);
-} break;
-case 48: {
-p.push_back(281474976710701ULL);
-} break;
-case 49: {
-p.push_back(562949953421825ULL);
-} break;
-case 50: {
-p.push_back(1125899906842653ULL);
-} break;
-case 51: {
-p.push_back(2251799813685323ULL);
-} break;
-case 52: {
-p.push_back(4503599627370505ULL);
-} break;
-case 53: {
-p.push_back(9007199254741063ULL);
-} break;
-case 54: {
-p.push_back(18014398509482497ULL);
-} break;
-case 55: {
-p.push_back(36028797018964097ULL);
-} break;
-case 56: {
-p.push_back(72057594037928085ULL);
-} break;
-case 57: {
-p.push_back(144115188075855889ULL);
-} break;
-case 58: {
-p.push_back(288230376152236033ULL);
-} break;
-case 59: {
-p.push_back(576460752303423637ULL);
-} break;
-case 60: {
-p.push_back(1152921504606846979ULL);
-} break;
-case 61: {
-p.push_back(2305843009213693991ULL);
-} break;
-case 62: {
-p.push_back(4611686018964258817ULL);
-} break;
-case 63: {
-p.push_back(9223372036854775811ULL);
-} break;
-case 64: {
-p.push_back(1ULL);
-p.push_back(27ULL);
-} break;
-case 65: {
-p.push_back(2ULL);
-p.push_back(262145ULL);
-} break;
-case 66: {
-p.push_back(4ULL);
-p.push_back(9ULL);
-} break;
-case 67: {
-p.push_back(8ULL);
-p.push_back(39ULL);
-} break;
-case 68: {
-p.push_back(16ULL);
-p.push_back(513ULL);
-} break;
-case 69: {
-p.push_back(32ULL);
-p.push_back(101ULL);
-} break;
-case 70: {
-p.push_back(64ULL);
-p.push_back(43ULL);
-} break;
-case 71: {
-p.push_back(128ULL);
-p.push_back(65ULL);
-} break;
-case 72: {
-p.push_back(256ULL);
-p.push_back(1545ULL);
-} break;
-case 73: {
-p.push_back(512ULL);
-p.push_back(33554433ULL);
-} break;
-case 74: {
-p.push_back(1024ULL);
-p.push_back(34359738369ULL);
-} break;
-case 75: {
-p.push_back(2048ULL);
-p.push_back(75ULL);
-} break;
-case 76: {
-p.push_back(4096ULL);
-p.push_back(2097153ULL);
-} break;
-case 77: {
-p.push_back(8192ULL);
-p.push_back(101ULL);
-} break;
-case 78: {
-p.push_back(16384ULL);
-p.push_back(105ULL);
-} break;
-case 79: {
-p.push_back(32768ULL);
-p.push_back(513ULL);
-} break;
-case 80: {
-p.push_back(65536ULL);
-p.push_back(533ULL);
-} break;
-case 81: {
-p.push_back(131072ULL);
-p.push_back(17ULL);
-} break;
-case 82: {
-p.push_back(262144ULL);
-p.push_back(267ULL);
-} break;
-case 83: {
-p.push_back(524288ULL);
-p.push_back(149ULL);
-} break;
-case 84: {
-p.push_back(1048576ULL);
-p.push_back(33ULL);
-} break;
-case 85: {
-p.push_back(2097152ULL);
-p.push_back(263ULL);
-} break;
-case 86: {
-p.push_back(4194304ULL);
-p.push_back(2097153ULL);
-} break;
-case 87: {
-p.push_back(8388608ULL);
-p.push_back(8193ULL);
-} break;
-case 88: {
-p.push_back(16777216ULL);
-p.push_back(197ULL);
-} break;
-case 89: {
-p.push_back(33554432ULL);
-p.push_back(274877906945ULL);
-} break;
-case 90: {
-p.push_back(67108864ULL);
-p.push_back(134217729ULL);
-} break;
-case 91: {
-p.push_back(134217728ULL);
-p.push_back(291ULL);
-} break;
-case 92: {
-p.push_back(268435456ULL);
-p.push_back(2097153ULL);
-} break;
-case 93: {
-p.push_back(536870912ULL);
-p.push_back(5ULL);
-} break;
-case 94: {
-p.push_back(1073741824ULL);
-p.push_back(2097153ULL);
-} break;
-case 95: {
-p.push_back(2147483648ULL);
-p.push_back(2049ULL);
-} break;
-case 96: {
-p.push_back(4294967296ULL);
-p.push_back(1601ULL);
-} break;
-case 97: {
-p.push_back(8589934592ULL);
-p.push_back(65ULL);
-} break;
-case 98: {
-p.push_back(17179869184ULL);
-p.push_back(2049ULL);
-} break;
-case 99: {
-p.push_back(34359738368ULL);
-p.push_back(75ULL);
-} break;
-case 100: {
-p.push_back(68719476736ULL);
-p.push_back(32769ULL);
-} break;
-case 101: {
-p.push_back(137438953472ULL);
-p.push_back(195ULL);
-} break;
-case 102: {
-p.push_back(274877906944ULL);
-p.push_back(536870913ULL);
-} break;
-case 103: {
-p.push_back(549755813888ULL);
-p.push_back(513ULL);
-} break;
-case 104: {
-p.push_back(1099511627776ULL);
-p.push_back(27ULL);
-} break;
-case 105: {
-p.push_back(2199023255552ULL);
-p.push_back(17ULL);
-} break;
-case 106: {
-p.push_back(4398046511104ULL);
-p.push_back(32769ULL);
-} break;
-case 107: {
-p.push_back(8796093022208ULL);
-p.push_back(657ULL);
-} break;
-case 108: {
-p.push_back(17592186044416ULL);
-p.push_back(131073ULL);
-} break;
-case 109: {
-p.push_back(35184372088832ULL);
-p.push_back(53ULL);
-} break;
-case 110: {
-p.push_back(70368744177664ULL);
-p.push_back(8589934593ULL);
-} break;
-case 111: {
-p.push_back(140737488355328ULL);
-p.push_back(1025ULL);
-} break;
-case 112: {
-p.push_back(281474976710656ULL);
-p.push_back(57ULL);
-} break;
-case 113: {
-p.push_back(562949953421312ULL);
-p.push_back(513ULL);
-} break;
-case 114: {
-p.push_back(1125899906842624ULL);
-p.push_back(45ULL);
-} break;
-case 115: {
-p.push_back(2251799813685248ULL);
-p.push_back(417ULL);
-} break;
-case 116: {
-p.push_back(4503599627370496ULL);
-p.push_back(23ULL);
-} break;
-case 117: {
-p.push_back(9007199254740992ULL);
-p.push_back(39ULL);
-} break;
-case 118: {
-p.push_back(18014398509481984ULL);
-p.push_back(8589934593ULL);
-} break;
-case 119: {
-p.push_back(36028797018963968ULL);
-p.push_back(257ULL);
-} break;
-case 120: {
-p.push_back(72057594037927936ULL);
-p.push_back(27ULL);
-} break;
-case 121: {
-p.push_back(144115188075855872ULL);
-p.push_back(262145ULL);
-} break;
-case 122: {
-p.push_back(288230376151711744ULL);
-p.push_back(71ULL);
-} break;
-case 123: {
-p.push_back(576460752303423488ULL);
-p.push_back(5ULL);
-} break;
-case 124: {
-p.push_back(1152921504606846976ULL);
-p.push_back(524289ULL);
-} break;
-case 125: {
-p.push_back(2305843009213693952ULL);
-p.push_back(225ULL);
-} break;
-case 126: {
-p.push_back(4611686018427387904ULL);
-p.push_back(2097153ULL);
-} break;
-case 127: {
-p.push_back(9223372036854775808ULL);
-p.push_back(3ULL);
-} break;
-case 128: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(135ULL);
-} break;
-case 129: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(33ULL);
-} break;
-case 130: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(9ULL);
-} break;
-case 131: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(269ULL);
-} break;
-case 132: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(131073ULL);
-} break;
-case 133: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(773ULL);
-} break;
-case 134: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(144115188075855873ULL);
-} break;
-case 135: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(2049ULL);
-} break;
-case 136: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(45ULL);
-} break;
-case 137: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(2097153ULL);
-} break;
-case 138: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(387ULL);
-} break;
-case 139: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(297ULL);
-} break;
-case 140: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(32769ULL);
-} break;
-case 141: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(1043ULL);
-} break;
-case 142: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(2097153ULL);
-} break;
-case 143: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(45ULL);
-} break;
-case 144: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(149ULL);
-} break;
-case 145: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(4503599627370497ULL);
-} break;
-case 146: {
-p.push_back(262144ULL);
-p.push_back(128ULL);
-p.push_back(1ULL);
-} break;
-case 147: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(16385ULL);
-} break;
-case 148: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(134217729ULL);
-} break;
-case 149: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(1665ULL);
-} break;
-case 150: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740993ULL);
-} break;
-case 151: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(9ULL);
-} break;
-case 152: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(77ULL);
-} break;
-case 153: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(3ULL);
-} break;
-case 154: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(32769ULL);
-} break;
-case 155: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(4611686018427387905ULL);
-} break;
-case 156: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 157: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(101ULL);
-} break;
-case 158: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(353ULL);
-} break;
-case 159: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(2147483649ULL);
-} break;
-case 160: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(45ULL);
-} break;
-case 161: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(262145ULL);
-} break;
-case 162: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(134217729ULL);
-} break;
-case 163: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(201ULL);
-} break;
-case 164: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(1409ULL);
-} break;
-case 165: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(777ULL);
-} break;
-case 166: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(137438953473ULL);
-} break;
-case 167: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(65ULL);
-} break;
-case 168: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(32781ULL);
-} break;
-case 169: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(17179869185ULL);
-} break;
-case 170: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(2049ULL);
-} break;
-case 171: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(101ULL);
-} break;
-case 172: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(3ULL);
-} break;
-case 173: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(293ULL);
-} break;
-case 174: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(8193ULL);
-} break;
-case 175: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(65ULL);
-} break;
-case 176: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(2061ULL);
-} break;
-case 177: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(257ULL);
-} break;
-case 178: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(2147483649ULL);
-} break;
-case 179: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(23ULL);
-} break;
-case 180: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(9ULL);
-} break;
-case 181: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(195ULL);
-} break;
-case 182: {
-p.push_back(18014398509481984ULL);
-p.push_back(131072ULL);
-p.push_back(1ULL);
-} break;
-case 183: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(72057594037927937ULL);
-} break;
-case 184: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(897ULL);
-} break;
-case 185: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(16777217ULL);
-} break;
-case 186: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(2049ULL);
-} break;
-case 187: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(225ULL);
-} break;
-case 188: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(101ULL);
-} break;
-case 189: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(101ULL);
-} break;
-case 190: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(449ULL);
-} break;
-case 191: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 192: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(135ULL);
-} break;
-case 193: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32769ULL);
-} break;
-case 194: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(8388608ULL);
-p.push_back(1ULL);
-} break;
-case 195: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(269ULL);
-} break;
-case 196: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9ULL);
-} break;
-case 197: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(533ULL);
-} break;
-case 198: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 199: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17179869185ULL);
-} break;
-case 200: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(45ULL);
-} break;
-case 201: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16385ULL);
-} break;
-case 202: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963969ULL);
-} break;
-case 203: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(387ULL);
-} break;
-case 204: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217729ULL);
-} break;
-case 205: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549ULL);
-} break;
-case 206: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1569ULL);
-} break;
-case 207: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022209ULL);
-} break;
-case 208: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(523ULL);
-} break;
-case 209: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65ULL);
-} break;
-case 210: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(129ULL);
-} break;
-case 211: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3329ULL);
-} break;
-case 212: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(1ULL);
-} break;
-case 213: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(101ULL);
-} break;
-case 214: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(1ULL);
-} break;
-case 215: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388609ULL);
-} break;
-case 216: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(139ULL);
-} break;
-case 217: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088833ULL);
-} break;
-case 218: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2049ULL);
-} break;
-case 219: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(275ULL);
-} break;
-case 220: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(129ULL);
-} break;
-case 221: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(325ULL);
-} break;
-case 222: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(53ULL);
-} break;
-case 223: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934593ULL);
-} break;
-case 224: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(777ULL);
-} break;
-case 225: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4294967297ULL);
-} break;
-case 226: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1161ULL);
-} break;
-case 227: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1553ULL);
-} break;
-case 228: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(562949953421312ULL);
-p.push_back(1ULL);
-} break;
-case 229: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1043ULL);
-} break;
-case 230: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(449ULL);
-} break;
-case 231: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67108865ULL);
-} break;
-case 232: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(533ULL);
-} break;
-case 233: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(1024ULL);
-p.push_back(1ULL);
-} break;
-case 234: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483649ULL);
-} break;
-case 235: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(579ULL);
-} break;
-case 236: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33ULL);
-} break;
-case 237: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(147ULL);
-} break;
-case 238: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(1ULL);
-} break;
-case 239: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(68719476737ULL);
-} break;
-case 240: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(297ULL);
-} break;
-case 241: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(64ULL);
-p.push_back(1ULL);
-} break;
-case 242: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(2147483648ULL);
-p.push_back(1ULL);
-} break;
-case 243: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(291ULL);
-} break;
-case 244: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(140737488355328ULL);
-p.push_back(1ULL);
-} break;
-case 245: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(83ULL);
-} break;
-case 246: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2055ULL);
-} break;
-case 247: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(262144ULL);
-p.push_back(1ULL);
-} break;
-case 248: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(50177ULL);
-} break;
-case 249: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738369ULL);
-} break;
-case 250: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(1ULL);
-} break;
-case 251: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(149ULL);
-} break;
-case 252: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32769ULL);
-} break;
-case 253: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(70368744177665ULL);
-} break;
-case 254: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(135ULL);
-} break;
-case 255: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4503599627370497ULL);
-} break;
-case 256: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1061ULL);
-} break;
-case 257: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4097ULL);
-} break;
-case 258: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(1ULL);
-} break;
-case 259: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1093ULL);
-} break;
-case 260: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32769ULL);
-} break;
-case 261: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(209ULL);
-} break;
-case 262: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(785ULL);
-} break;
-case 263: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(1ULL);
-} break;
-case 264: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(581ULL);
-} break;
-case 265: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4398046511105ULL);
-} break;
-case 266: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(140737488355329ULL);
-} break;
-case 267: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(329ULL);
-} break;
-case 268: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554433ULL);
-} break;
-case 269: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(195ULL);
-} break;
-case 270: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740993ULL);
-} break;
-case 271: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(288230376151711745ULL);
-} break;
-case 272: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(525ULL);
-} break;
-case 273: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388609ULL);
-} break;
-case 274: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(1ULL);
-} break;
-case 275: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3585ULL);
-} break;
-case 276: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775809ULL);
-} break;
-case 277: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4169ULL);
-} break;
-case 278: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33ULL);
-} break;
-case 279: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33ULL);
-} break;
-case 280: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549ULL);
-} break;
-case 281: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(1ULL);
-} break;
-case 282: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738369ULL);
-} break;
-case 283: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4257ULL);
-} break;
-case 284: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740993ULL);
-} break;
-case 285: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1185ULL);
-} break;
-case 286: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32ULL);
-p.push_back(1ULL);
-} break;
-case 287: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(1ULL);
-} break;
-case 288: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3075ULL);
-} break;
-case 289: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097153ULL);
-} break;
-case 290: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(45ULL);
-} break;
-case 291: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(6177ULL);
-} break;
-case 292: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953473ULL);
-} break;
-case 293: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2115ULL);
-} break;
-case 294: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934593ULL);
-} break;
-case 295: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(281474976710657ULL);
-} break;
-case 296: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(141ULL);
-} break;
-case 297: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33ULL);
-} break;
-case 298: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2321ULL);
-} break;
-case 299: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2129ULL);
-} break;
-case 300: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33ULL);
-} break;
-case 301: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549ULL);
-} break;
-case 302: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255553ULL);
-} break;
-case 303: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3ULL);
-} break;
-case 304: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2055ULL);
-} break;
-case 305: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(274877906944ULL);
-p.push_back(1ULL);
-} break;
-case 306: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(139ULL);
-} break;
-case 307: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(277ULL);
-} break;
-case 308: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32769ULL);
-} break;
-case 309: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1105ULL);
-} break;
-case 310: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(1ULL);
-} break;
-case 311: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(169ULL);
-} break;
-case 312: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(657ULL);
-} break;
-case 313: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(1ULL);
-} break;
-case 314: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32769ULL);
-} break;
-case 315: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1539ULL);
-} break;
-case 316: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775809ULL);
-} break;
-case 317: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(149ULL);
-} break;
-case 318: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088833ULL);
-} break;
-case 319: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(68719476737ULL);
-} break;
-case 320: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(27ULL);
-} break;
-case 321: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483649ULL);
-} break;
-case 322: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(1ULL);
-} break;
-case 323: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1035ULL);
-} break;
-case 324: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685249ULL);
-} break;
-case 325: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1061ULL);
-} break;
-case 326: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1035ULL);
-} break;
-case 327: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17179869185ULL);
-} break;
-case 328: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(267ULL);
-} break;
-case 329: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1125899906842625ULL);
-} break;
-case 330: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738368ULL);
-p.push_back(1ULL);
-} break;
-case 331: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1093ULL);
-} break;
-case 332: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(1ULL);
-} break;
-case 333: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5ULL);
-} break;
-case 334: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(39ULL);
-} break;
-case 335: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1157ULL);
-} break;
-case 336: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(147ULL);
-} break;
-case 337: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963969ULL);
-} break;
-case 338: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(27ULL);
-} break;
-case 339: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(66689ULL);
-} break;
-case 340: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088833ULL);
-} break;
-case 341: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1345ULL);
-} break;
-case 342: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(1ULL);
-} break;
-case 343: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(1ULL);
-} break;
-case 344: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(135ULL);
-} break;
-case 345: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4194305ULL);
-} break;
-case 346: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775809ULL);
-} break;
-case 347: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3081ULL);
-} break;
-case 348: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(1ULL);
-} break;
-case 349: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(101ULL);
-} break;
-case 350: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740993ULL);
-} break;
-case 351: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17179869185ULL);
-} break;
-case 352: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(10305ULL);
-} break;
-case 353: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32ULL);
-p.push_back(1ULL);
-} break;
-case 354: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738368ULL);
-p.push_back(1ULL);
-} break;
-case 355: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(99ULL);
-} break;
-case 356: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1665ULL);
-} break;
-case 357: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3077ULL);
-} break;
-case 358: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(144115188075855873ULL);
-} break;
-case 359: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16ULL);
-p.push_back(1ULL);
-} break;
-case 360: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(45ULL);
-} break;
-case 361: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(147ULL);
-} break;
-case 362: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775809ULL);
-} break;
-case 363: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(297ULL);
-} break;
-case 364: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 365: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(609ULL);
-} break;
-case 366: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870913ULL);
-} break;
-case 367: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097153ULL);
-} break;
-case 368: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(141ULL);
-} break;
-case 369: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(1ULL);
-} break;
-case 370: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 371: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(269ULL);
-} break;
-case 372: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(140737488355328ULL);
-p.push_back(1ULL);
-} break;
-case 373: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(389ULL);
-} break;
-case 374: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(353ULL);
-} break;
-case 375: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65537ULL);
-} break;
-case 376: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(417ULL);
-} break;
-case 377: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255553ULL);
-} break;
-case 378: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022209ULL);
-} break;
-case 379: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1313ULL);
-} break;
-case 380: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(140737488355329ULL);
-} break;
-case 381: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(39ULL);
-} break;
-case 382: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131072ULL);
-p.push_back(1ULL);
-} break;
-case 383: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67108864ULL);
-p.push_back(1ULL);
-} break;
-case 384: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4109ULL);
-} break;
-case 385: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65ULL);
-} break;
-case 386: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(1ULL);
-} break;
-case 387: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(387ULL);
-} break;
-case 388: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 389: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1569ULL);
-} break;
-case 390: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 391: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(268435457ULL);
-} break;
-case 392: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9281ULL);
-} break;
-case 393: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(129ULL);
-} break;
-case 394: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 395: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2145ULL);
-} break;
-case 396: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554433ULL);
-} break;
-case 397: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4289ULL);
-} break;
-case 398: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(197ULL);
-} break;
-case 399: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67108865ULL);
-} break;
-case 400: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(45ULL);
-} break;
-case 401: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 402: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 403: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(801ULL);
-} break;
-case 404: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2ULL);
-p.push_back(1ULL);
-} break;
-case 405: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8453ULL);
-} break;
-case 406: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 407: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(1ULL);
-} break;
-case 408: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(45ULL);
-} break;
-case 409: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388608ULL);
-p.push_back(1ULL);
-} break;
-case 410: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1049ULL);
-} break;
-case 411: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5129ULL);
-} break;
-case 412: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 413: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1217ULL);
-} break;
-case 414: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8193ULL);
-} break;
-case 415: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(274877906944ULL);
-p.push_back(1ULL);
-} break;
-case 416: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549ULL);
-} break;
-case 417: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(1ULL);
-} break;
-case 418: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 419: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32817ULL);
-} break;
-case 420: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(129ULL);
-} break;
-case 421: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(53ULL);
-} break;
-case 422: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 423: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554433ULL);
-} break;
-case 424: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(645ULL);
-} break;
-case 425: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4097ULL);
-} break;
-case 426: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775809ULL);
-} break;
-case 427: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2145ULL);
-} break;
-case 428: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(1ULL);
-} break;
-case 429: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1409ULL);
-} break;
-case 430: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16451ULL);
-} break;
-case 431: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(72057594037927936ULL);
-p.push_back(1ULL);
-} break;
-case 432: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8217ULL);
-} break;
-case 433: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934593ULL);
-} break;
-case 434: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(6177ULL);
-} break;
-case 435: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4641ULL);
-} break;
-case 436: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 437: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(71ULL);
-} break;
-case 438: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2ULL);
-p.push_back(1ULL);
-} break;
-case 439: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421313ULL);
-} break;
-case 440: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(27ULL);
-} break;
-case 441: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(129ULL);
-} break;
-case 442: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(165ULL);
-} break;
-case 443: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1091ULL);
-} break;
-case 444: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131072ULL);
-p.push_back(1ULL);
-} break;
-case 445: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(209ULL);
-} break;
-case 446: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(1ULL);
-} break;
-case 447: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(1ULL);
-} break;
-case 448: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2129ULL);
-} break;
-case 449: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 450: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(140737488355329ULL);
-} break;
-case 451: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(66563ULL);
-} break;
-case 452: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(113ULL);
-} break;
-case 453: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32849ULL);
-} break;
-case 454: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(323ULL);
-} break;
-case 455: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(274877906945ULL);
-} break;
-case 456: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(262721ULL);
-} break;
-case 457: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65537ULL);
-} break;
-case 458: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 459: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4133ULL);
-} break;
-case 460: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524289ULL);
-} break;
-case 461: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(195ULL);
-} break;
-case 462: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(1ULL);
-} break;
-case 463: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(1ULL);
-} break;
-case 464: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(794625ULL);
-} break;
-case 465: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483649ULL);
-} break;
-case 466: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(18497ULL);
-} break;
-case 467: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2115ULL);
-} break;
-case 468: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217729ULL);
-} break;
-case 469: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549ULL);
-} break;
-case 470: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 471: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3ULL);
-} break;
-case 472: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2061ULL);
-} break;
-case 473: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 474: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 475: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(785ULL);
-} break;
-case 476: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 477: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(98433ULL);
-} break;
-case 478: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(144115188075855872ULL);
-p.push_back(1ULL);
-} break;
-case 479: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1099511627776ULL);
-p.push_back(1ULL);
-} break;
-case 480: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33345ULL);
-} break;
-case 481: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 482: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(609ULL);
-} break;
-case 483: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(593ULL);
-} break;
-case 484: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(1ULL);
-} break;
-case 485: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(196673ULL);
-} break;
-case 486: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131072ULL);
-p.push_back(1ULL);
-} break;
-case 487: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1073741824ULL);
-p.push_back(1ULL);
-} break;
-case 488: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(27ULL);
-} break;
-case 489: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(1ULL);
-} break;
-case 490: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 491: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2121ULL);
-} break;
-case 492: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(129ULL);
-} break;
-case 493: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1065ULL);
-} break;
-case 494: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131073ULL);
-} break;
-case 495: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4096ULL);
-p.push_back(1ULL);
-} break;
-case 496: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65573ULL);
-} break;
-case 497: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16384ULL);
-p.push_back(1ULL);
-} break;
-case 498: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 499: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2145ULL);
-} break;
-case 500: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217729ULL);
-} break;
-case 501: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(53ULL);
-} break;
-case 502: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(305ULL);
-} break;
-case 503: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9ULL);
-} break;
-case 504: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(49217ULL);
-} break;
-case 505: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 506: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388609ULL);
-} break;
-case 507: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8265ULL);
-} break;
-case 508: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 509: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(393ULL);
-} break;
-case 510: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32ULL);
-p.push_back(1ULL);
-} break;
-case 511: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1025ULL);
-} break;
-case 512: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(293ULL);
-} break;
-case 513: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67108865ULL);
-} break;
-case 514: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(1ULL);
-} break;
-case 515: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16529ULL);
-} break;
-case 516: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097153ULL);
-} break;
-case 517: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5125ULL);
-} break;
-case 518: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934593ULL);
-} break;
-case 519: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(1ULL);
-} break;
-case 520: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34821ULL);
-} break;
-case 521: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4294967297ULL);
-} break;
-case 522: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813889ULL);
-} break;
-case 523: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8261ULL);
-} break;
-case 524: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 525: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(83ULL);
-} break;
-case 526: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934592ULL);
-p.push_back(1ULL);
-} break;
-case 527: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(140737488355329ULL);
-} break;
-case 528: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2117ULL);
-} break;
-case 529: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4398046511105ULL);
-} break;
-case 530: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1161ULL);
-} break;
-case 531: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1073ULL);
-} break;
-case 532: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3ULL);
-} break;
-case 533: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(29ULL);
-} break;
-case 534: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 535: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(325ULL);
-} break;
-case 536: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(169ULL);
-} break;
-case 537: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1073741824ULL);
-p.push_back(1ULL);
-} break;
-case 538: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 539: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1073ULL);
-} break;
-case 540: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 541: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9233ULL);
-} break;
-case 542: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(323ULL);
-} break;
-case 543: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65537ULL);
-} break;
-case 544: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(267ULL);
-} break;
-case 545: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(288230376151711744ULL);
-p.push_back(1ULL);
-} break;
-case 546: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(263ULL);
-} break;
-case 547: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8337ULL);
-} break;
-case 548: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1065ULL);
-} break;
-case 549: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65561ULL);
-} break;
-case 550: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 551: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 552: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(590337ULL);
-} break;
-case 553: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813889ULL);
-} break;
-case 554: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1409ULL);
-} break;
-case 555: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1553ULL);
-} break;
-case 556: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 557: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(225ULL);
-} break;
-case 558: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(1ULL);
-} break;
-case 559: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17179869185ULL);
-} break;
-case 560: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2625ULL);
-} break;
-case 561: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(1ULL);
-} break;
-case 562: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2069ULL);
-} break;
-case 563: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16521ULL);
-} break;
-case 564: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 565: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2115ULL);
-} break;
-case 566: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 567: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(268435457ULL);
-} break;
-case 568: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32961ULL);
-} break;
-case 569: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(1ULL);
-} break;
-case 570: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(1ULL);
-} break;
-case 571: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1061ULL);
-} break;
-case 572: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4355ULL);
-} break;
-case 573: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1105ULL);
-} break;
-case 574: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8193ULL);
-} break;
-case 575: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 576: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8217ULL);
-} break;
-case 577: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554433ULL);
-} break;
-case 578: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(12648449ULL);
-} break;
-case 579: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4737ULL);
-} break;
-case 580: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 581: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8385ULL);
-} break;
-case 582: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097152ULL);
-p.push_back(1ULL);
-} break;
-case 583: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 584: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(24585ULL);
-} break;
-case 585: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16777216ULL);
-p.push_back(1ULL);
-} break;
-case 586: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(165ULL);
-} break;
-case 587: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2115ULL);
-} break;
-case 588: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738369ULL);
-} break;
-case 589: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1049ULL);
-} break;
-case 590: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(1ULL);
-} break;
-case 591: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(593ULL);
-} break;
-case 592: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8265ULL);
-} break;
-case 593: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4194304ULL);
-p.push_back(1ULL);
-} break;
-case 594: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524289ULL);
-} break;
-case 595: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(519ULL);
-} break;
-case 596: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 597: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(20993ULL);
-} break;
-case 598: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(195ULL);
-} break;
-case 599: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1073741825ULL);
-} break;
-case 600: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549ULL);
-} break;
-case 601: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 602: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 603: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(89ULL);
-} break;
-case 604: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(1ULL);
-} break;
-case 605: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1185ULL);
-} break;
-case 606: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 607: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(1ULL);
-} break;
-case 608: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(532545ULL);
-} break;
-case 609: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483649ULL);
-} break;
-case 610: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775808ULL);
-p.push_back(1ULL);
-} break;
-case 611: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1045ULL);
-} break;
-case 612: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131072ULL);
-p.push_back(1ULL);
-} break;
-case 613: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(525329ULL);
-} break;
-case 614: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088833ULL);
-} break;
-case 615: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 616: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(525321ULL);
-} break;
-case 617: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 618: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 619: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(801ULL);
-} break;
-case 620: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 621: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4193ULL);
-} break;
-case 622: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 623: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16ULL);
-p.push_back(1ULL);
-} break;
-case 624: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2145ULL);
-} break;
-case 625: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 626: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 627: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8465ULL);
-} break;
-case 628: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 629: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(101ULL);
-} break;
-case 630: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(149ULL);
-} break;
-case 631: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 632: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(519ULL);
-} break;
-case 633: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(1ULL);
-} break;
-case 634: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813889ULL);
-} break;
-case 635: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17425ULL);
-} break;
-case 636: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 637: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16899ULL);
-} break;
-case 638: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(99ULL);
-} break;
-case 639: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65537ULL);
-} break;
-case 640: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16397ULL);
-} break;
-case 641: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2049ULL);
-} break;
-case 642: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(1ULL);
-} break;
-case 643: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2061ULL);
-} break;
-case 644: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2145ULL);
-} break;
-case 645: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2321ULL);
-} break;
-case 646: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 647: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33ULL);
-} break;
-case 648: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8203ULL);
-} break;
-case 649: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953473ULL);
-} break;
-case 650: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9ULL);
-} break;
-case 651: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16385ULL);
-} break;
-case 652: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(1ULL);
-} break;
-case 653: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1409ULL);
-} break;
-case 654: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934593ULL);
-} break;
-case 655: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16777216ULL);
-p.push_back(1ULL);
-} break;
-case 656: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(177ULL);
-} break;
-case 657: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(274877906945ULL);
-} break;
-case 658: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963969ULL);
-} break;
-case 659: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32789ULL);
-} break;
-case 660: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2049ULL);
-} break;
-case 661: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(6161ULL);
-} break;
-case 662: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097153ULL);
-} break;
-case 663: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(1ULL);
-} break;
-case 664: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2817ULL);
-} break;
-case 665: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934593ULL);
-} break;
-case 666: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1157ULL);
-} break;
-case 667: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(262281ULL);
-} break;
-case 668: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 669: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(53ULL);
-} break;
-case 670: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 671: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32769ULL);
-} break;
-case 672: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2145ULL);
-} break;
-case 673: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(268435457ULL);
-} break;
-case 674: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2193ULL);
-} break;
-case 675: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(75ULL);
-} break;
-case 676: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483649ULL);
-} break;
-case 677: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(281ULL);
-} break;
-case 678: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32809ULL);
-} break;
-case 679: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4ULL);
-p.push_back(1ULL);
-} break;
-case 680: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8454657ULL);
-} break;
-case 681: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2569ULL);
-} break;
-case 682: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 683: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2115ULL);
-} break;
-case 684: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 685: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(27ULL);
-} break;
-case 686: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 687: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8193ULL);
-} break;
-case 688: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(540737ULL);
-} break;
-case 689: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16385ULL);
-} break;
-case 690: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(1ULL);
-} break;
-case 691: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8261ULL);
-} break;
-case 692: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 693: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33029ULL);
-} break;
-case 694: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 695: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 696: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8389637ULL);
-} break;
-case 697: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 698: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 699: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33795ULL);
-} break;
-case 700: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(1ULL);
-} break;
-case 701: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65557ULL);
-} break;
-case 702: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953473ULL);
-} break;
-case 703: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4227ULL);
-} break;
-case 704: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(269ULL);
-} break;
-case 705: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131073ULL);
-} break;
-case 706: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(6401ULL);
-} break;
-case 707: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33057ULL);
-} break;
-case 708: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32769ULL);
-} break;
-case 709: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(27ULL);
-} break;
-case 710: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(12305ULL);
-} break;
-case 711: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(268435456ULL);
-p.push_back(1ULL);
-} break;
-case 712: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(57ULL);
-} break;
-case 713: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255553ULL);
-} break;
-case 714: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388609ULL);
-} break;
-case 715: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(147ULL);
-} break;
-case 716: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 717: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65667ULL);
-} break;
-case 718: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 719: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 720: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(593ULL);
-} break;
-case 721: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 722: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 723: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(66577ULL);
-} break;
-case 724: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 725: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(609ULL);
-} break;
-case 726: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33ULL);
-} break;
-case 727: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 728: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(29ULL);
-} break;
-case 729: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(288230376151711745ULL);
-} break;
-case 730: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 731: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(325ULL);
-} break;
-case 732: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 733: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(389ULL);
-} break;
-case 734: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2115ULL);
-} break;
-case 735: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17592186044417ULL);
-} break;
-case 736: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8513ULL);
-} break;
-case 737: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33ULL);
-} break;
-case 738: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 739: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(327937ULL);
-} break;
-case 740: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 741: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(777ULL);
-} break;
-case 742: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097152ULL);
-p.push_back(1ULL);
-} break;
-case 743: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67108864ULL);
-p.push_back(1ULL);
-} break;
-case 744: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(10243ULL);
-} break;
-case 745: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 746: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 747: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1105ULL);
-} break;
-case 748: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524289ULL);
-} break;
-case 749: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(195ULL);
-} break;
-case 750: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 751: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(262145ULL);
-} break;
-case 752: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9225ULL);
-} break;
-case 753: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 754: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524289ULL);
-} break;
-case 755: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5123ULL);
-} break;
-case 756: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088833ULL);
-} break;
-case 757: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(195ULL);
-} break;
-case 758: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 759: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17179869184ULL);
-p.push_back(1ULL);
-} break;
-case 760: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2145ULL);
-} break;
-case 761: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9ULL);
-} break;
-case 762: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(1ULL);
-} break;
-case 763: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(82433ULL);
-} break;
-case 764: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(105ULL);
-} break;
-case 765: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(657ULL);
-} break;
-case 766: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4719105ULL);
-} break;
-case 767: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 768: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(655377ULL);
-} break;
-case 769: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(72057594037927936ULL);
-p.push_back(1ULL);
-} break;
-case 770: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16421ULL);
-} break;
-case 771: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(163905ULL);
-} break;
-case 772: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(129ULL);
-} break;
-case 773: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1345ULL);
-} break;
-case 774: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 775: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(1ULL);
-} break;
-case 776: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(49281ULL);
-} break;
-case 777: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870913ULL);
-} break;
-case 778: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 779: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1289ULL);
-} break;
-case 780: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8193ULL);
-} break;
-case 781: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(196613ULL);
-} break;
-case 782: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 783: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16ULL);
-p.push_back(1ULL);
-} break;
-case 784: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8769ULL);
-} break;
-case 785: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(268435456ULL);
-p.push_back(1ULL);
-} break;
-case 786: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5129ULL);
-} break;
-case 787: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(201ULL);
-} break;
-case 788: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(132105ULL);
-} break;
-case 789: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(39ULL);
-} break;
-case 790: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(579ULL);
-} break;
-case 791: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1073741825ULL);
-} break;
-case 792: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(649ULL);
-} break;
-case 793: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 794: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 795: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(147ULL);
-} break;
-case 796: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(531ULL);
-} break;
-case 797: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5137ULL);
-} break;
-case 798: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740993ULL);
-} break;
-case 799: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554433ULL);
-} break;
-case 800: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(643ULL);
-} break;
-case 801: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 802: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(41473ULL);
-} break;
-case 803: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16901ULL);
-} break;
-case 804: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(1ULL);
-} break;
-case 805: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(389ULL);
-} break;
-case 806: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097153ULL);
-} break;
-case 807: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(129ULL);
-} break;
-case 808: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16397ULL);
-} break;
-case 809: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32769ULL);
-} break;
-case 810: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 811: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5377ULL);
-} break;
-case 812: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870913ULL);
-} break;
-case 813: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1035ULL);
-} break;
-case 814: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097153ULL);
-} break;
-case 815: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 816: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2309ULL);
-} break;
-case 817: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4503599627370497ULL);
-} break;
-case 818: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(1ULL);
-} break;
-case 819: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(66177ULL);
-} break;
-case 820: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(576460752303423488ULL);
-p.push_back(1ULL);
-} break;
-case 821: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34821ULL);
-} break;
-case 822: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131073ULL);
-} break;
-case 823: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 824: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2129ULL);
-} break;
-case 825: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(274877906945ULL);
-} break;
-case 826: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 827: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5249ULL);
-} break;
-case 828: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 829: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(27ULL);
-} break;
-case 830: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(132225ULL);
-} break;
-case 831: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421313ULL);
-} break;
-case 832: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8229ULL);
-} break;
-case 833: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 834: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32769ULL);
-} break;
-case 835: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16545ULL);
-} break;
-case 836: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1541ULL);
-} break;
-case 837: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(353ULL);
-} break;
-case 838: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693953ULL);
-} break;
-case 839: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(18014398509481985ULL);
-} break;
-case 840: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2083ULL);
-} break;
-case 841: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 842: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(140737488355329ULL);
-} break;
-case 843: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3201ULL);
-} break;
-case 844: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(1ULL);
-} break;
-case 845: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5ULL);
-} break;
-case 846: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(1ULL);
-} break;
-case 847: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 848: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2067ULL);
-} break;
-case 849: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 850: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(140737488355328ULL);
-p.push_back(1ULL);
-} break;
-case 851: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9249ULL);
-} break;
-case 852: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 853: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1155ULL);
-} break;
-case 854: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(169ULL);
-} break;
-case 855: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870913ULL);
-} break;
-case 856: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(525321ULL);
-} break;
-case 857: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(1ULL);
-} break;
-case 858: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 859: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(163857ULL);
-} break;
-case 860: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738369ULL);
-} break;
-case 861: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16385ULL);
-} break;
-case 862: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 863: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(77ULL);
-} break;
-case 864: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2098241ULL);
-} break;
-case 865: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3ULL);
-} break;
-case 866: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(1ULL);
-} break;
-case 867: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549ULL);
-} break;
-case 868: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 869: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2241ULL);
-} break;
-case 870: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 871: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 872: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8203ULL);
-} break;
-case 873: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 874: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4241ULL);
-} break;
-case 875: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4355ULL);
-} break;
-case 876: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 877: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(113ULL);
-} break;
-case 878: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4865ULL);
-} break;
-case 879: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2049ULL);
-} break;
-case 880: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32929ULL);
-} break;
-case 881: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16384ULL);
-p.push_back(1ULL);
-} break;
-case 882: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738368ULL);
-p.push_back(1ULL);
-} break;
-case 883: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(200705ULL);
-} break;
-case 884: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 885: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(387ULL);
-} break;
-case 886: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8961ULL);
-} break;
-case 887: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 888: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(787457ULL);
-} break;
-case 889: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775808ULL);
-p.push_back(1ULL);
-} break;
-case 890: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 891: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4115ULL);
-} break;
-case 892: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483649ULL);
-} break;
-case 893: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2369ULL);
-} break;
-case 894: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 895: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4097ULL);
-} break;
-case 896: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(169ULL);
-} break;
-case 897: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421312ULL);
-p.push_back(1ULL);
-} break;
-case 898: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 899: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(294945ULL);
-} break;
-case 900: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3ULL);
-} break;
-case 901: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8385ULL);
-} break;
-case 902: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097153ULL);
-} break;
-case 903: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738369ULL);
-} break;
-case 904: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4229ULL);
-} break;
-case 905: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740992ULL);
-p.push_back(1ULL);
-} break;
-case 906: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(576460752303423488ULL);
-p.push_back(1ULL);
-} break;
-case 907: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5125ULL);
-} break;
-case 908: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 909: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16403ULL);
-} break;
-case 910: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33409ULL);
-} break;
-case 911: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 912: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(163ULL);
-} break;
-case 913: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(1ULL);
-} break;
-case 914: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(23ULL);
-} break;
-case 915: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(329ULL);
-} break;
-case 916: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 917: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5249ULL);
-} break;
-case 918: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(1ULL);
-} break;
-case 919: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(68719476737ULL);
-} break;
-case 920: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16961ULL);
-} break;
-case 921: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 922: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(225ULL);
-} break;
-case 923: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(90113ULL);
-} break;
-case 924: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483649ULL);
-} break;
-case 925: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(98433ULL);
-} break;
-case 926: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 927: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 928: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1037ULL);
-} break;
-case 929: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2073ULL);
-} break;
-case 930: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483649ULL);
-} break;
-case 931: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1553ULL);
-} break;
-case 932: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 933: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65603ULL);
-} break;
-case 934: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4194401ULL);
-} break;
-case 935: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 936: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(45057ULL);
-} break;
-case 937: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 938: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 939: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(177ULL);
-} break;
-case 940: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1155ULL);
-} break;
-case 941: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2115ULL);
-} break;
-case 942: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088833ULL);
-} break;
-case 943: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16777217ULL);
-} break;
-case 944: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(6657ULL);
-} break;
-case 945: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(1ULL);
-} break;
-case 946: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3153921ULL);
-} break;
-case 947: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(609ULL);
-} break;
-case 948: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 949: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(269ULL);
-} break;
-case 950: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(13313ULL);
-} break;
-case 951: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 952: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(66177ULL);
-} break;
-case 953: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 954: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 955: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(201ULL);
-} break;
-case 956: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 957: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1601ULL);
-} break;
-case 958: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8721ULL);
-} break;
-case 959: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 960: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4617ULL);
-} break;
-case 961: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(262145ULL);
-} break;
-case 962: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33057ULL);
-} break;
-case 963: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1049153ULL);
-} break;
-case 964: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(1ULL);
-} break;
-case 965: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32789ULL);
-} break;
-case 966: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 967: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(68719476737ULL);
-} break;
-case 968: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549ULL);
-} break;
-case 969: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483649ULL);
-} break;
-case 970: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2181ULL);
-} break;
-case 971: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(71ULL);
-} break;
-case 972: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(129ULL);
-} break;
-case 973: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8273ULL);
-} break;
-case 974: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(897ULL);
-} break;
-case 975: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524289ULL);
-} break;
-case 976: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(132161ULL);
-} break;
-case 977: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32769ULL);
-} break;
-case 978: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(523ULL);
-} break;
-case 979: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 980: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(449ULL);
-} break;
-case 981: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4193ULL);
-} break;
-case 982: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 983: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 984: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16777737ULL);
-} break;
-case 985: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 986: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9ULL);
-} break;
-case 987: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(77825ULL);
-} break;
-case 988: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(144115188075855872ULL);
-p.push_back(1ULL);
-} break;
-case 989: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1045ULL);
-} break;
-case 990: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 991: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813889ULL);
-} break;
-case 992: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(172033ULL);
-} break;
-case 993: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4611686018427387905ULL);
-} break;
-case 994: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 995: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36869ULL);
-} break;
-case 996: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2ULL);
-p.push_back(1ULL);
-} break;
-case 997: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4169ULL);
-} break;
-case 998: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(1ULL);
-} break;
-case 999: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(576460752303423489ULL);
-} break;
-case 1000: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(57ULL);
-} break;
-case 1001: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131073ULL);
-} break;
-case 1002: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(45ULL);
-} break;
-case 1003: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8457ULL);
-} break;
-case 1004: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1665ULL);
-} break;
-case 1005: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4357ULL);
-} break;
-case 1006: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(57ULL);
-} break;
-case 1007: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(1ULL);
-} break;
-case 1008: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(655617ULL);
-} break;
-case 1009: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963969ULL);
-} break;
-case 1010: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738368ULL);
-p.push_back(1ULL);
-} break;
-case 1011: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1169ULL);
-} break;
-case 1012: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685248ULL);
-p.push_back(1ULL);
-} break;
-case 1013: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(833ULL);
-} break;
-case 1014: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1015: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1016: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32841ULL);
-} break;
-case 1017: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(531ULL);
-} break;
-case 1018: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5153ULL);
-} break;
-case 1019: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1283ULL);
-} break;
-case 1020: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1021: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(39ULL);
-} break;
-case 1022: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1023: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(129ULL);
-} break;
-case 1024: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524355ULL);
-} break;
-case 1025: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1026: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738369ULL);
-} break;
-case 1027: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(12353ULL);
-} break;
-case 1028: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(1ULL);
-} break;
-case 1029: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17179869184ULL);
-p.push_back(1ULL);
-} break;
-case 1030: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(1ULL);
-} break;
-case 1031: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16ULL);
-p.push_back(1ULL);
-} break;
-case 1032: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2129929ULL);
-} break;
-case 1033: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17592186044416ULL);
-p.push_back(1ULL);
-} break;
-case 1034: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(1ULL);
-} break;
-case 1035: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4193ULL);
-} break;
-case 1036: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1037: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4229ULL);
-} break;
-case 1038: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8325ULL);
-} break;
-case 1039: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097153ULL);
-} break;
-case 1040: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34049ULL);
-} break;
-case 1041: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1042: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1043: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1217ULL);
-} break;
-case 1044: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255553ULL);
-} break;
-case 1045: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8769ULL);
-} break;
-case 1046: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(293ULL);
-} break;
-case 1047: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1025ULL);
-} break;
-case 1048: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32901ULL);
-} break;
-case 1049: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1050: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1051: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(13313ULL);
-} break;
-case 1052: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1053: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1539ULL);
-} break;
-case 1054: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(1ULL);
-} break;
-case 1055: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16777217ULL);
-} break;
-case 1056: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2055ULL);
-} break;
-case 1057: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1058: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217729ULL);
-} break;
-case 1059: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(75ULL);
-} break;
-case 1060: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1061: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1035ULL);
-} break;
-case 1062: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421313ULL);
-} break;
-case 1063: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1064: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(10753ULL);
-} break;
-case 1065: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1066: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1545ULL);
-} break;
-case 1067: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8961ULL);
-} break;
-case 1068: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33033ULL);
-} break;
-case 1069: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(327937ULL);
-} break;
-case 1070: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(51201ULL);
-} break;
-case 1071: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(129ULL);
-} break;
-case 1072: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(525057ULL);
-} break;
-case 1073: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4169ULL);
-} break;
-case 1074: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(153ULL);
-} break;
-case 1075: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(49185ULL);
-} break;
-case 1076: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(329ULL);
-} break;
-case 1077: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1665ULL);
-} break;
-case 1078: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1079: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1080: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33345ULL);
-} break;
-case 1081: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16777217ULL);
-} break;
-case 1082: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1083: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65669ULL);
-} break;
-case 1084: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1085: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4611686018427387905ULL);
-} break;
-case 1086: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1087: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(281474976710656ULL);
-p.push_back(1ULL);
-} break;
-case 1088: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(6292481ULL);
-} break;
-case 1089: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(1ULL);
-} break;
-case 1090: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(1ULL);
-} break;
-case 1091: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5153ULL);
-} break;
-case 1092: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388609ULL);
-} break;
-case 1093: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(195ULL);
-} break;
-case 1094: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(144115188075855873ULL);
-} break;
-case 1095: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1096: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16810049ULL);
-} break;
-case 1097: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16385ULL);
-} break;
-case 1098: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(1ULL);
-} break;
-case 1099: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(66051ULL);
-} break;
-case 1100: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738369ULL);
-} break;
-case 1101: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(657ULL);
-} break;
-case 1102: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740992ULL);
-p.push_back(1ULL);
-} break;
-case 1103: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2ULL);
-p.push_back(1ULL);
-} break;
-case 1104: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097729ULL);
-} break;
-case 1105: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097153ULL);
-} break;
-case 1106: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1107: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8391681ULL);
-} break;
-case 1108: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1109: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(147465ULL);
-} break;
-case 1110: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1111: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8193ULL);
-} break;
-case 1112: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33089ULL);
-} break;
-case 1113: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(1ULL);
-} break;
-case 1114: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(525377ULL);
-} break;
-case 1115: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(294921ULL);
-} break;
-case 1116: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(576460752303423489ULL);
-} break;
-case 1117: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5137ULL);
-} break;
-case 1118: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(673ULL);
-} break;
-case 1119: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1120: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8769ULL);
-} break;
-case 1121: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4611686018427387905ULL);
-} break;
-case 1122: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1123: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16521ULL);
-} break;
-case 1124: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(401ULL);
-} break;
-case 1125: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33033ULL);
-} break;
-case 1126: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(1ULL);
-} break;
-case 1127: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217729ULL);
-} break;
-case 1128: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(139ULL);
-} break;
-case 1129: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(1ULL);
-} break;
-case 1130: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1131: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1091ULL);
-} break;
-case 1132: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(83ULL);
-} break;
-case 1133: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2129ULL);
-} break;
-case 1134: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1135: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 1136: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(533ULL);
-} break;
-case 1137: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1138: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483649ULL);
-} break;
-case 1139: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(12321ULL);
-} break;
-case 1140: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1141: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4233ULL);
-} break;
-case 1142: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1143: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(135ULL);
-} break;
-case 1144: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2689ULL);
-} break;
-case 1145: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1146: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1147: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(201ULL);
-} break;
-case 1148: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388609ULL);
-} break;
-case 1149: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1179657ULL);
-} break;
-case 1150: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8211ULL);
-} break;
-case 1151: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67108864ULL);
-p.push_back(1ULL);
-} break;
-case 1152: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32781ULL);
-} break;
-case 1153: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1154: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(1ULL);
-} break;
-case 1155: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8259ULL);
-} break;
-case 1156: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1157: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(393ULL);
-} break;
-case 1158: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1159: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4ULL);
-p.push_back(1ULL);
-} break;
-case 1160: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34821ULL);
-} break;
-case 1161: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1162: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(329729ULL);
-} break;
-case 1163: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3075ULL);
-} break;
-case 1164: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524289ULL);
-} break;
-case 1165: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(323ULL);
-} break;
-case 1166: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1167: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1168: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4229ULL);
-} break;
-case 1169: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1125899906842624ULL);
-p.push_back(1ULL);
-} break;
-case 1170: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217729ULL);
-} break;
-case 1171: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(99ULL);
-} break;
-case 1172: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32805ULL);
-} break;
-case 1173: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(147489ULL);
-} break;
-case 1174: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1175: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1176: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2569ULL);
-} break;
-case 1177: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65537ULL);
-} break;
-case 1178: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1179: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33089ULL);
-} break;
-case 1180: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554433ULL);
-} break;
-case 1181: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(133185ULL);
-} break;
-case 1182: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(1ULL);
-} break;
-case 1183: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388608ULL);
-p.push_back(1ULL);
-} break;
-case 1184: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(45ULL);
-} break;
-case 1185: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1186: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1187: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8465ULL);
-} break;
-case 1188: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(1ULL);
-} break;
-case 1189: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(267ULL);
-} break;
-case 1190: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1191: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1192: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(897ULL);
-} break;
-case 1193: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1194: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(53249ULL);
-} break;
-case 1195: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8289ULL);
-} break;
-case 1196: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1197: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(773ULL);
-} break;
-case 1198: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1199: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1125899906842624ULL);
-p.push_back(1ULL);
-} break;
-case 1200: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33345ULL);
-} break;
-case 1201: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1202: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1203: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(277ULL);
-} break;
-case 1204: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022209ULL);
-} break;
-case 1205: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(23ULL);
-} break;
-case 1206: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1207: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1208: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3137ULL);
-} break;
-case 1209: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(18014398509481984ULL);
-p.push_back(1ULL);
-} break;
-case 1210: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1211: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16515ULL);
-} break;
-case 1212: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1213: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549ULL);
-} break;
-case 1214: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1215: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1216: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(167772673ULL);
-} break;
-case 1217: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1218: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(1ULL);
-} break;
-case 1219: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5185ULL);
-} break;
-case 1220: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1221: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(49665ULL);
-} break;
-case 1222: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(327683ULL);
-} break;
-case 1223: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1224: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4737ULL);
-} break;
-case 1225: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1226: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1227: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(74753ULL);
-} break;
-case 1228: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217729ULL);
-} break;
-case 1229: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32837ULL);
-} break;
-case 1230: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1231: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(1ULL);
-} break;
-case 1232: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33555461ULL);
-} break;
-case 1233: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1234: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1235: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8961ULL);
-} break;
-case 1236: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421313ULL);
-} break;
-case 1237: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1105ULL);
-} break;
-case 1238: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1239: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17ULL);
-} break;
-case 1240: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131233ULL);
-} break;
-case 1241: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(18014398509481985ULL);
-} break;
-case 1242: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1243: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(98307ULL);
-} break;
-case 1244: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(82049ULL);
-} break;
-case 1245: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8259ULL);
-} break;
-case 1246: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554433ULL);
-} break;
-case 1247: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16385ULL);
-} break;
-case 1248: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32809ULL);
-} break;
-case 1249: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1250: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(41985ULL);
-} break;
-case 1251: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9249ULL);
-} break;
-case 1252: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934592ULL);
-p.push_back(1ULL);
-} break;
-case 1253: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3585ULL);
-} break;
-case 1254: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(525329ULL);
-} break;
-case 1255: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1256: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3221225477ULL);
-} break;
-case 1257: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1258: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(593ULL);
-} break;
-case 1259: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2369ULL);
-} break;
-case 1260: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097153ULL);
-} break;
-case 1261: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(147ULL);
-} break;
-case 1262: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(149ULL);
-} break;
-case 1263: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(1ULL);
-} break;
-case 1264: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(45ULL);
-} break;
-case 1265: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(1ULL);
-} break;
-case 1266: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(129ULL);
-} break;
-case 1267: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549ULL);
-} break;
-case 1268: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1269: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(132353ULL);
-} break;
-case 1270: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1271: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131073ULL);
-} break;
-case 1272: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(66177ULL);
-} break;
-case 1273: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1274: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(40977ULL);
-} break;
-case 1275: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3075ULL);
-} break;
-case 1276: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1277: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(265217ULL);
-} break;
-case 1278: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1279: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1280: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4257ULL);
-} break;
-case 1281: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1282: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1283: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4617ULL);
-} break;
-case 1284: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1285: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1539ULL);
-} break;
-case 1286: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1287: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1288: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8454209ULL);
-} break;
-case 1289: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738368ULL);
-p.push_back(1ULL);
-} break;
-case 1290: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1049ULL);
-} break;
-case 1291: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(785ULL);
-} break;
-case 1292: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5123ULL);
-} break;
-case 1293: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16961ULL);
-} break;
-case 1294: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1295: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(274877906945ULL);
-} break;
-case 1296: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(49157ULL);
-} break;
-case 1297: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1298: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1299: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(18465ULL);
-} break;
-case 1300: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(1ULL);
-} break;
-case 1301: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3075ULL);
-} break;
-case 1302: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(1ULL);
-} break;
-case 1303: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(69889ULL);
-} break;
-case 1304: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1212417ULL);
-} break;
-case 1305: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1306: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813889ULL);
-} break;
-case 1307: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(20993ULL);
-} break;
-case 1308: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1309: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(269ULL);
-} break;
-case 1310: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1311: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1312: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(49157ULL);
-} break;
-case 1313: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1314: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524289ULL);
-} break;
-case 1315: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4117ULL);
-} break;
-case 1316: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(329ULL);
-} break;
-case 1317: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(12297ULL);
-} break;
-case 1318: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(6177ULL);
-} break;
-case 1319: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1320: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4617ULL);
-} break;
-case 1321: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4503599627370497ULL);
-} break;
-case 1322: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1289ULL);
-} break;
-case 1323: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(196613ULL);
-} break;
-case 1324: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1325: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4617ULL);
-} break;
-case 1326: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1327: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1328: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2099209ULL);
-} break;
-case 1329: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(1ULL);
-} break;
-case 1330: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2115ULL);
-} break;
-case 1331: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(177ULL);
-} break;
-case 1332: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483648ULL);
-p.push_back(1ULL);
-} break;
-case 1333: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2061ULL);
-} break;
-case 1334: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1335: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1336: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(269ULL);
-} break;
-case 1337: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(1ULL);
-} break;
-case 1338: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1339: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32849ULL);
-} break;
-case 1340: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(1ULL);
-} break;
-case 1341: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(101ULL);
-} break;
-case 1342: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33409ULL);
-} break;
-case 1343: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1344: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32835ULL);
-} break;
-case 1345: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1346: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(77ULL);
-} break;
-case 1347: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1665ULL);
-} break;
-case 1348: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1349: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17425ULL);
-} break;
-case 1350: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1351: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813889ULL);
-} break;
-case 1352: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(147521ULL);
-} break;
-case 1353: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1354: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1355: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(275ULL);
-} break;
-case 1356: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1357: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16451ULL);
-} break;
-case 1358: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740992ULL);
-p.push_back(1ULL);
-} break;
-case 1359: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17179869184ULL);
-p.push_back(1ULL);
-} break;
-case 1360: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(45ULL);
-} break;
-case 1361: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(72057594037927937ULL);
-} break;
-case 1362: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1363: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549ULL);
-} break;
-case 1364: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1365: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2321ULL);
-} break;
-case 1366: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3ULL);
-} break;
-case 1367: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1368: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33313ULL);
-} break;
-case 1369: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16777216ULL);
-p.push_back(1ULL);
-} break;
-case 1370: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1065ULL);
-} break;
-case 1371: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1553ULL);
-} break;
-case 1372: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1373: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34821ULL);
-} break;
-case 1374: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1375: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4503599627370497ULL);
-} break;
-case 1376: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(787457ULL);
-} break;
-case 1377: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(68719476736ULL);
-p.push_back(1ULL);
-} break;
-case 1378: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(201ULL);
-} break;
-case 1379: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33029ULL);
-} break;
-case 1380: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1381: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(262337ULL);
-} break;
-case 1382: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1541ULL);
-} break;
-case 1383: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1384: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2083ULL);
-} break;
-case 1385: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4097ULL);
-} break;
-case 1386: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1387: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9345ULL);
-} break;
-case 1388: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2049ULL);
-} break;
-case 1389: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524817ULL);
-} break;
-case 1390: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1391: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9ULL);
-} break;
-case 1392: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(163873ULL);
-} break;
-case 1393: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1394: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(139777ULL);
-} break;
-case 1395: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16481ULL);
-} break;
-case 1396: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934592ULL);
-p.push_back(1ULL);
-} break;
-case 1397: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8457ULL);
-} break;
-case 1398: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1399: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963969ULL);
-} break;
-case 1400: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(267ULL);
-} break;
-case 1401: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(268435456ULL);
-p.push_back(1ULL);
-} break;
-case 1402: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775808ULL);
-p.push_back(1ULL);
-} break;
-case 1403: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(6149ULL);
-} break;
-case 1404: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131072ULL);
-p.push_back(1ULL);
-} break;
-case 1405: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34049ULL);
-} break;
-case 1406: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8199ULL);
-} break;
-case 1407: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(140737488355329ULL);
-} break;
-case 1408: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(24641ULL);
-} break;
-case 1409: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1410: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1411: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33572865ULL);
-} break;
-case 1412: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(1ULL);
-} break;
-case 1413: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1638401ULL);
-} break;
-case 1414: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1415: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1416: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1601ULL);
-} break;
-case 1417: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1418: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(45ULL);
-} break;
-case 1419: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33297ULL);
-} break;
-case 1420: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934593ULL);
-} break;
-case 1421: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(533ULL);
-} break;
-case 1422: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421313ULL);
-} break;
-case 1423: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32769ULL);
-} break;
-case 1424: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2117ULL);
-} break;
-case 1425: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(268435457ULL);
-} break;
-case 1426: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(1ULL);
-} break;
-case 1427: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(393473ULL);
-} break;
-case 1428: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217729ULL);
-} break;
-case 1429: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2145ULL);
-} break;
-case 1430: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934593ULL);
-} break;
-case 1431: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131073ULL);
-} break;
-case 1432: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3137ULL);
-} break;
-case 1433: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1434: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1435: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34305ULL);
-} break;
-case 1436: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(1ULL);
-} break;
-case 1437: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(209ULL);
-} break;
-case 1438: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1439: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(12305ULL);
-} break;
-case 1440: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(24705ULL);
-} break;
-case 1441: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1442: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1443: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65571ULL);
-} break;
-case 1444: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1445: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9225ULL);
-} break;
-case 1446: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1447: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1448: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2061ULL);
-} break;
-case 1449: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8193ULL);
-} break;
-case 1450: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(69641ULL);
-} break;
-case 1451: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16395ULL);
-} break;
-case 1452: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1453: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67109921ULL);
-} break;
-case 1454: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1455: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4503599627370497ULL);
-} break;
-case 1456: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(533ULL);
-} break;
-case 1457: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1458: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1459: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(82433ULL);
-} break;
-case 1460: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1461: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4137ULL);
-} break;
-case 1462: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8229ULL);
-} break;
-case 1463: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1464: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4617ULL);
-} break;
-case 1465: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813889ULL);
-} break;
-case 1466: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1467: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8229ULL);
-} break;
-case 1468: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1469: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1327105ULL);
-} break;
-case 1470: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421313ULL);
-} break;
-case 1471: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554433ULL);
-} break;
-case 1472: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2067ULL);
-} break;
-case 1473: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(1ULL);
-} break;
-case 1474: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134145ULL);
-} break;
-case 1475: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(49409ULL);
-} break;
-case 1476: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097153ULL);
-} break;
-case 1477: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(132129ULL);
-} break;
-case 1478: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32ULL);
-p.push_back(1ULL);
-} break;
-case 1479: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421313ULL);
-} break;
-case 1480: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3077ULL);
-} break;
-case 1481: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4294967297ULL);
-} break;
-case 1482: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1483: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2162697ULL);
-} break;
-case 1484: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2193ULL);
-} break;
-case 1485: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4195337ULL);
-} break;
-case 1486: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097152ULL);
-p.push_back(1ULL);
-} break;
-case 1487: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1488: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(833ULL);
-} break;
-case 1489: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1490: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1491: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549ULL);
-} break;
-case 1492: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1493: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(132113ULL);
-} break;
-case 1494: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(12801ULL);
-} break;
-case 1495: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1073741824ULL);
-p.push_back(1ULL);
-} break;
-case 1496: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(10257ULL);
-} break;
-case 1497: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421313ULL);
-} break;
-case 1498: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134145ULL);
-} break;
-case 1499: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(69665ULL);
-} break;
-case 1500: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554433ULL);
-} break;
-case 1501: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(101ULL);
-} break;
-case 1502: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4131ULL);
-} break;
-case 1503: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65536ULL);
-p.push_back(1ULL);
-} break;
-case 1504: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(269ULL);
-} break;
-case 1505: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1506: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2085ULL);
-} break;
-case 1507: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3077ULL);
-} break;
-case 1508: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1509: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(267265ULL);
-} break;
-case 1510: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1511: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1512: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1545ULL);
-} break;
-case 1513: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1514: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1515: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9281ULL);
-} break;
-case 1516: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1517: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9281ULL);
-} break;
-case 1518: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32ULL);
-p.push_back(1ULL);
-} break;
-case 1519: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1520: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9225ULL);
-} break;
-case 1521: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1522: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(265217ULL);
-} break;
-case 1523: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(98307ULL);
-} break;
-case 1524: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217729ULL);
-} break;
-case 1525: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(262665ULL);
-} break;
-case 1526: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1527: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1528: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(393345ULL);
-} break;
-case 1529: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1152921504606846977ULL);
-} break;
-case 1530: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1531: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8961ULL);
-} break;
-case 1532: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5251073ULL);
-} break;
-case 1533: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33816705ULL);
-} break;
-case 1534: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1535: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1536: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097221ULL);
-} break;
-case 1537: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(70368744177665ULL);
-} break;
-case 1538: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(71ULL);
-} break;
-case 1539: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(135233ULL);
-} break;
-case 1540: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(1ULL);
-} break;
-case 1541: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(23ULL);
-} break;
-case 1542: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1543: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1544: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2179ULL);
-} break;
-case 1545: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17592186044417ULL);
-} break;
-case 1546: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1313ULL);
-} break;
-case 1547: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4133ULL);
-} break;
-case 1548: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775809ULL);
-} break;
-case 1549: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131093ULL);
-} break;
-case 1550: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1551: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1552: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(528389ULL);
-} break;
-case 1553: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1554: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738368ULL);
-p.push_back(1ULL);
-} break;
-case 1555: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1313ULL);
-} break;
-case 1556: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2ULL);
-p.push_back(1ULL);
-} break;
-case 1557: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16905ULL);
-} break;
-case 1558: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 1559: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(1ULL);
-} break;
-case 1560: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(293ULL);
-} break;
-case 1561: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1562: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483648ULL);
-p.push_back(1ULL);
-} break;
-case 1563: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4737ULL);
-} break;
-case 1564: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(129ULL);
-} break;
-case 1565: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9221ULL);
-} break;
-case 1566: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(1ULL);
-} break;
-case 1567: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775808ULL);
-p.push_back(1ULL);
-} break;
-case 1568: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2098305ULL);
-} break;
-case 1569: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1570: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1571: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(132105ULL);
-} break;
-case 1572: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1573: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(266753ULL);
-} break;
-case 1574: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(801ULL);
-} break;
-case 1575: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131073ULL);
-} break;
-case 1576: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1049093ULL);
-} break;
-case 1577: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1578: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1579: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(225ULL);
-} break;
-case 1580: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1581: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1045ULL);
-} break;
-case 1582: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(144115188075855872ULL);
-p.push_back(1ULL);
-} break;
-case 1583: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1048577ULL);
-} break;
-case 1584: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2629633ULL);
-} break;
-case 1585: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1586: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1587: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33921ULL);
-} break;
-case 1588: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097152ULL);
-p.push_back(1ULL);
-} break;
-case 1589: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65801ULL);
-} break;
-case 1590: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1591: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32769ULL);
-} break;
-case 1592: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4257ULL);
-} break;
-case 1593: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1594: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1155ULL);
-} break;
-case 1595: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(262151ULL);
-} break;
-case 1596: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9ULL);
-} break;
-case 1597: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16397ULL);
-} break;
-case 1598: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8329ULL);
-} break;
-case 1599: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1600: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(18435ULL);
-} break;
-case 1601: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1602: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1603: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(18435ULL);
-} break;
-case 1604: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1605: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(209ULL);
-} break;
-case 1606: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1607: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388608ULL);
-p.push_back(1ULL);
-} break;
-case 1608: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(40963ULL);
-} break;
-case 1609: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1610: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2089ULL);
-} break;
-case 1611: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(270465ULL);
-} break;
-case 1612: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1613: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1074792449ULL);
-} break;
-case 1614: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32841ULL);
-} break;
-case 1615: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(1ULL);
-} break;
-case 1616: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8217ULL);
-} break;
-case 1617: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1618: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1619: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131139ULL);
-} break;
-case 1620: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217729ULL);
-} break;
-case 1621: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(13313ULL);
-} break;
-case 1622: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(50177ULL);
-} break;
-case 1623: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131073ULL);
-} break;
-case 1624: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(10273ULL);
-} break;
-case 1625: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32ULL);
-p.push_back(1ULL);
-} break;
-case 1626: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2083ULL);
-} break;
-case 1627: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(262211ULL);
-} break;
-case 1628: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1629: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1045ULL);
-} break;
-case 1630: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1631: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1632: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(163849ULL);
-} break;
-case 1633: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1634: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1635: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34305ULL);
-} break;
-case 1636: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953473ULL);
-} break;
-case 1637: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65603ULL);
-} break;
-case 1638: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1639: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1640: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(163ULL);
-} break;
-case 1641: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1642: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1643: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1082369ULL);
-} break;
-case 1644: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(262659ULL);
-} break;
-case 1645: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(20513ULL);
-} break;
-case 1646: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65571ULL);
-} break;
-case 1647: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1648: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(270339ULL);
-} break;
-case 1649: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1650: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1651: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(270593ULL);
-} break;
-case 1652: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088833ULL);
-} break;
-case 1653: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4361ULL);
-} break;
-case 1654: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(66081ULL);
-} break;
-case 1655: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740993ULL);
-} break;
-case 1656: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(558081ULL);
-} break;
-case 1657: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65537ULL);
-} break;
-case 1658: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131169ULL);
-} break;
-case 1659: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(132099ULL);
-} break;
-case 1660: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953473ULL);
-} break;
-case 1661: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(132609ULL);
-} break;
-case 1662: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2105473ULL);
-} break;
-case 1663: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738368ULL);
-p.push_back(1ULL);
-} break;
-case 1664: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131649ULL);
-} break;
-case 1665: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1666: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1667: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(401409ULL);
-} break;
-case 1668: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1669: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2229249ULL);
-} break;
-case 1670: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(101ULL);
-} break;
-case 1671: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1672: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(57ULL);
-} break;
-case 1673: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67108864ULL);
-p.push_back(1ULL);
-} break;
-case 1674: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1675: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32901ULL);
-} break;
-case 1676: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1677: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(277ULL);
-} break;
-case 1678: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1679: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1048577ULL);
-} break;
-case 1680: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2117ULL);
-} break;
-case 1681: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1682: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33153ULL);
-} break;
-case 1683: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(24581ULL);
-} break;
-case 1684: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1049ULL);
-} break;
-case 1685: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16786433ULL);
-} break;
-case 1686: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(542721ULL);
-} break;
-case 1687: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483649ULL);
-} break;
-case 1688: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33089ULL);
-} break;
-case 1689: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1690: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67617ULL);
-} break;
-case 1691: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65571ULL);
-} break;
-case 1692: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1693: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8781825ULL);
-} break;
-case 1694: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1695: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870913ULL);
-} break;
-case 1696: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32841ULL);
-} break;
-case 1697: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1698: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1699: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5249ULL);
-} break;
-case 1700: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1701: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4333569ULL);
-} break;
-case 1702: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(20971553ULL);
-} break;
-case 1703: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1704: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(18441ULL);
-} break;
-case 1705: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4503599627370497ULL);
-} break;
-case 1706: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(655425ULL);
-} break;
-case 1707: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2117633ULL);
-} break;
-case 1708: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(1ULL);
-} break;
-case 1709: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9225ULL);
-} break;
-case 1710: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1711: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1712: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36897ULL);
-} break;
-case 1713: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1714: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(209ULL);
-} break;
-case 1715: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(139329ULL);
-} break;
-case 1716: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1717: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(10497ULL);
-} break;
-case 1718: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(147969ULL);
-} break;
-case 1719: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421312ULL);
-p.push_back(1ULL);
-} break;
-case 1720: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(148481ULL);
-} break;
-case 1721: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1722: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813889ULL);
-} break;
-case 1723: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(270345ULL);
-} break;
-case 1724: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1725: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(49409ULL);
-} break;
-case 1726: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1727: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(281ULL);
-} break;
-case 1728: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3105ULL);
-} break;
-case 1729: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1073741824ULL);
-p.push_back(1ULL);
-} break;
-case 1730: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(40963ULL);
-} break;
-case 1731: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1045ULL);
-} break;
-case 1732: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(19457ULL);
-} break;
-case 1733: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(325ULL);
-} break;
-case 1734: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1735: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1736: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(540737ULL);
-} break;
-case 1737: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1738: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1739: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1541ULL);
-} break;
-case 1740: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1741: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1048601ULL);
-} break;
-case 1742: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1743: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1744: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(786437ULL);
-} break;
-case 1745: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1746: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1747: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4198913ULL);
-} break;
-case 1748: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1749: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1050753ULL);
-} break;
-case 1750: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1751: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1752: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(77ULL);
-} break;
-case 1753: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1754: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(655425ULL);
-} break;
-case 1755: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(89ULL);
-} break;
-case 1756: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738368ULL);
-p.push_back(1ULL);
-} break;
-case 1757: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(49409ULL);
-} break;
-case 1758: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(101ULL);
-} break;
-case 1759: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1760: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(269ULL);
-} break;
-case 1761: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(13313ULL);
-} break;
-case 1762: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35782657ULL);
-} break;
-case 1763: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(147969ULL);
-} break;
-case 1764: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(1ULL);
-} break;
-case 1765: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(180225ULL);
-} break;
-case 1766: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1037ULL);
-} break;
-case 1767: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1768: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554529ULL);
-} break;
-case 1769: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1770: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1771: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8289ULL);
-} break;
-case 1772: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1773: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33297ULL);
-} break;
-case 1774: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740992ULL);
-p.push_back(1ULL);
-} break;
-case 1775: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1776: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1545ULL);
-} break;
-case 1777: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1778: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1779: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1208090625ULL);
-} break;
-case 1780: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1781: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65605ULL);
-} break;
-case 1782: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(144115188075855873ULL);
-} break;
-case 1783: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1784: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(10485825ULL);
-} break;
-case 1785: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1786: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1056833ULL);
-} break;
-case 1787: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1114115ULL);
-} break;
-case 1788: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1789: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35073ULL);
-} break;
-case 1790: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1791: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1792: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(147465ULL);
-} break;
-case 1793: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1125899906842624ULL);
-p.push_back(1ULL);
-} break;
-case 1794: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2359305ULL);
-} break;
-case 1795: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1061ULL);
-} break;
-case 1796: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4641ULL);
-} break;
-case 1797: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(329ULL);
-} break;
-case 1798: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32ULL);
-p.push_back(1ULL);
-} break;
-case 1799: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1800: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4194341ULL);
-} break;
-case 1801: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1802: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1803: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33801ULL);
-} break;
-case 1804: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1805: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(101ULL);
-} break;
-case 1806: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(1ULL);
-} break;
-case 1807: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(576460752303423488ULL);
-p.push_back(1ULL);
-} break;
-case 1808: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(590337ULL);
-} break;
-case 1809: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1810: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1811: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65669ULL);
-} break;
-case 1812: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4193ULL);
-} break;
-case 1813: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(7340033ULL);
-} break;
-case 1814: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1815: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1816: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8650755ULL);
-} break;
-case 1817: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1818: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1819: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8289ULL);
-} break;
-case 1820: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2049ULL);
-} break;
-case 1821: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131109ULL);
-} break;
-case 1822: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(262403ULL);
-} break;
-case 1823: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1824: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(163ULL);
-} break;
-case 1825: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 1826: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(264201ULL);
-} break;
-case 1827: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5251073ULL);
-} break;
-case 1828: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1829: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(29ULL);
-} break;
-case 1830: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1831: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685249ULL);
-} break;
-case 1832: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(270465ULL);
-} break;
-case 1833: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1834: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(547ULL);
-} break;
-case 1835: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(20489ULL);
-} break;
-case 1836: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1837: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2228229ULL);
-} break;
-case 1838: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740993ULL);
-} break;
-case 1839: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1840: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2098181ULL);
-} break;
-case 1841: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4ULL);
-p.push_back(1ULL);
-} break;
-case 1842: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5249ULL);
-} break;
-case 1843: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8961ULL);
-} break;
-case 1844: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1845: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67617ULL);
-} break;
-case 1846: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1847: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1848: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(73737ULL);
-} break;
-case 1849: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421313ULL);
-} break;
-case 1850: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(77ULL);
-} break;
-case 1851: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32787ULL);
-} break;
-case 1852: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(73793ULL);
-} break;
-case 1853: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(299009ULL);
-} break;
-case 1854: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1855: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813889ULL);
-} break;
-case 1856: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2577ULL);
-} break;
-case 1857: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1858: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(98433ULL);
-} break;
-case 1859: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9281ULL);
-} break;
-case 1860: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8193ULL);
-} break;
-case 1861: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(41947137ULL);
-} break;
-case 1862: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1863: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1864: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2563ULL);
-} break;
-case 1865: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9007199254740993ULL);
-} break;
-case 1866: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2049ULL);
-} break;
-case 1867: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4117ULL);
-} break;
-case 1868: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(673ULL);
-} break;
-case 1869: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2307ULL);
-} break;
-case 1870: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(144115188075855872ULL);
-p.push_back(1ULL);
-} break;
-case 1871: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1872: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1061ULL);
-} break;
-case 1873: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1874: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1048601ULL);
-} break;
-case 1875: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131589ULL);
-} break;
-case 1876: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8721ULL);
-} break;
-case 1877: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4481ULL);
-} break;
-case 1878: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1879: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1880: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32789ULL);
-} break;
-case 1881: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1882: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(579ULL);
-} break;
-case 1883: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67073ULL);
-} break;
-case 1884: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1885: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1050113ULL);
-} break;
-case 1886: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1887: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1888: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(139269ULL);
-} break;
-case 1889: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870913ULL);
-} break;
-case 1890: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1891: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(801ULL);
-} break;
-case 1892: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(387ULL);
-} break;
-case 1893: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(524673ULL);
-} break;
-case 1894: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(7169ULL);
-} break;
-case 1895: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1896: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67110917ULL);
-} break;
-case 1897: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4611ULL);
-} break;
-case 1898: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1157ULL);
-} break;
-case 1899: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8259ULL);
-} break;
-case 1900: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1901: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(84410369ULL);
-} break;
-case 1902: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1903: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1904: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(6147ULL);
-} break;
-case 1905: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1906: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1907: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65617ULL);
-} break;
-case 1908: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1909: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2637825ULL);
-} break;
-case 1910: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(272385ULL);
-} break;
-case 1911: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(1ULL);
-} break;
-case 1912: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1082369ULL);
-} break;
-case 1913: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1914: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16419ULL);
-} break;
-case 1915: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1601ULL);
-} break;
-case 1916: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(265217ULL);
-} break;
-case 1917: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(66177ULL);
-} break;
-case 1918: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1919: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(1ULL);
-} break;
-case 1920: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2061ULL);
-} break;
-case 1921: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1922: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8486913ULL);
-} break;
-case 1923: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(98369ULL);
-} break;
-case 1924: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1925: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8389649ULL);
-} break;
-case 1926: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1927: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554433ULL);
-} break;
-case 1928: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(196737ULL);
-} break;
-case 1929: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483649ULL);
-} break;
-case 1930: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(165ULL);
-} break;
-case 1931: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65729ULL);
-} break;
-case 1932: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1933: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(24641ULL);
-} break;
-case 1934: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1935: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(1ULL);
-} break;
-case 1936: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33795ULL);
-} break;
-case 1937: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1938: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1939: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(39ULL);
-} break;
-case 1940: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421312ULL);
-p.push_back(1ULL);
-} break;
-case 1941: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1049729ULL);
-} break;
-case 1942: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33345ULL);
-} break;
-case 1943: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2049ULL);
-} break;
-case 1944: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(138674177ULL);
-} break;
-case 1945: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(1ULL);
-} break;
-case 1946: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685249ULL);
-} break;
-case 1947: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(274433ULL);
-} break;
-case 1948: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1949: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1161ULL);
-} break;
-case 1950: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(513ULL);
-} break;
-case 1951: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(144115188075855872ULL);
-p.push_back(1ULL);
-} break;
-case 1952: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(49217ULL);
-} break;
-case 1953: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131073ULL);
-} break;
-case 1954: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67589ULL);
-} break;
-case 1955: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8421441ULL);
-} break;
-case 1956: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1957: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(69697ULL);
-} break;
-case 1958: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(33554432ULL);
-p.push_back(1ULL);
-} break;
-case 1959: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1960: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(163845ULL);
-} break;
-case 1961: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1962: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34359738368ULL);
-p.push_back(1ULL);
-} break;
-case 1963: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(201ULL);
-} break;
-case 1964: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097153ULL);
-} break;
-case 1965: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1185ULL);
-} break;
-case 1966: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1967: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67108865ULL);
-} break;
-case 1968: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34095105ULL);
-} break;
-case 1969: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1970: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1157ULL);
-} break;
-case 1971: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1048625ULL);
-} break;
-case 1972: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(6147ULL);
-} break;
-case 1973: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4194339ULL);
-} break;
-case 1974: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1975: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1976: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(34209793ULL);
-} break;
-case 1977: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1978: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2369ULL);
-} break;
-case 1979: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(6291473ULL);
-} break;
-case 1980: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8589934593ULL);
-} break;
-case 1981: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(449ULL);
-} break;
-case 1982: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(16901ULL);
-} break;
-case 1983: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421312ULL);
-p.push_back(1ULL);
-} break;
-case 1984: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(10273ULL);
-} break;
-case 1985: {
-p.push_back(2ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1986: {
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1987: {
-p.push_back(8ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1130497ULL);
-} break;
-case 1988: {
-p.push_back(16ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1989: {
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8405249ULL);
-} break;
-case 1990: {
-p.push_back(64ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1991: {
-p.push_back(128ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1992: {
-p.push_back(256ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(77ULL);
-} break;
-case 1993: {
-p.push_back(512ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(549755813888ULL);
-p.push_back(1ULL);
-} break;
-case 1994: {
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32769ULL);
-} break;
-case 1995: {
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1161ULL);
-} break;
-case 1996: {
-p.push_back(4096ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 1997: {
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(17411ULL);
-} break;
-case 1998: {
-p.push_back(16384ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(36869ULL);
-} break;
-case 1999: {
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2000: {
-p.push_back(65536ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9281ULL);
-} break;
-case 2001: {
-p.push_back(131072ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2002: {
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(6293505ULL);
-} break;
-case 2003: {
-p.push_back(524288ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(5377ULL);
-} break;
-case 2004: {
-p.push_back(1048576ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2005: {
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(135297ULL);
-} break;
-case 2006: {
-p.push_back(4194304ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2097152ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2007: {
-p.push_back(8388608ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(8192ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2008: {
-p.push_back(16777216ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(75505665ULL);
-} break;
-case 2009: {
-p.push_back(33554432ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(18014398509481985ULL);
-} break;
-case 2010: {
-p.push_back(67108864ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2048ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2011: {
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(163857ULL);
-} break;
-case 2012: {
-p.push_back(268435456ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(557073ULL);
-} break;
-case 2013: {
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(53ULL);
-} break;
-case 2014: {
-p.push_back(1073741824ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(705ULL);
-} break;
-case 2015: {
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4398046511105ULL);
-} break;
-case 2016: {
-p.push_back(4294967296ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2130049ULL);
-} break;
-case 2017: {
-p.push_back(8589934592ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1024ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2018: {
-p.push_back(17179869184ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1048713ULL);
-} break;
-case 2019: {
-p.push_back(34359738368ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1048709ULL);
-} break;
-case 2020: {
-p.push_back(68719476736ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(131072ULL);
-p.push_back(1ULL);
-} break;
-case 2021: {
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(540675ULL);
-} break;
-case 2022: {
-p.push_back(274877906944ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2023: {
-p.push_back(549755813888ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(137438953472ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2024: {
-p.push_back(1099511627776ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1133871366657ULL);
-} break;
-case 2025: {
-p.push_back(2199023255552ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(262144ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2026: {
-p.push_back(4398046511104ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2027: {
-p.push_back(8796093022208ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(3081ULL);
-} break;
-case 2028: {
-p.push_back(17592186044416ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(536870912ULL);
-p.push_back(1ULL);
-} break;
-case 2029: {
-p.push_back(35184372088832ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4241ULL);
-} break;
-case 2030: {
-p.push_back(70368744177664ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(12293ULL);
-} break;
-case 2031: {
-p.push_back(140737488355328ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(4ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2032: {
-p.push_back(281474976710656ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(197ULL);
-} break;
-case 2033: {
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(562949953421312ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2034: {
-p.push_back(1125899906842624ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(32768ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2035: {
-p.push_back(2251799813685248ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(785ULL);
-} break;
-case 2036: {
-p.push_back(4503599627370496ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(128ULL);
-p.push_back(1ULL);
-} break;
-case 2037: {
-p.push_back(9007199254740992ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(786441ULL);
-} break;
-case 2038: {
-p.push_back(18014398509481984ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(67649ULL);
-} break;
-case 2039: {
-p.push_back(36028797018963968ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(134217728ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2040: {
-p.push_back(72057594037927936ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(135ULL);
-} break;
-case 2041: {
-p.push_back(144115188075855872ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(2147483648ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(1ULL);
-} break;
-case 2042: {
-p.push_back(288230376151711744ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(65921ULL);
-} break;
-case 2043: {
-p.push_back(576460752303423488ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(657ULL);
-} break;
-case 2044: {
-p.push_back(1152921504606846976ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(35184372088833ULL);
-} break;
-case 2045: {
-p.push_back(2305843009213693952ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(209ULL);
-} break;
-case 2046: {
-p.push_back(4611686018427387904ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(6153ULL);
-} break;
-case 2047: {
-p.push_back(9223372036854775808ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(9ULL);
-} break;
-case 2048: {
-p.push_back(1ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(0ULL);
-p.push_back(548865ULL);
-} break;
-default:
-	cerr << "Internal error: n out of bounds!";
-	exit(-1);
-}
-}
-#endif // #if OS_SIZE == 64
\ No newline at end of file
@@ -65,6 +65,8 @@ typedef int64 			sfixn;
 #include <cstdlib>
 typedef __int8_t 	int8;
 typedef __uint8_t 	uint8;
+typedef __int16_t   int16;
+typedef __uint16_t  uint16;
 typedef __int32_t   int32;
 typedef __int64_t   int64;
 typedef __uint32_t  uint32;
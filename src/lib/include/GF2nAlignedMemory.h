@@ -0,0 +1,104 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GF2N_ALIGNED_MEMORY_H__
+#define __GF2N_ALIGNED_MEMORY_H__
+
+#include <cstddef>
+
+#include "CumffaTypes.h"
+
+namespace libcumffa {
+
+	/* the alignment of all native limb storage */
+	const size_t GF2N_CACHE_LINE_SIZE = 64;
+
+	/* the size of an explicit or transparent huge page */
+	const size_t GF2N_HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+	/**
+	 * @brief      Allocates num_bytes aligned to GF2N_CACHE_LINE_SIZE
+	 *
+	 * @throw      std::bad_alloc if no memory is left
+	 */
+	void *allocAligned( const size_t num_bytes );
+	void freeAligned( void *ptr );
+
+	/* count values of T aligned to GF2N_CACHE_LINE_SIZE, free them with freeAligned */
+	template<typename T>
+	T *allocAligned( const size_t count )
+	{
+		return static_cast<T *>(allocAligned(count * sizeof(T)));
+	}
+
+	/* rounds num_bytes up to a multiple of GF2N_CACHE_LINE_SIZE */
+	inline size_t alignToCacheLine( const size_t num_bytes )
+	{
+		return (num_bytes + GF2N_CACHE_LINE_SIZE - 1) & ~(GF2N_CACHE_LINE_SIZE - 1);
+	}
+
+	enum GF2nPageMode
+	{
+		/* plain pages */
+		GF2N_PAGES_DEFAULT = 0,
+		/* ask the kernel to back the buffer with transparent huge pages */
+		GF2N_PAGES_TRANSPARENT = 1,
+		/* reserved huge pages (MAP_HUGETLB), plain pages if none are free */
+		GF2N_PAGES_EXPLICIT = 2
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		limb buffer for large batches. Buffers of at least one huge page
+		are mapped directly and can be backed by huge pages, smaller ones
+		are allocated cache line aligned. The limbs are zero.
+	*/
+	class GF2nBatchBuffer
+	{
+	public:
+		GF2nBatchBuffer();
+		GF2nBatchBuffer( const size_t num_limbs, const GF2nPageMode mode=GF2N_PAGES_DEFAULT );
+		GF2nBatchBuffer( GF2nBatchBuffer &&other );
+		GF2nBatchBuffer &operator=( GF2nBatchBuffer &&other );
+		~GF2nBatchBuffer();
+
+	public:
+		ufixn *get() const;
+		size_t getNumLimbs() const;
+		/* true if the buffer is mapped with MAP_HUGETLB */
+		bool isHugePageBacked() const;
+
+	private:
+		GF2nBatchBuffer( const GF2nBatchBuffer& );
+		void operator=( const GF2nBatchBuffer& );
+
+		void release();
+
+	private:
+		ufixn *m_limbs;
+		size_t m_num_limbs;
+		/* bytes of the mapping, 0 if the buffer is not mapped */
+		size_t m_mapped_bytes;
+		bool m_huge_pages;
+	};
+}
+
+#endif // __GF2N_ALIGNED_MEMORY_H__
@@ -0,0 +1,137 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GF2N_ARENA_H__
+#define __GF2N_ARENA_H__
+
+#include <cstddef>
+#include <vector>
+
+#include "CumffaTypes.h"
+
+namespace libcumffa {
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		bump allocator for short living elements. Memory is taken from
+		blocks of block_size bytes and is only given back all at once by
+		reset, which keeps the blocks for the next round. An arena is used
+		by one thread at a time and every element placed in it has to be
+		dropped before reset or destruction of the arena.
+	*/
+	class GF2nArena
+	{
+	public:
+		explicit GF2nArena( const size_t block_size=64 * 1024 );
+		~GF2nArena();
+
+	public:
+		void *allocate( const size_t size );
+		void reset();
+		size_t getUsedBytes() const;
+		size_t getReservedBytes() const;
+
+	private:
+		GF2nArena( const GF2nArena& );
+		void operator=( const GF2nArena& );
+
+	private:
+		size_t m_block_size;
+		std::vector<char *> m_blocks;
+		std::vector<size_t> m_block_sizes;
+		/* the block that is filled at the moment and its fill level */
+		size_t m_current;
+		size_t m_offset;
+		/* the bytes of all blocks before m_current */
+		size_t m_used_before;
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		places all elements that the calling thread creates in arena as
+		long as the scope lives. Scopes can be nested, the previous arena
+		is bound again at the end of a scope.
+	*/
+	class GF2nArenaScope
+	{
+	public:
+		explicit GF2nArenaScope( GF2nArena &arena );
+		~GF2nArenaScope();
+
+	private:
+		GF2nArenaScope( const GF2nArenaScope& );
+		void operator=( const GF2nArenaScope& );
+
+	private:
+		GF2nArena *m_previous;
+	};
+
+	/* the arena bound to the calling thread or NULL */
+	GF2nArena *getThreadArena();
+
+	/*
+		allocates size bytes in the arena of the calling thread or on the
+		heap if no arena is bound. Memory of both kinds is given back with
+		freeElementMemory.
+	*/
+	void *allocElementMemory( const size_t size );
+	void freeElementMemory( void *ptr );
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		std allocator on top of allocElementMemory, places the control
+		blocks of the element wrappers in the thread arena
+	*/
+	template<typename T>
+	struct GF2nArenaAllocator
+	{
+		typedef T value_type;
+
+		GF2nArenaAllocator() {}
+
+		template<typename U>
+		GF2nArenaAllocator( const GF2nArenaAllocator<U>& ) {}
+
+		T *allocate( const size_t n )
+		{
+			return static_cast<T *>(allocElementMemory(n * sizeof(T)));
+		}
+
+		void deallocate( T *ptr, const size_t )
+		{
+			freeElementMemory(ptr);
+		}
+	};
+
+	template<typename T, typename U>
+	bool operator==( const GF2nArenaAllocator<T>&, const GF2nArenaAllocator<U>& )
+	{
+		return true;
+	}
+
+	template<typename T, typename U>
+	bool operator!=( const GF2nArenaAllocator<T>&, const GF2nArenaAllocator<U>& )
+	{
+		return false;
+	}
+}
+
+#endif // __GF2N_ARENA_H__
@@ -23,6 +23,7 @@
 #define __GF2N_ARITHMETIC_H__
 
 #include <memory>
+#include <future>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -30,6 +31,10 @@
 
 #include "CumffaTypes.h"
 #include "GF2nArithmeticUtils.h"
+#include "GF2nExecutor.h"
+#include "GF2nArena.h"
+#include "GF2nConversion.h"
+#include "GF2nIrreducible.h"
 
 namespace libcumffa {
 
@@ -53,8 +58,68 @@ namespace libcumffa {
 		std::string m_str;
 	};
 
+	class InvalidBatchStrideException : public std::exception
+	{
+		virtual const char* what() const throw()
+		{
+			return "The batch stride is smaller than the number of limbs of a field element!!!";
+		}
+	};
+
 	class GF2nArithmeticElement;
 
+	///////////////////////////////////////////////////////////////////////
+	/*
+		opcodes of the operations that every backend provides. Backend 
+		specific operations are numbered starting at GF2N_OP_BACKEND.
+	*/
+	enum GF2nOpcode
+	{
+		GF2N_OP_INVALID = -1,
+		GF2N_OP_ADD = 0,
+		GF2N_OP_SUB,
+		GF2N_OP_MUL,
+		GF2N_OP_DIV,
+		GF2N_OP_EXP,
+		GF2N_OP_INVERSE,
+		GF2N_OP_BACKEND = 0x100
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		flags for GF2nArithmetic::setFlags
+	*/
+	enum GF2nFlag
+	{
+		/* submitted operations run in the background */
+		GF2N_FLAG_ASYNC = 0x2,
+
+		/* setDummyParameters rejects a modulus that is not irreducible */
+		GF2N_FLAG_VALIDATE_MODULUS = 0x4
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		a pre-resolved operation. The name of an operation is looked up
+		only once by GF2nArithmetic::resolveOp, calling the returned
+		handle dispatches on the opcode without any string compare.
+	*/
+	class GF2nArithmeticOp
+	{
+	public:
+		GF2nArithmeticOp();
+		explicit GF2nArithmeticOp( const int32 opcode );
+
+	public:
+		int32 getOpcode() const;
+		bool isValid() const;
+		const GF2nArithmeticElement operator()( GF2nArithmeticElement const& lhs, GF2nArithmeticElement const& rhs ) const;
+		const GF2nArithmeticElement operator()( GF2nArithmeticElement const& lhs, uint32 value ) const;
+
+	private:
+		int32 m_opcode;
+	};
+
 	///////////////////////////////////////////////////////////////////////
 	/*
 		the Interface for GF2nArithmetic Objects
@@ -68,9 +133,18 @@ namespace libcumffa {
 		virtual void setDummyParameters( const uint32 field_size, const unsigned char *irred_poly, const uint32 chunks_irred_poly ) = 0;
 		virtual void setDummyParameters( const uint32 field_size, const void *irred_poly, const uint32 chunks_irred_poly ) = 0;
 		virtual void setFlags( const unsigned char flags ) = 0;
+		virtual bool isAsync() = 0;
+		virtual int32 resolveOp( const std::string &what ) = 0;
+		virtual uint32 getFieldSize() = 0;
+		virtual void getModulus( std::vector<ufixn> &limbs ) = 0;
+		virtual uint32 getNumLimbs() = 0;
+		virtual size_t getBatchTileSize() = 0;
+		virtual void setNumWorkers( const uint32 num_workers ) = 0;
+		virtual void runBatch( const int32 op, const ufixn *a, const ufixn *b, const uint32 value, ufixn *out, const size_t count, const uint32 stride, const uint32 worker ) = 0;
 		virtual GF2nArithmeticElement getElement( const std::string value ) = 0;
 		virtual GF2nArithmeticElement getElement( const unsigned char *value, const uint32 chunks_value ) = 0;
 		virtual GF2nArithmeticElement getElement( const void *value, const uint32 chunks_value ) = 0;
+		virtual GF2nArithmeticElement getElementFromLimbs( const ufixn *limbs ) = 0;
 	};
 
 	///////////////////////////////////////////////////////////////////////
@@ -89,14 +163,92 @@ namespace libcumffa {
 		void setDummyParameters( const uint32 field_size, const unsigned char *irred_poly, const uint32 chunks_irred_poly );
 		void setDummyParameters( const uint32 field_size, const void *irred_poly, const uint32 chunks_irred_poly );
 		void setFlags( const unsigned char flags );
+		GF2nArithmeticOp resolveOp( const std::string &what );
 		GF2nArithmeticElement getElement( const std::string value );
 		GF2nArithmeticElement getElement( const unsigned char *value, const uint32 chunks_value );
 		GF2nArithmeticElement getElement( const void *value, const uint32 chunks_value );
+		GF2nArithmeticElement getElementFromLimbs( const ufixn *limbs );
 		std::string getMode();
+		/* the backend, for adapters that need backend specific access */
+		GF2nArithmeticInterface *getBackend();
+
+	public:
+		/*
+			linear time import, see GF2nConversion.h
+
+			@throw InvalidEncodingException if the value is no element
+		*/
+		GF2nArithmeticElement getElementFromHex( const std::string &hex );
+		GF2nArithmeticElement getElementFromBytes( const unsigned char *bytes, const size_t num_bytes, const GF2nByteOrder order );
+
+	public:
+		/*
+			bulk import and export of byte strings of getNumBytes() bytes
+			in the given order. Element i starts at byte i * stride, a
+			stride of 0 selects getNumBytes(). The batch variants convert
+			from and to the limb layout of the batch operations.
+		*/
+		uint32 getNumBytes();
+		void getElements( const unsigned char *bytes, const size_t count, const size_t stride, const GF2nByteOrder order, std::vector<GF2nArithmeticElement> &elements );
+		void getValues( std::vector<GF2nArithmeticElement> &elements, unsigned char *bytes, const size_t stride, const GF2nByteOrder order );
+		void importBatch( const unsigned char *bytes, const size_t count, const size_t stride, const GF2nByteOrder order, ufixn *limbs, const uint32 limb_stride=0 );
+		void exportBatch( const ufixn *limbs, const size_t count, const uint32 limb_stride, unsigned char *bytes, const size_t stride, const GF2nByteOrder order );
+
+	public:
+		/*
+			the field. The modulus includes x^getFieldSize() and is stored
+			least significant limb first, its hash identifies the field
+			independent of the backend and of the limb width
+		*/
+		uint32 getFieldSize();
+		void getModulus( std::vector<ufixn> &limbs );
+		uint64 getModulusHash();
+		bool isModulusIrreducible();
+
+	public:
+		/*
+			batch operations on structure-of-arrays limb buffers. Element i
+			of a buffer starts at limb i * stride and is stored least
+			significant limb first in getNumLimbs() limbs, the remaining
+			limbs of a stride are ignored on input and cleared on output.
+			A stride of 0 selects getNumLimbs().
+
+			The batch is split into tiles that are run by the executor,
+			which is the library wide work stealing pool by default. An
+			executor of NULL runs the batch on the calling thread.
+		*/
+		uint32 getNumLimbs();
+		void addBatch( const ufixn *a, const ufixn *b, ufixn *out, const size_t count, const uint32 stride=0 );
+		void mulBatch( const ufixn *a, const ufixn *b, ufixn *out, const size_t count, const uint32 stride=0 );
+		void expBatch( const ufixn *a, const uint32 value, ufixn *out, const size_t count, const uint32 stride=0 );
+		void runBatch( GF2nArithmeticOp const& op, const ufixn *a, const ufixn *b, const uint32 value, ufixn *out, const size_t count, const uint32 stride=0 );
+		void setExecutor( std::shared_ptr<GF2nExecutorInterface> executor );
+		std::shared_ptr<GF2nExecutorInterface> getExecutor();
+
+	public:
+		/*
+			submitted operations run on the executor if the backend is in
+			async mode (GF2N_FLAG_ASYNC), otherwise they are done when
+			submit returns. The buffers of a batch must stay valid until
+			its future is ready.
+		*/
+		std::future<GF2nArithmeticElement> submit( GF2nArithmeticOp const& op, GF2nArithmeticElement const& lhs, GF2nArithmeticElement const& rhs );
+		std::future<GF2nArithmeticElement> submit( GF2nArithmeticOp const& op, GF2nArithmeticElement const& lhs, const uint32 value );
+		std::future<void> submitBatch( GF2nArithmeticOp const& op, const ufixn *a, const ufixn *b, const uint32 value, ufixn *out, const size_t count, const uint32 stride=0 );
+
+	private:
+		void validateModulus();
+		uint32 getBatchStride( const uint32 stride );
+		size_t getBatchTileSize( const size_t count );
+		std::future<GF2nArithmeticElement> submitTask( const std::function<GF2nArithmeticElement ()> &fun );
 
 	private:
+		friend class GF2nArithmeticGraphData;
+
 		std::shared_ptr<GF2nArithmeticInterface> m_element;
+		std::shared_ptr<GF2nExecutorInterface> m_executor;
 		std::string m_mode;
+		unsigned char m_flags;
 	};
 
 	///////////////////////////////////////////////////////////////////////
@@ -107,14 +259,24 @@ namespace libcumffa {
 	{
 	public:
 		virtual ~GF2nArithmeticElementInterface() {}
+
+		/* elements live in the arena of the creating thread, if one is bound */
+		static void *operator new( size_t size );
+		static void operator delete( void *ptr );
+
 		virtual GF2nArithmeticElementInterface *add( GF2nArithmeticElementInterface *other ) = 0;
 		virtual GF2nArithmeticElementInterface *sub( GF2nArithmeticElementInterface *other ) = 0;
 		virtual GF2nArithmeticElementInterface *mul( GF2nArithmeticElementInterface *other ) = 0;
 		virtual GF2nArithmeticElementInterface *div( GF2nArithmeticElementInterface *other ) = 0;
 		virtual GF2nArithmeticElementInterface *runWithElement( const std::string &what, GF2nArithmeticElementInterface *other ) = 0;
 		virtual GF2nArithmeticElementInterface *runWithValue( const std::string &what, uint32 value ) = 0;
+		virtual GF2nArithmeticElementInterface *runWithElement( const int32 op, GF2nArithmeticElementInterface *other ) = 0;
+		virtual GF2nArithmeticElementInterface *runWithValue( const int32 op, uint32 value ) = 0;
 		virtual std::string toString() = 0;
 		virtual void getValue( std::vector<uint8_t> &value ) = 0;
+		virtual void getValue( uint8_t *value, const size_t num_bytes ) = 0;
+		virtual void getLimbs( ufixn *limbs, const uint32 num_limbs ) = 0;
+		virtual uint32 getFieldSize() = 0;
 		virtual std::string getMetrics() = 0;
 		virtual std::string getMetrics( const std::string &metrics_name ) = 0;
 		virtual void setProperty( const std::string &property_name, const std::string &property_value ) = 0;
@@ -130,8 +292,13 @@ namespace libcumffa {
 		virtual GF2nArithmeticElementInterface *div( GF2nArithmeticElementInterface *other );
 		virtual GF2nArithmeticElementInterface *runWithElement( const std::string &what, GF2nArithmeticElementInterface *other );
 		virtual GF2nArithmeticElementInterface *runWithValue( const std::string &what, uint32 value );
+		virtual GF2nArithmeticElementInterface *runWithElement( const int32 op, GF2nArithmeticElementInterface *other );
+		virtual GF2nArithmeticElementInterface *runWithValue( const int32 op, uint32 value );
 		virtual std::string toString();
 		virtual void getValue( std::vector<uint8_t> &value );
+		virtual void getValue( uint8_t *value, const size_t num_bytes );
+		virtual void getLimbs( ufixn *limbs, const uint32 num_limbs );
+		virtual uint32 getFieldSize();
 		virtual std::string getMetrics();
 		virtual std::string getMetrics( const std::string &metrics_name );
 		virtual void setProperty( const std::string &property_name, const std::string &property_value );
@@ -158,12 +325,38 @@ namespace libcumffa {
 		friend std::ostream& operator<<( std::ostream &out, GF2nArithmeticElement &elem );
 		const GF2nArithmeticElement runWithElement( const std::string &what, GF2nArithmeticElement const& other );
 		const GF2nArithmeticElement runWithValue( const std::string &what, uint32 value );
+		const GF2nArithmeticElement runWithElement( GF2nArithmeticOp const& op, GF2nArithmeticElement const& other ) const;
+		const GF2nArithmeticElement runWithValue( GF2nArithmeticOp const& op, uint32 value ) const;
 		std::string toString();
 		void getValue( std::vector<uint8_t> &value );
+		void getLimbs( ufixn *limbs, const uint32 num_limbs );
+		uint32 getFieldSize();
 		std::string getMetrics();
 		std::string getMetrics( const std::string &metrics_name );
 		void setProperty( const std::string &property_name, const std::string &property_value );
 
+	public:
+		/*
+			linear time export, see GF2nConversion.h. getBytes returns
+			the bytes of the field size in the given order.
+		*/
+		std::string toHex();
+		void getBytes( std::vector<uint8_t> &bytes, const GF2nByteOrder order );
+
+	public:
+		/*
+			the big endian value of getValue( std::vector ) written into
+			a caller buffer, right aligned and zero padded to num_bytes
+
+			@throw InvalidEncodingException if the value needs more bytes
+		*/
+		void getValue( uint8_t *value, const size_t num_bytes );
+
+	private:
+		friend class GF2nArithmeticGraph;
+
+		void setElement( GF2nArithmeticElementInterface *element );
+
 	private:
 		std::shared_ptr<GF2nArithmeticElementInterface> m_element;
 	};
@@ -193,9 +386,31 @@ namespace libcumffa {
 		helper functions
 	*/
 	namespace utils {
+		/**
+		 * @brief      Appends the chunks of size_chunk_bits bits of a
+		 *             decimal string to arr as decimal strings, most
+		 *             significant first and padded to bn_num_chunks
+		 *
+		 * @throw      InvalidEncodingException if str is no decimal number
+		 */
 		void convertStringToArray( std::string str, int size_chunk_bits, int bn_num_chunks, std::vector<std::string> &arr );
 		void convertStringToArray2( std::string str, int size_chunk_bits, int bn_num_chunks, std::vector<std::string> &arr );
 		void convertArrayToString( std::vector<std::string> &arr, int size_chunk_bits, int num_chunks, std::string &str );
+
+		/**
+		 * @brief      Converts a decimal string into as many least
+		 *             significant first limbs as the value needs
+		 *
+		 * @throw      InvalidEncodingException if str is no decimal number
+		 */
+		void decimalToLimbs( const std::string &str, std::vector<ufixn> &limbs );
+		std::string limbsToDecimal( const ufixn *limbs, const uint32 num_limbs );
+
+		/**
+		 * @brief      FNV-1a hash of the num_bits low bits of limbs, taken
+		 *             byte by byte from the least significant byte up
+		 */
+		uint64 hashLimbs( const ufixn *limbs, const uint32 num_bits );
 	}
 }
 
@@ -0,0 +1,76 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GF2N_ARITHMETIC_GRAPH_H__
+#define __GF2N_ARITHMETIC_GRAPH_H__
+
+#include "GF2nArithmetic.h"
+
+namespace libcumffa {
+
+	class GraphNotExecutedException : public std::exception
+	{
+		virtual const char* what() const throw()
+		{
+			return "The value of the element has not been computed by the graph yet!!!";
+		}
+	};
+
+	class InvalidGraphElementException : public std::exception
+	{
+		virtual const char* what() const throw()
+		{
+			return "The element was not recorded by this graph!!!";
+		}
+	};
+
+	class GF2nArithmeticGraphData;
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		records the operations on the elements returned by input() instead
+		of computing them. execute() runs the recorded graph in one shot:
+		the operations are grouped into levels of independent operations
+		that run on the executor of the GF2nArithmetic, chains of additions
+		are fused into one xor over all operands and the limb buffers of
+		intermediate values are reused as soon as they are dead.
+
+		Only values that still have an element handle when execute() is
+		called are kept. After execute() these handles return their values
+		and getResult() converts them into ordinary elements.
+	*/
+	class GF2nArithmeticGraph
+	{
+	public:
+		explicit GF2nArithmeticGraph( GF2nArithmetic const& arithm );
+		~GF2nArithmeticGraph();
+
+	public:
+		GF2nArithmeticElement input( GF2nArithmeticElement const& value );
+		void execute();
+		GF2nArithmeticElement getResult( GF2nArithmeticElement const& element );
+
+	private:
+		std::shared_ptr<GF2nArithmeticGraphData> m_data;
+	};
+}
+
+#endif // __GF2N_ARITHMETIC_GRAPH_H__
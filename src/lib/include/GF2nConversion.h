@@ -0,0 +1,108 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __GF2N_CONVERSION_H__
+#define __GF2N_CONVERSION_H__
+
+#include <string>
+#include <sstream>
+#include <exception>
+
+#include "CumffaTypes.h"
+
+namespace libcumffa {
+
+	class InvalidEncodingException : public std::exception
+	{
+	public:
+		InvalidEncodingException( const std::string &reason )
+		{
+			std::stringstream ss;
+			ss << "Cannot convert the element: " << reason << "!!!";
+			m_str = ss.str();
+		}
+
+	private:
+		virtual const char* what() const throw()
+		{
+			return m_str.c_str();
+		}
+
+	private:
+		std::string m_str;
+	};
+
+	/* the order of the bytes of a raw binary element */
+	enum GF2nByteOrder
+	{
+		GF2N_LITTLE_ENDIAN = 0,
+		GF2N_BIG_ENDIAN = 1
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		linear time conversions between the limbs of an element, least
+		significant limb first, and hex strings or raw bytes. All of
+		them throw InvalidEncodingException if a value does not fit into
+		num_bits.
+	*/
+	namespace utils {
+
+		/* true if no bit at or above num_bits is set */
+		bool limbsFit( const ufixn *limbs, const uint32 num_limbs, const uint32 num_bits );
+
+		/**
+		 * @brief      Parses hex digits with an optional 0x prefix, upper
+		 *             or lower case, into num_limbs limbs
+		 */
+		void hexToLimbs( const std::string &hex, ufixn *limbs, const uint32 num_limbs, const uint32 num_bits );
+
+		/**
+		 * @brief      Formats limbs as lower case hex digits without
+		 *             leading zeros, "0" for zero
+		 */
+		std::string limbsToHex( const ufixn *limbs, const uint32 num_limbs );
+
+		void bytesToLimbs( const unsigned char *bytes, const size_t num_bytes, const GF2nByteOrder order, ufixn *limbs, const uint32 num_limbs, const uint32 num_bits );
+
+		/**
+		 * @brief      Stores limbs as num_bytes bytes, zero padded
+		 */
+		void limbsToBytes( const ufixn *limbs, const uint32 num_limbs, const GF2nByteOrder order, unsigned char *bytes, const size_t num_bytes );
+
+		/**
+		 * @brief      Converts count byte strings of num_bytes bytes that
+		 *             start byte_stride bytes apart into the batch layout,
+		 *             num_limbs limbs every limb_stride limbs. The limbs
+		 *             after num_limbs are cleared.
+		 */
+		void bytesToLimbArray( const unsigned char *bytes, const size_t count, const size_t num_bytes, const size_t byte_stride, const GF2nByteOrder order, ufixn *limbs, const uint32 num_limbs, const uint32 limb_stride, const uint32 num_bits );
+
+		/**
+		 * @brief      The reverse of bytesToLimbArray, the bytes after
+		 *             num_bytes of a byte_stride are left untouched
+		 */
+		void limbArrayToBytes( const ufixn *limbs, const size_t count, const uint32 num_limbs, const uint32 limb_stride, const GF2nByteOrder order, unsigned char *bytes, const size_t num_bytes, const size_t byte_stride );
+	}
+}
+
+#endif // __GF2N_CONVERSION_H__
@@ -0,0 +1,122 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#ifndef __GF2N_ELEMENT_VIEW_H__
+#define __GF2N_ELEMENT_VIEW_H__
+
+#include <string>
+#include <exception>
+
+#include "CumffaTypes.h"
+#include "GF2nArithmetic.h"
+
+namespace libcumffa {
+
+	class ElementViewMismatchException : public std::exception
+	{
+		virtual const char* what() const throw()
+		{
+			return "The element views belong to different arithmetic objects!!!";
+		}
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		a read only element in caller memory. The view neither owns the
+		limbs nor the arithmetic, both must outlive it. The memory holds
+		getNumLimbs() limbs, least significant limb first, aligned for
+		ufixn, just like an element of a batch buffer.
+	*/
+	class GF2nConstElementView
+	{
+	public:
+		GF2nConstElementView( GF2nArithmetic &arithmetic, const ufixn *limbs );
+
+	public:
+		const ufixn *getLimbs() const;
+		uint32 getNumLimbs() const;
+		uint32 getFieldSize() const;
+		GF2nArithmeticInterface *getArithmetic() const;
+
+		/* an own element with a copy of the limbs */
+		GF2nArithmeticElement getElement() const;
+		std::string toHex() const;
+
+		/**
+		 * @brief      Writes the value into a caller buffer, zero padded
+		 *             to num_bytes, without any allocation
+		 *
+		 * @throw      InvalidEncodingException if the value needs more
+		 *             bytes
+		 */
+		void getValue( uint8_t *value, const size_t num_bytes, const GF2nByteOrder order=GF2N_BIG_ENDIAN ) const;
+
+	protected:
+		GF2nArithmeticInterface *m_arithmetic;
+		const ufixn *m_limbs;
+		uint32 m_num_limbs;
+		uint32 m_field_size;
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		an element in caller memory that operations write to in place.
+		The result may be one of the operands. All views of an operation
+		must be created from the same GF2nArithmetic (or a copy of it).
+	*/
+	class GF2nElementView : public GF2nConstElementView
+	{
+	public:
+		GF2nElementView( GF2nArithmetic &arithmetic, ufixn *limbs );
+
+	public:
+		ufixn *getLimbs() const;
+
+		void setZero();
+		void setElement( GF2nArithmeticElement &element );
+		void setValue( GF2nConstElementView const& other );
+
+		/**
+		 * @brief      Reads the value from a caller buffer
+		 *
+		 * @throw      InvalidEncodingException if the value does not fit
+		 *             into the field
+		 */
+		void setValue( const uint8_t *value, const size_t num_bytes, const GF2nByteOrder order=GF2N_BIG_ENDIAN );
+
+	public:
+		/* *this = lhs op rhs */
+		void add( GF2nConstElementView const& lhs, GF2nConstElementView const& rhs );
+		void sub( GF2nConstElementView const& lhs, GF2nConstElementView const& rhs );
+		void mul( GF2nConstElementView const& lhs, GF2nConstElementView const& rhs );
+		void exp( GF2nConstElementView const& lhs, const uint32 value );
+		void inverse( GF2nConstElementView const& lhs );
+		void run( GF2nArithmeticOp const& op, GF2nConstElementView const& lhs, GF2nConstElementView const& rhs );
+		void run( GF2nArithmeticOp const& op, GF2nConstElementView const& lhs, const uint32 value );
+
+	private:
+		void checkOperand( GF2nConstElementView const& other ) const;
+	};
+}
+
+#endif // __GF2N_ELEMENT_VIEW_H__
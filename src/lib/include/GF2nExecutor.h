@@ -0,0 +1,136 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GF2N_EXECUTOR_H__
+#define __GF2N_EXECUTOR_H__
+
+#include <memory>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+
+#include "CumffaTypes.h"
+
+namespace libcumffa {
+
+	/* worker id of a tile that is not run by an executor worker */
+	const uint32 GF2N_NO_WORKER = 0xFFFFFFFF;
+
+	/*
+		the function an executor calls for every tile [begin, end) of a
+		range. worker is smaller than getNumWorkers() and no two tiles
+		with the same worker id run at the same time
+	*/
+	typedef std::function<void (const size_t begin, const size_t end, const uint32 worker)> GF2nTileFunction;
+
+	/* a single task that is posted to an executor */
+	typedef std::function<void (const uint32 worker)> GF2nTaskFunction;
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		the Interface for executors that run batch operations in parallel.
+		Implement it to run the batches on an own thread pool.
+	*/
+	class GF2nExecutorInterface
+	{
+	public:
+		virtual ~GF2nExecutorInterface() {}
+		virtual uint32 getNumWorkers() = 0;
+		virtual void parallelFor( const size_t count, const size_t tile_size, const GF2nTileFunction &fun ) = 0;
+		virtual void post( const GF2nTaskFunction &task ) = 0;
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		thread pool with one task deque per worker. A worker takes the
+		newest tile of its own deque and steals the oldest tile of another
+		worker when its deque runs empty. The threads are started with the
+		first parallelFor or post call.
+	*/
+	class GF2nWorkStealingExecutor : public GF2nExecutorInterface
+	{
+	public:
+		explicit GF2nWorkStealingExecutor( const uint32 num_workers=0 );
+		virtual ~GF2nWorkStealingExecutor();
+
+	public:
+		virtual uint32 getNumWorkers();
+		virtual void parallelFor( const size_t count, const size_t tile_size, const GF2nTileFunction &fun );
+		virtual void post( const GF2nTaskFunction &task );
+
+	private:
+		GF2nWorkStealingExecutor( const GF2nWorkStealingExecutor& );
+		void operator=( const GF2nWorkStealingExecutor& );
+
+		struct Job
+		{
+			const GF2nTileFunction *fun;
+			size_t pending;
+			std::mutex mutex;
+			std::condition_variable done;
+			std::exception_ptr error;
+		};
+
+		/* a tile of a job or, if job is NULL, a posted task */
+		struct Tile
+		{
+			Job *job;
+			size_t begin;
+			size_t end;
+			GF2nTaskFunction task;
+		};
+
+		struct Worker
+		{
+			std::mutex mutex;
+			std::deque<Tile> tiles;
+		};
+
+		void start();
+		void work( const uint32 worker );
+		bool popTile( const uint32 worker, Tile &tile );
+		void runTile( const Tile &tile, const uint32 worker );
+
+	private:
+		uint32 m_num_workers;
+		std::vector<std::unique_ptr<Worker> > m_workers;
+		std::vector<std::thread> m_threads;
+		std::once_flag m_started;
+		std::mutex m_mutex;
+		std::condition_variable m_wakeup;
+		std::atomic<size_t> m_num_queued;
+		std::atomic<uint32> m_next_worker;
+		bool m_stop;
+	};
+
+	/* the executor shared by all GF2nArithmetic objects by default */
+	std::shared_ptr<GF2nExecutorInterface> getDefaultExecutor();
+
+	/* number of elements of bytes_per_element that fit into a tile in the cache */
+	size_t calcCacheTileSize( const size_t bytes_per_element );
+}
+
+#endif // __GF2N_EXECUTOR_H__
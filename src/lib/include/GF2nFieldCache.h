@@ -0,0 +1,209 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __GF2N_FIELD_CACHE_H__
+#define __GF2N_FIELD_CACHE_H__
+
+#include <string>
+#include <sstream>
+#include <exception>
+#include <vector>
+#include <map>
+#include <mutex>
+
+#include "CumffaTypes.h"
+
+namespace libcumffa {
+
+	class FieldCacheIOException : public std::exception
+	{
+	public:
+		FieldCacheIOException( const std::string &path, const std::string &reason )
+		{
+			std::stringstream ss;
+			ss << "Field cache " << path << ": " << reason << "!!!";
+			m_str = ss.str();
+		}
+
+	private:
+		virtual const char* what() const throw()
+		{
+			return m_str.c_str();
+		}
+
+	private:
+		std::string m_str;
+	};
+
+	class FieldCacheFormatException : public std::exception
+	{
+	public:
+		FieldCacheFormatException( const std::string &path, const std::string &reason )
+		{
+			std::stringstream ss;
+			ss << "Field cache " << path << " does not match: " << reason << "!!!";
+			m_str = ss.str();
+		}
+
+	private:
+		virtual const char* what() const throw()
+		{
+			return m_str.c_str();
+		}
+
+	private:
+		std::string m_str;
+	};
+
+	/* the current version of the field cache format */
+	const uint32 GF2N_FIELD_CACHE_VERSION = 1;
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		the first 32 bytes of a field cache file, the records follow. All
+		fields are stored in the byte order of the machine that created
+		the file.
+	*/
+	struct GF2nFieldCacheHeader
+	{
+		/* "GF2NFCAC" */
+		char magic[8];
+		uint32 version;
+		uint32 header_bytes;
+		/* 0x01020304 */
+		uint32 byte_order;
+		uint8 reserved[12];
+	};
+
+	/*
+		a record of the cache, its num_bytes bytes of data follow and the
+		next record starts at the next multiple of 8 bytes
+	*/
+	struct GF2nFieldCacheRecord
+	{
+		uint64 key;
+		uint32 kind;
+		uint32 num_bytes;
+		/* FNV-1a of the data, tells a torn record of a crashed writer */
+		uint64 checksum;
+	};
+
+	/*
+		the kinds of records. A kind whose data depends on the kernels
+		of the CPU has to add the CPU features to its key.
+	*/
+	enum GF2nFieldCacheKind
+	{
+		/* the GF2nIrreducibleTerms found by a search for the degree in key */
+		GF2N_FIELD_CACHE_MODULUS = 1,
+
+		/*
+			the irreducibility of the modulus whose hash is key, a uint64
+			of 0 or 1 followed by the modulus in 64 bit words, least
+			significant word first
+		*/
+		GF2N_FIELD_CACHE_IRREDUCIBLE = 2
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		a file of per-field precomputations that outlives the process.
+		The file is only ever appended to and is mapped read only, so
+		all processes that use the same file share its pages. A record
+		that is missing is computed by the first process that needs it
+		and appended, later lookups of every process find it. A file
+		that is not writable is used read only.
+	*/
+	class GF2nFieldCache
+	{
+	public:
+		GF2nFieldCache();
+		~GF2nFieldCache();
+
+	public:
+		/**
+		 * @brief      Maps the cache file at path, the file is created if
+		 *             it does not exist. An open file is closed first.
+		 *             If the file is writable, a torn record left by a
+		 *             crashed writer is cut off with everything after it.
+		 *
+		 * @throw      FieldCacheIOException if the file cannot be mapped
+		 * @throw      FieldCacheFormatException if the file is no field
+		 *             cache of this version and byte order
+		 */
+		void open( const std::string &path );
+
+		/* unmaps the file, the data of find becomes invalid */
+		void close();
+
+		bool isOpen();
+
+		/**
+		 * @brief      Returns the data of the record of kind and key
+		 *
+		 * @param[out] num_bytes  the size of the data
+		 *
+		 * @return     NULL if there is no such record or no open file,
+		 *             else data that stays valid until close
+		 */
+		const void *find( const uint32 kind, const uint64 key, uint32 &num_bytes );
+
+		/* appends a record if the file is open and writable */
+		void insert( const uint32 kind, const uint64 key, const void *data, const uint32 num_bytes );
+
+	private:
+		GF2nFieldCache( const GF2nFieldCache& );
+		void operator=( const GF2nFieldCache& );
+
+		/* indexes the records appended since the last call under LOCK_SH */
+		void remap();
+		void indexRecords();
+		void release();
+
+	private:
+		std::mutex m_mutex;
+		std::string m_path;
+		int m_fd;
+		bool m_writable;
+		/*
+			the mappings of the file, the last one is the largest. Older
+			ones are kept until close so that the data of find stays
+			valid when the file grows past a mapping.
+		*/
+		std::vector<std::pair<void *, size_t> > m_mappings;
+		/* bytes of the file that have been indexed */
+		size_t m_indexed_bytes;
+		std::map<std::pair<uint32, uint64>, const GF2nFieldCacheRecord *> m_records;
+	};
+
+	/* the environment variable with the path of the cache of the library */
+	const char GF2N_FIELD_CACHE_ENV[] = "LIBCUMFFA_FIELD_CACHE";
+
+	/*
+		the cache of the library. The first call opens the file named by
+		GF2N_FIELD_CACHE_ENV, if it is set and the file can be opened,
+		otherwise no file is open until the caller opens one.
+	*/
+	GF2nFieldCache &getFieldCache();
+}
+
+#endif // __GF2N_FIELD_CACHE_H__
@@ -0,0 +1,271 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GF2N_FIXED_H__
+#define __GF2N_FIXED_H__
+
+#include <array>
+#include <cassert>
+
+#include "GF2nArithmetic.h"
+#include "GF2nIrreducible.h"
+#include "GF2nNativeKernels.h"
+
+namespace libcumffa {
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		sparse irreducible polynomial x^N + x^K1 + x^K2 + x^K3 + 1, unused
+		middle terms are 0. K1 must be at least 64 below N, so folding a
+		word never touches the word itself.
+	*/
+	template<uint32 N, uint32 K1, uint32 K2=0, uint32 K3=0>
+	struct GF2nSparseModulus
+	{
+		static constexpr uint32 degree = N;
+		static constexpr uint32 k1 = K1;
+		static constexpr uint32 k2 = K2;
+		static constexpr uint32 k3 = K3;
+	};
+
+	/*
+		the modulus of the fixed field of degree N, taken from the
+		irreducible table. Trinomial rows end in 0, -1, -1.
+	*/
+	template<uint32 N>
+	struct GF2nFixedModulus : GF2nSparseModulus<N,
+		static_cast<uint32>(utils::getTableExponent(N, 1)),
+		static_cast<uint32>(utils::getTableExponent(N, 2) > 0 ? utils::getTableExponent(N, 2) : 0),
+		static_cast<uint32>(utils::getTableExponent(N, 3) > 0 ? utils::getTableExponent(N, 3) : 0)>
+	{
+		static_assert(N >= 2 && N <= GF2N_IRRED_MAX_DEGREE, "the irreducible table has no modulus of degree N");
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		element of GF(2^N) with the modulus fixed at compile time. The value
+		is kept in 64 bit words, least significant word first, on the stack.
+		Conversion from and to GF2nArithmeticElement goes through the limb
+		layout of the batch interface. Clmul is the carry-less multiply of
+		one of the instruction sets in GF2nNativeKernels.h.
+	*/
+	template<uint32 N, typename Clmul=native::GF2nClmulHost>
+	class GF2nFixed
+	{
+	public:
+		typedef GF2nFixedModulus<N> Modulus;
+		static constexpr uint32 field_size = N;
+		static constexpr uint32 num_words = (N + 63) / 64;
+		static constexpr uint32 num_limbs = (N + sizeof(ufixn) * 8 - 1) / (sizeof(ufixn) * 8);
+		typedef std::array<uint64, num_words> Words;
+
+	public:
+		GF2nFixed() : m_words() {}
+
+		explicit GF2nFixed( Words const& words )
+			: m_words(words)
+		{
+			assert((m_words[num_words - 1] >> (N - 64 * (num_words - 1) - 1)) <= 1);
+		}
+
+		static GF2nFixed fromLimbs( const ufixn *limbs )
+		{
+			const uint32 limb_bits = sizeof(ufixn) * 8;
+
+			GF2nFixed res;
+			for( uint32 i=0; i<num_limbs; ++i )
+				res.m_words[i * limb_bits / 64] |= static_cast<uint64>(limbs[i]) << ((i * limb_bits) % 64);
+
+			return res;
+		}
+
+		static GF2nFixed fromElement( GF2nArithmeticElement &element )
+		{
+			ufixn limbs[num_limbs];
+			element.getLimbs(limbs, num_limbs);
+			return fromLimbs(limbs);
+		}
+
+		void toLimbs( ufixn *limbs ) const
+		{
+			const uint32 limb_bits = sizeof(ufixn) * 8;
+
+			for( uint32 i=0; i<num_limbs; ++i )
+				limbs[i] = static_cast<ufixn>(m_words[i * limb_bits / 64] >> ((i * limb_bits) % 64));
+		}
+
+		GF2nArithmeticElement toElement( GF2nArithmetic &arithm ) const
+		{
+			assert(arithm.getNumLimbs() == num_limbs);
+
+			ufixn limbs[num_limbs];
+			toLimbs(limbs);
+			return arithm.getElementFromLimbs(limbs);
+		}
+
+		Words const& getWords() const
+		{
+			return m_words;
+		}
+
+		bool isZero() const
+		{
+			uint64 acc = 0;
+			for( uint32 i=0; i<num_words; ++i )
+				acc |= m_words[i];
+			return acc == 0;
+		}
+
+	public:
+		friend GF2nFixed operator+( GF2nFixed const& lhs, GF2nFixed const& rhs )
+		{
+			GF2nFixed res;
+			GF2nUnroll<0, num_words>::run([&]( const uint32 i ) {
+				res.m_words[i] = lhs.m_words[i] ^ rhs.m_words[i];
+			});
+			return res;
+		}
+
+		friend GF2nFixed operator-( GF2nFixed const& lhs, GF2nFixed const& rhs )
+		{
+			return lhs + rhs;
+		}
+
+		friend GF2nFixed operator*( GF2nFixed const& lhs, GF2nFixed const& rhs )
+		{
+			uint64 c[2 * num_words];
+			Clmul::template productOf<num_words>(lhs.m_words.data(), rhs.m_words.data(), c);
+
+			GF2nFixed res;
+			reduce(c, res.m_words);
+			return res;
+		}
+
+		friend bool operator==( GF2nFixed const& lhs, GF2nFixed const& rhs )
+		{
+			return lhs.m_words == rhs.m_words;
+		}
+
+		friend bool operator!=( GF2nFixed const& lhs, GF2nFixed const& rhs )
+		{
+			return lhs.m_words != rhs.m_words;
+		}
+
+		GF2nFixed sqr() const
+		{
+			uint64 c[2 * num_words];
+			Clmul::template squareOf<num_words>(m_words.data(), c);
+
+			GF2nFixed res;
+			reduce(c, res.m_words);
+			return res;
+		}
+
+		GF2nFixed exp( const uint32 value ) const
+		{
+			GF2nFixed res;
+			res.m_words[0] = 1;
+
+			for( uint32 bit=32; bit-- > 0; )
+			{
+				res = res.sqr();
+				if( (value >> bit) & 1 )
+					res = res * *this;
+			}
+
+			return res;
+		}
+
+		/*
+			Itoh-Tsujii inversion, a^-1 = (a^(2^(N-1) - 1))^2 where the
+			power is built along the bits of N - 1. The inverse of 0 is 0.
+		*/
+		GF2nFixed inverse() const
+		{
+			GF2nFixed b = *this;
+			uint32 k = 1;
+
+			uint32 top = 31;
+			while( ((N - 1) >> top) == 0 )
+				--top;
+
+			for( uint32 bit=top; bit-- > 0; )
+			{
+				GF2nFixed t = b;
+				for( uint32 i=0; i<k; ++i )
+					t = t.sqr();
+				b = t * b;
+				k *= 2;
+
+				if( ((N - 1) >> bit) & 1 )
+				{
+					b = b.sqr() * *this;
+					k += 1;
+				}
+			}
+
+			return b.sqr();
+		}
+
+	private:
+		static void fold( uint64 *c, const uint64 value, const uint32 bit_pos )
+		{
+			native::xorShifted(c, value, bit_pos + Modulus::k1);
+			if( Modulus::k2 != 0 )
+				native::xorShifted(c, value, bit_pos + Modulus::k2);
+			if( Modulus::k3 != 0 )
+				native::xorShifted(c, value, bit_pos + Modulus::k3);
+			native::xorShifted(c, value, bit_pos);
+		}
+
+		/*
+			reduces the 2 * num_words words of c modulo x^N + ... + 1. The
+			words above the degree are folded down from the top, every
+			fold lands at least 64 bits lower.
+		*/
+		static void reduce( uint64 *c, Words &res )
+		{
+			static_assert(N >= Modulus::k1 + 64, "the middle terms of the modulus are too close to the degree");
+
+			const uint32 top_word = N / 64;
+			const uint32 num_folds = 2 * num_words - 1 - top_word;
+
+			GF2nUnroll<0, num_folds>::run([&]( const uint32 j ) {
+				const uint32 i = 2 * num_words - 1 - j;
+				uint64 t = c[i];
+				c[i] = 0;
+				fold(c, t, 64 * i - N);
+			});
+
+			uint64 t = c[top_word] >> (N % 64);
+			c[top_word] ^= t << (N % 64);
+			fold(c, t, 0);
+
+			for( uint32 i=0; i<num_words; ++i )
+				res[i] = c[i];
+		}
+
+	private:
+		Words m_words;
+	};
+}
+
+#endif // __GF2N_FIXED_H__
@@ -0,0 +1,157 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __GF2N_INTEROP_H__
+#define __GF2N_INTEROP_H__
+
+#include <vector>
+#include <cstring>
+#include <openssl/bn.h>
+#include <gmp.h>
+
+#ifdef GF2N_WITH_NTL
+#include <NTL/GF2X.h>
+#endif
+
+#include "GF2nArithmetic.h"
+
+namespace libcumffa {
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		num_limbs least significant first limbs of a foreign value. The
+		view borrows the words of the value if they already have the
+		limb layout and at least num_limbs words, then it is only valid
+		as long as the value is not changed. Otherwise it holds a zero
+		padded copy.
+	*/
+	class GF2nLimbView
+	{
+	public:
+		GF2nLimbView()
+			: m_borrowed(NULL)
+			, m_num_limbs(0)
+			{}
+
+		/* borrows limbs */
+		GF2nLimbView( const ufixn *limbs, const uint32 num_limbs )
+			: m_borrowed(limbs)
+			, m_num_limbs(num_limbs)
+			{}
+
+	public:
+		const ufixn *get() const { return m_borrowed ? m_borrowed : m_copy.data(); }
+		uint32 getNumLimbs() const { return m_num_limbs; }
+		bool isBorrowed() const { return m_borrowed != NULL; }
+
+		/* switches the view to an own copy of num_limbs zero limbs */
+		ufixn *allocate( const uint32 num_limbs )
+		{
+			m_borrowed = NULL;
+			m_num_limbs = num_limbs;
+			m_copy.assign(num_limbs, 0);
+			return m_copy.data();
+		}
+
+	private:
+		const ufixn *m_borrowed;
+		uint32 m_num_limbs;
+		std::vector<ufixn> m_copy;
+	};
+
+	/*
+		adapters between elements and BIGNUM, mpz_t and, if built with
+		GF2N_WITH_NTL, NTL::GF2X. They throw InvalidEncodingException if
+		a value does not fit into num_limbs limbs.
+	*/
+	namespace interop {
+
+		/*
+			BIGNUM is opaque since OpenSSL 1.1, so its words are always
+			copied, straight into the limbs without a parse
+		*/
+		GF2nLimbView viewOf( const BIGNUM *value, const uint32 num_limbs );
+		GF2nLimbView viewOf( mpz_srcptr value, const uint32 num_limbs );
+
+		/* the limbs of element are written to ret, no string in between */
+		void copyTo( GF2nArithmeticElement &element, BIGNUM *ret );
+		void copyTo( GF2nArithmeticElement &element, mpz_ptr ret );
+
+		/**
+		 * @brief      Creates an element that takes over value. The
+		 *             OpenSSL backend keeps the BIGNUM itself, the other
+		 *             backends copy its limbs and free it.
+		 */
+		GF2nArithmeticElement adopt( GF2nArithmetic &arithmetic, BIGNUM *value );
+
+#ifdef GF2N_WITH_NTL
+		// the word type _ntl_ulong of NTL is declared outside of its namespace
+		inline GF2nLimbView viewOf( NTL::GF2X const& value, const uint32 num_limbs )
+		{
+			const _ntl_ulong *words = value.xrep.elts();
+			uint32 num_words = static_cast<uint32>(value.xrep.length());
+
+			if( num_words > num_limbs )
+				throw InvalidEncodingException("the value does not fit into the field");
+
+			if( sizeof(_ntl_ulong) == sizeof(ufixn) && num_words == num_limbs )
+				return GF2nLimbView(reinterpret_cast<const ufixn *>(words), num_limbs);
+
+			GF2nLimbView view;
+			ufixn *limbs = view.allocate(num_limbs);
+			if( num_words > 0 )
+				memcpy(limbs, words, num_words * sizeof(_ntl_ulong));
+
+			return view;
+		}
+
+		inline void copyTo( GF2nArithmeticElement &element, NTL::GF2X &ret )
+		{
+			uint32 num_limbs = utils::calcNumberChunks<uint32>(element.getFieldSize(), sizeof(ufixn) * 8);
+			uint32 num_words = utils::calcNumberChunks<uint32>(num_limbs * sizeof(ufixn), sizeof(_ntl_ulong));
+
+			ret.xrep.SetLength(num_words);
+			if( num_words == 0 )
+				return;
+
+			_ntl_ulong *words = ret.xrep.elts();
+			words[num_words - 1] = 0;
+			element.getLimbs(reinterpret_cast<ufixn *>(words), num_limbs);
+			ret.normalize();
+		}
+#endif
+
+		/* creates an element from the limbs of any value viewOf takes */
+		template<typename T>
+		GF2nArithmeticElement getElement( GF2nArithmetic &arithmetic, T const& value )
+		{
+			GF2nLimbView view = viewOf(value, arithmetic.getNumLimbs());
+
+			if( !utils::limbsFit(view.get(), view.getNumLimbs(), arithmetic.getFieldSize()) )
+				throw InvalidEncodingException("the value does not fit into the field");
+
+			return arithmetic.getElementFromLimbs(view.get());
+		}
+	}
+}
+
+#endif // __GF2N_INTEROP_H__
@@ -0,0 +1,148 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GF2N_IRREDUCIBLE_H__
+#define __GF2N_IRREDUCIBLE_H__
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <exception>
+
+#include "CumffaTypes.h"
+
+namespace libcumffa {
+
+	/* the highest degree of the irreducible table */
+	const uint32 GF2N_IRRED_MAX_DEGREE = 2048;
+
+	/* the irreducibles of the table are trinomials or pentanomials */
+	const uint32 GF2N_IRRED_MAX_TERMS = 5;
+
+	class FieldSizeNotSupportedException : public std::exception
+	{
+	public:
+		FieldSizeNotSupportedException( const uint32 field_size )
+		{
+			std::stringstream ss;
+			ss << "There is no irreducible polynomial of degree " << field_size << "!!!";
+			m_str = ss.str();
+		}
+
+	private:
+		virtual const char* what() const throw()
+		{
+			return m_str.c_str();
+		}
+
+	private:
+		std::string m_str;
+	};
+
+	class ReducibleModulusException : public std::exception
+	{
+	private:
+		virtual const char* what() const throw()
+		{
+			return "The modulus is not irreducible!!!";
+		}
+	};
+
+	/*
+		a modulus x^n + x^k1 + ... + 1 as the exponents of its nonzero
+		terms in descending order, padded with -1
+	*/
+	struct GF2nIrreducibleTerms
+	{
+		int32 exponents[GF2N_IRRED_MAX_TERMS];
+	};
+
+	/*
+		row n - 1 holds the modulus of degree n in the form of
+		GF2nIrreducibleTerms, generated by tools/gen_irreps with
+		findIrreducible, which picks the moduli of NTL's BuildSparseIrred
+	*/
+	struct GF2nIrreducibleTable
+	{
+		static constexpr int16 rows[GF2N_IRRED_MAX_DEGREE][GF2N_IRRED_MAX_TERMS] = {
+#include "GF2nIrreducibleTable.inc"
+		};
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		the sparse irreducible polynomials of every degree. Degrees up to
+		GF2N_IRRED_MAX_DEGREE come from a generated table, higher degrees
+		are searched once per process and, if the field cache is open,
+		once per cache file. Every backend derives its own form of the modulus
+		from the exponents when the field size is set.
+	*/
+	namespace utils {
+
+		/*
+			exponent term of the table modulus of degree field_size, -1
+			past the last term. Usable at compile time, for example for
+			the moduli of GF2nFixed.
+		*/
+		constexpr int32 getTableExponent( const uint32 field_size, const uint32 term )
+		{
+			return GF2nIrreducibleTable::rows[field_size - 1][term];
+		}
+
+		/**
+		 * @brief      Returns the modulus of degree field_size, the
+		 *             trinomial or pentanomial with the lowest middle
+		 *             terms above the table
+		 *
+		 * @throw      FieldSizeNotSupportedException if field_size is 0
+		 */
+		GF2nIrreducibleTerms getIrreducibleTerms( const uint32 field_size );
+
+		/* appends the exponents of the modulus in descending order */
+		void getIrreducibleExponents( const uint32 field_size, std::vector<int> &exponents );
+
+		/* the modulus as num_limbs limbs, least significant limb first */
+		void getIrreducibleLimbs( const uint32 field_size, ufixn *limbs, const uint32 num_limbs );
+
+		/**
+		 * @brief      Searches the irreducible trinomial x^n + x^k + 1
+		 *             with the smallest k <= n / 2 and, if there is none,
+		 *             the pentanomial with the smallest middle terms. The
+		 *             candidates are tested in parallel on the default
+		 *             executor, the result does not depend on the number
+		 *             of workers.
+		 */
+		GF2nIrreducibleTerms findIrreducible( const uint32 field_size );
+
+		/* Rabin's irreducibility test with a few Ben-Or rounds up front */
+		bool isIrreducible( GF2nIrreducibleTerms const& terms );
+
+		/**
+		 * @brief      the same test for a modulus of any number of terms,
+		 *             stored least significant limb first. The results
+		 *             are cached by the hash of the modulus, in memory
+		 *             and in the field cache.
+		 */
+		bool isIrreducible( const ufixn *limbs, const uint32 num_limbs );
+	}
+}
+
+#endif // __GF2N_IRREDUCIBLE_H__
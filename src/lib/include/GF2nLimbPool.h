@@ -0,0 +1,137 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GF2N_LIMB_POOL_H__
+#define __GF2N_LIMB_POOL_H__
+
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <atomic>
+
+#include "CumffaTypes.h"
+
+namespace libcumffa {
+
+	class EmptyLimbPoolException : public std::exception
+	{
+		virtual const char* what() const throw()
+		{
+			return "The limb pool can not grow any further!!!";
+		}
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		the Interface for the memory the slabs of a GF2nLimbPool live in.
+		Implement it to place the slabs in device memory.
+	*/
+	class GF2nSlabAllocatorInterface
+	{
+	public:
+		virtual ~GF2nSlabAllocatorInterface() {}
+		virtual void *allocate( const size_t num_bytes ) = 0;
+		virtual void free( void *slab ) = 0;
+	};
+
+	/* slabs in host memory, aligned to a cache line */
+	class GF2nHostSlabAllocator : public GF2nSlabAllocatorInterface
+	{
+	public:
+		virtual void *allocate( const size_t num_bytes );
+		virtual void free( void *slab );
+	};
+
+	/* occupancy of a GF2nLimbPool */
+	struct GF2nLimbPoolStats
+	{
+		uint32 num_slabs;
+		uint32 capacity;
+		uint32 in_use;
+		uint32 peak_in_use;
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		pool of equally sized slots for limb buffers. Slots are handed out
+		by index from a lock-free free list, get and free are O(1). The
+		pool grows by one slab whenever it runs empty, the first slab has
+		slots_per_slab slots and every further slab twice the slots of the
+		one before. Slots start at cache line boundaries. The bookkeeping
+		stays on the host, so the slabs themselves may live in device
+		memory. Slots and slabs are released when the pool is destroyed.
+	*/
+	class GF2nLimbPool
+	{
+	public:
+		GF2nLimbPool( const size_t slot_bytes, const uint32 slots_per_slab, std::shared_ptr<GF2nSlabAllocatorInterface> allocator=std::shared_ptr<GF2nSlabAllocatorInterface>() );
+		~GF2nLimbPool();
+
+	public:
+		/**
+		 * @brief      Takes a free slot, grows the pool if there is none
+		 *
+		 * @throw      EmptyLimbPoolException if the maximum number of slabs is reached
+		 */
+		uint32 get();
+		void free( const uint32 slot );
+		void *getData( const uint32 slot ) const;
+		size_t getSlotBytes() const;
+		GF2nLimbPoolStats getStats() const;
+
+	private:
+		GF2nLimbPool( const GF2nLimbPool& );
+		void operator=( const GF2nLimbPool& );
+
+		struct Slab
+		{
+			char *data;
+			/* next free slot + 1 of every slot, 0 ends the list */
+			std::unique_ptr<std::atomic<uint32>[]> next;
+		};
+
+		void grow();
+		uint32 getSlabIndex( const uint32 slot ) const;
+		uint32 getFirstSlot( const uint32 slab ) const;
+
+	private:
+		static const uint32 MAX_SLABS = 32;
+
+		size_t m_slot_bytes;
+		/* m_slot_bytes rounded up to whole cache lines */
+		size_t m_slot_stride;
+		uint32 m_slots_per_slab;
+		std::shared_ptr<GF2nSlabAllocatorInterface> m_allocator;
+
+		/* slabs are only added, an entry never changes once it is set */
+		Slab m_slabs[MAX_SLABS];
+		std::atomic<uint32> m_num_slabs;
+		std::mutex m_grow_mutex;
+
+		/* top slot + 1 of the free list in the lower, ABA tag in the upper half */
+		std::atomic<uint64> m_head;
+
+		std::atomic<uint32> m_in_use;
+		std::atomic<uint32> m_peak_in_use;
+	};
+}
+
+#endif // __GF2N_LIMB_POOL_H__
@@ -0,0 +1,620 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __GF2N_NATIVE_KERNELS_H__
+#define __GF2N_NATIVE_KERNELS_H__
+
+#include <vector>
+#include <algorithm>
+
+#include "CumffaTypes.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define GF2N_NATIVE_X86
+#include <immintrin.h>
+#endif
+
+/* inlines every call of the function body, across instruction set targets */
+#define GF2N_FLATTEN __attribute__((flatten))
+
+namespace libcumffa {
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		calls f(I), f(I + 1), ..., f(END - 1) without a loop
+	*/
+	template<uint32 I, uint32 END>
+	struct GF2nUnroll
+	{
+		template<typename F>
+		static inline void run( F const& f )
+		{
+			f(I);
+			GF2nUnroll<I + 1, END>::run(f);
+		}
+	};
+
+	template<uint32 END>
+	struct GF2nUnroll<END, END>
+	{
+		template<typename F>
+		static inline void run( F const& f ) {}
+	};
+
+	namespace native {
+
+		/* the CPU features that the native kernels use */
+		enum GF2nCpuFeature
+		{
+			GF2N_CPU_PCLMUL = 0x1,
+			GF2N_CPU_SSE41 = 0x2,
+			GF2N_CPU_AVX2 = 0x4,
+			GF2N_CPU_AVX512F = 0x8,
+			GF2N_CPU_VPCLMUL = 0x10
+		};
+
+		/*
+			the instruction sets the native kernels are built for, every
+			set includes the ones before it
+		*/
+		enum GF2nIsa
+		{
+			/* 64 bit integer instructions */
+			GF2N_ISA_BASELINE = 0,
+			/* PCLMULQDQ and SSE4.1 */
+			GF2N_ISA_PCLMUL = 1,
+			/* AVX2 */
+			GF2N_ISA_AVX2 = 2,
+			/* AVX-512F and VPCLMULQDQ */
+			GF2N_ISA_AVX512 = 3
+		};
+
+		/* the GF2nCpuFeature bits of this CPU, read once */
+		uint32 getCpuFeatures();
+
+		/*
+			the best instruction set of this CPU up to the limit. A field
+			context selects its kernels by it when it is created.
+		*/
+		GF2nIsa getIsa();
+
+		/*
+			caps the instruction set of the contexts created afterwards,
+			to compare or benchmark the variants on one host
+		*/
+		void setIsaLimit( const GF2nIsa isa );
+
+		const char *getIsaName( const GF2nIsa isa );
+
+		/**
+		 * @brief      Inserts a zero bit after every bit of x
+		 */
+		inline uint64 spread32( const uint32 x )
+		{
+			uint64 r = x;
+			r = (r | (r << 16)) & 0x0000FFFF0000FFFFULL;
+			r = (r | (r << 8)) & 0x00FF00FF00FF00FFULL;
+			r = (r | (r << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+			r = (r | (r << 2)) & 0x3333333333333333ULL;
+			r = (r | (r << 1)) & 0x5555555555555555ULL;
+			return r;
+		}
+
+		/**
+		 * @brief      Square of a 64 bit word, squaring is linear in GF(2)[x]
+		 */
+		inline void sqr64( const uint64 a, uint64 &lo, uint64 &hi )
+		{
+			lo = spread32(static_cast<uint32>(a));
+			hi = spread32(static_cast<uint32>(a >> 32));
+		}
+
+		/**
+		 * @brief      Adds value shifted by bit_pos bits to the word array c
+		 */
+		inline void xorShifted( uint64 *c, const uint64 value, const uint32 bit_pos )
+		{
+			uint32 word = bit_pos / 64;
+			uint32 shift = bit_pos % 64;
+
+			c[word] ^= value << shift;
+			if( shift != 0 )
+				c[word + 1] ^= value >> (64 - shift);
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		/*
+			the product and square of NUM words, fully unrolled on the word
+			multiply (table, mul and sqr) of the policy Word. A policy calls
+			them from a GF2N_FLATTEN function of its target, which inlines
+			the word multiplies into one straight block.
+		*/
+		template<typename Word, uint32 NUM>
+		inline void unrolledProduct( const uint64 *a, const uint64 *b, uint64 *out )
+		{
+			GF2nUnroll<0, 2 * NUM>::run([&]( const uint32 k ) {
+				out[k] = 0;
+			});
+
+			GF2nUnroll<0, NUM>::run([&]( const uint32 i ) {
+				typename Word::Table tab;
+				Word::table(a[i], tab);
+
+				GF2nUnroll<0, NUM>::run([&]( const uint32 j ) {
+					uint64 lo, hi;
+					Word::mul(tab, b[j], lo, hi);
+					out[i + j] ^= lo;
+					out[i + j + 1] ^= hi;
+				});
+			});
+		}
+
+		template<typename Word, uint32 NUM>
+		inline void unrolledSquare( const uint64 *a, uint64 *out )
+		{
+			GF2nUnroll<0, NUM>::run([&]( const uint32 i ) {
+				Word::sqr(a[i], out[2 * i], out[2 * i + 1]);
+			});
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		/*
+			carry-less products of word arrays, one policy per instruction
+			set. product writes the num_a + num_b words of a * b and square
+			the 2 * num_a words of a^2, out overlaps no operand. Words are
+			stored least significant first. productOf and squareOf do the
+			same for NUM words known at compile time.
+		*/
+		struct GF2nClmulBaseline
+		{
+			static const GF2nIsa isa = GF2N_ISA_BASELINE;
+
+			/*
+				the lower 61 bits of a multiplied by every 4 bit polynomial,
+				the 3 top bits of a are added separately
+			*/
+			struct Table
+			{
+				uint64 a;
+				uint64 tab[16];
+			};
+
+			static inline void table( const uint64 a, Table &tab )
+			{
+				uint64 a1 = a & 0x1FFFFFFFFFFFFFFFULL;
+
+				tab.a = a;
+				tab.tab[0] = 0;
+				tab.tab[1] = a1;
+
+				for( uint32 j=2; j<16; j+=2 )
+				{
+					tab.tab[j] = tab.tab[j >> 1] << 1;
+					tab.tab[j + 1] = tab.tab[j] ^ a1;
+				}
+			}
+
+			/**
+			 * @brief      Carry-less product of the word of tab and b
+			 *
+			 * @param[out] lo    the lower 64 bits of the product
+			 * @param[out] hi    the upper 63 bits of the product
+			 */
+			static inline void mul( const Table &tab, const uint64 b, uint64 &lo, uint64 &hi )
+			{
+				uint64 s = tab.tab[b & 0xF];
+				lo = s;
+				hi = 0;
+
+				for( uint32 i=4; i<64; i+=4 )
+				{
+					s = tab.tab[(b >> i) & 0xF];
+					lo ^= s << i;
+					hi ^= s >> (64 - i);
+				}
+
+				// the top 3 bits of a
+				for( uint32 i=61; i<64; ++i )
+				{
+					uint64 mask = 0 - ((tab.a >> i) & 1);
+					lo ^= (b << i) & mask;
+					hi ^= (b >> (64 - i)) & mask;
+				}
+			}
+
+			static inline void product( const uint64 *a, const uint32 num_a, const uint64 *b, const uint32 num_b, uint64 *out )
+			{
+				for( uint32 i=0; i<num_a + num_b; ++i )
+					out[i] = 0;
+
+				for( uint32 i=0; i<num_a; ++i )
+				{
+					if( a[i] == 0 )
+						continue;
+
+					Table tab;
+					table(a[i], tab);
+
+					for( uint32 j=0; j<num_b; ++j )
+					{
+						uint64 lo, hi;
+						mul(tab, b[j], lo, hi);
+						out[i + j] ^= lo;
+						out[i + j + 1] ^= hi;
+					}
+				}
+			}
+
+			static inline void square( const uint64 *a, const uint32 num_a, uint64 *out )
+			{
+				for( uint32 i=0; i<num_a; ++i )
+					sqr64(a[i], out[2 * i], out[2 * i + 1]);
+			}
+
+			static inline void sqr( const uint64 a, uint64 &lo, uint64 &hi )
+			{
+				sqr64(a, lo, hi);
+			}
+
+			template<uint32 NUM>
+			GF2N_FLATTEN static inline void productOf( const uint64 *a, const uint64 *b, uint64 *out )
+			{
+				unrolledProduct<GF2nClmulBaseline, NUM>(a, b, out);
+			}
+
+			template<uint32 NUM>
+			GF2N_FLATTEN static inline void squareOf( const uint64 *a, uint64 *out )
+			{
+				unrolledSquare<GF2nClmulBaseline, NUM>(a, out);
+			}
+		};
+
+#ifdef GF2N_NATIVE_X86
+		/*
+			the functions of the x86 policies carry the target of their
+			instruction set, so every build holds all of them and the
+			instruction set is chosen at runtime. The compiler does not
+			clear the upper vector halves when such a function returns,
+			which slows down the SSE code of the caller, so the AVX
+			kernels end with _mm256_zeroupper.
+		*/
+#define GF2N_TARGET_PCLMUL __attribute__((target("pclmul,sse4.1")))
+#define GF2N_TARGET_AVX2 __attribute__((target("pclmul,sse4.1,avx2")))
+#define GF2N_TARGET_AVX512 __attribute__((target("pclmul,sse4.1,avx2,avx512f,vpclmulqdq")))
+
+		/*
+			product scanning, the 128 bit products of an output word are
+			summed in a register and only the upper half is carried into
+			the next word
+		*/
+		GF2N_TARGET_PCLMUL inline void clmulProduct( const uint64 *a, const uint32 num_a, const uint64 *b, const uint32 num_b, uint64 *out )
+		{
+			uint64 carry = 0;
+
+			for( uint32 k=0; k<num_a + num_b - 1; ++k )
+			{
+				__m128i acc = _mm_setzero_si128();
+				uint32 first = (k + 1 > num_b) ? k + 1 - num_b : 0;
+				uint32 last = (k < num_a - 1) ? k : num_a - 1;
+
+				for( uint32 i=first; i<=last; ++i )
+				{
+					__m128i x = _mm_set_epi64x(static_cast<long long>(b[k - i]), static_cast<long long>(a[i]));
+					acc = _mm_xor_si128(acc, _mm_clmulepi64_si128(x, x, 0x10));
+				}
+
+				out[k] = static_cast<uint64>(_mm_cvtsi128_si64(acc)) ^ carry;
+				carry = static_cast<uint64>(_mm_extract_epi64(acc, 1));
+			}
+
+			out[num_a + num_b - 1] = carry;
+		}
+
+		GF2N_TARGET_PCLMUL inline void clmulSquare( const uint64 *a, const uint32 num_a, uint64 *out )
+		{
+			for( uint32 i=0; i<num_a; ++i )
+			{
+				__m128i x = _mm_cvtsi64_si128(static_cast<long long>(a[i]));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * i), _mm_clmulepi64_si128(x, x, 0x00));
+			}
+		}
+
+		struct GF2nClmulPclmul
+		{
+			static const GF2nIsa isa = GF2N_ISA_PCLMUL;
+
+			/* the carry-less multiply instruction needs no table */
+			struct Table
+			{
+				uint64 a;
+			};
+
+			GF2N_TARGET_PCLMUL static inline void table( const uint64 a, Table &tab )
+			{
+				tab.a = a;
+			}
+
+			GF2N_TARGET_PCLMUL static inline void mul( const Table &tab, const uint64 b, uint64 &lo, uint64 &hi )
+			{
+				__m128i r = _mm_clmulepi64_si128(_mm_cvtsi64_si128(static_cast<long long>(tab.a)), _mm_cvtsi64_si128(static_cast<long long>(b)), 0x00);
+				lo = static_cast<uint64>(_mm_cvtsi128_si64(r));
+				hi = static_cast<uint64>(_mm_extract_epi64(r, 1));
+			}
+
+			GF2N_TARGET_PCLMUL static inline void product( const uint64 *a, const uint32 num_a, const uint64 *b, const uint32 num_b, uint64 *out )
+			{
+				clmulProduct(a, num_a, b, num_b, out);
+			}
+
+			GF2N_TARGET_PCLMUL static inline void square( const uint64 *a, const uint32 num_a, uint64 *out )
+			{
+				clmulSquare(a, num_a, out);
+			}
+
+			GF2N_TARGET_PCLMUL static inline void sqr( const uint64 a, uint64 &lo, uint64 &hi )
+			{
+				__m128i x = _mm_cvtsi64_si128(static_cast<long long>(a));
+				__m128i r = _mm_clmulepi64_si128(x, x, 0x00);
+				lo = static_cast<uint64>(_mm_cvtsi128_si64(r));
+				hi = static_cast<uint64>(_mm_extract_epi64(r, 1));
+			}
+
+			template<uint32 NUM>
+			GF2N_TARGET_PCLMUL GF2N_FLATTEN static inline void productOf( const uint64 *a, const uint64 *b, uint64 *out )
+			{
+				unrolledProduct<GF2nClmulPclmul, NUM>(a, b, out);
+			}
+
+			template<uint32 NUM>
+			GF2N_TARGET_PCLMUL GF2N_FLATTEN static inline void squareOf( const uint64 *a, uint64 *out )
+			{
+				unrolledSquare<GF2nClmulPclmul, NUM>(a, out);
+			}
+		};
+
+		/* the kernels of GF2nClmulPclmul in VEX encoding */
+		struct GF2nClmulAvx2
+		{
+			static const GF2nIsa isa = GF2N_ISA_AVX2;
+
+			GF2N_TARGET_AVX2 static inline void product( const uint64 *a, const uint32 num_a, const uint64 *b, const uint32 num_b, uint64 *out )
+			{
+				clmulProduct(a, num_a, b, num_b, out);
+				_mm256_zeroupper();
+			}
+
+			GF2N_TARGET_AVX2 static inline void square( const uint64 *a, const uint32 num_a, uint64 *out )
+			{
+				clmulSquare(a, num_a, out);
+				_mm256_zeroupper();
+			}
+
+			template<uint32 NUM>
+			GF2N_TARGET_AVX2 GF2N_FLATTEN static inline void productOf( const uint64 *a, const uint64 *b, uint64 *out )
+			{
+				unrolledProduct<GF2nClmulPclmul, NUM>(a, b, out);
+				_mm256_zeroupper();
+			}
+
+			template<uint32 NUM>
+			GF2N_TARGET_AVX2 GF2N_FLATTEN static inline void squareOf( const uint64 *a, uint64 *out )
+			{
+				unrolledSquare<GF2nClmulPclmul, NUM>(a, out);
+				_mm256_zeroupper();
+			}
+		};
+
+		/*
+			VPCLMULQDQ multiplies a word by 4 words at once. product scans
+			8 result words at a time: a[i] times the even words of
+			b[k - i, k - i + 8) lands on the 128 bit lanes of the words
+			[k, k + 8), the odd products one word higher.
+		*/
+		struct GF2nClmulAvx512
+		{
+			static const GF2nIsa isa = GF2N_ISA_AVX512;
+
+			GF2N_TARGET_AVX512 static inline __mmask8 firstWords( const uint32 n )
+			{
+				return static_cast<__mmask8>(n >= 8 ? 0xFF : (1U << n) - 1);
+			}
+
+			/*
+				stores the first n words of x. Masked stores are not
+				forwarded to the word loads of the reduction, so the
+				words go out in unmasked parts.
+			*/
+			GF2N_TARGET_AVX512 static inline void storeWords( uint64 *out, const uint32 n, const __m512i x )
+			{
+				if( n >= 8 )
+				{
+					_mm512_storeu_si512(out, x);
+					return;
+				}
+
+				uint32 pos = 0;
+				__m256i y = _mm512_maskz_extracti64x4_epi64(0xF, x, 0);
+				if( n >= 4 )
+				{
+					_mm256_storeu_si256(reinterpret_cast<__m256i *>(out), y);
+					y = _mm512_maskz_extracti64x4_epi64(0xF, x, 1);
+					pos = 4;
+				}
+
+				__m128i z = _mm256_castsi256_si128(y);
+				if( n - pos >= 2 )
+				{
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(out + pos), z);
+					z = _mm256_extracti128_si256(y, 1);
+					pos += 2;
+				}
+
+				if( n - pos == 1 )
+					out[pos] = static_cast<uint64>(_mm_cvtsi128_si64(z));
+			}
+
+			GF2N_TARGET_AVX512 static inline void product( const uint64 *a, const uint32 num_a, const uint64 *b, const uint32 num_b, uint64 *out )
+			{
+				const int64 n_a = num_a;
+				const int64 n_b = num_b;
+				const int64 num_out = n_a + n_b;
+				__m512i carry = _mm512_setzero_si512();
+
+				for( int64 k=0; k<num_out; k+=8 )
+				{
+					__m512i even = _mm512_setzero_si512();
+					__m512i odd = _mm512_setzero_si512();
+					int64 first = std::max<int64>(0, k - n_b + 1);
+					int64 last = std::min<int64>(n_a - 1, k + 7);
+
+					for( int64 i=first; i<=last; ++i )
+					{
+						// the words of b in [0, num_b)
+						int64 lo = std::max<int64>(0, i - k);
+						int64 hi = std::min<int64>(8, n_b - k + i);
+						__mmask8 mask = static_cast<__mmask8>(firstWords(static_cast<uint32>(hi)) & ~firstWords(static_cast<uint32>(lo)));
+
+						__m512i bi = _mm512_maskz_loadu_epi64(mask, b + (k - i));
+						__m512i ai = _mm512_set1_epi64(static_cast<long long>(a[i]));
+
+						even = _mm512_xor_si512(even, _mm512_clmulepi64_epi128(ai, bi, 0x00));
+						odd = _mm512_xor_si512(odd, _mm512_clmulepi64_epi128(ai, bi, 0x10));
+					}
+
+					// odd one word up, its top word goes to the next block
+					__m512i words = _mm512_xor_si512(even, _mm512_maskz_alignr_epi64(0xFF, odd, carry, 7));
+					storeWords(out + k, static_cast<uint32>(std::min<int64>(8, num_out - k)), words);
+					carry = odd;
+				}
+
+				_mm256_zeroupper();
+			}
+
+			GF2N_TARGET_AVX512 static inline void square( const uint64 *a, const uint32 num_a, uint64 *out )
+			{
+				// interleaves the squares of the even and the odd words
+				const __m512i first = _mm512_set_epi64(11, 10, 3, 2, 9, 8, 1, 0);
+				const __m512i second = _mm512_set_epi64(15, 14, 7, 6, 13, 12, 5, 4);
+
+				for( uint32 i=0; i<num_a; i+=8 )
+				{
+					uint32 n = num_a - i < 8 ? num_a - i : 8;
+					__m512i x = _mm512_maskz_loadu_epi64(firstWords(n), a + i);
+					__m512i even = _mm512_clmulepi64_epi128(x, x, 0x00);
+					__m512i odd = _mm512_clmulepi64_epi128(x, x, 0x11);
+
+					storeWords(out + 2 * i, 2 * n, _mm512_permutex2var_epi64(even, first, odd));
+					if( n > 4 )
+						storeWords(out + 2 * i + 8, 2 * n - 8, _mm512_permutex2var_epi64(even, second, odd));
+				}
+
+				_mm256_zeroupper();
+			}
+
+			template<uint32 NUM>
+			GF2N_TARGET_AVX512 GF2N_FLATTEN static inline void productOf( const uint64 *a, const uint64 *b, uint64 *out )
+			{
+				unrolledProduct<GF2nClmulPclmul, NUM>(a, b, out);
+				_mm256_zeroupper();
+			}
+
+			template<uint32 NUM>
+			GF2N_TARGET_AVX512 GF2N_FLATTEN static inline void squareOf( const uint64 *a, uint64 *out )
+			{
+				unrolledSquare<GF2nClmulPclmul, NUM>(a, out);
+				_mm256_zeroupper();
+			}
+		};
+#endif
+
+		/* the policy of the instruction set the code is compiled for */
+#if defined(__PCLMUL__) && defined(__SSE4_1__)
+		typedef GF2nClmulPclmul GF2nClmulHost;
+#else
+		typedef GF2nClmulBaseline GF2nClmulHost;
+#endif
+
+		typedef GF2nClmulHost::Table GF2nClmulTable;
+
+		inline void clmulTable( const uint64 a, GF2nClmulTable &tab )
+		{
+			GF2nClmulHost::table(a, tab);
+		}
+
+		inline void clmul64( const GF2nClmulTable &tab, const uint64 b, uint64 &lo, uint64 &hi )
+		{
+			GF2nClmulHost::mul(tab, b, lo, hi);
+		}
+
+		/**
+		 * @brief      Carry-less product of two 64 bit words
+		 */
+		inline void clmul64( const uint64 a, const uint64 b, uint64 &lo, uint64 &hi )
+		{
+			GF2nClmulTable tab;
+			clmulTable(a, tab);
+			clmul64(tab, b, lo, hi);
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		/*
+			the product and square of a policy for word arrays of any
+			length
+		*/
+		struct GF2nWordKernels
+		{
+			GF2nIsa isa;
+			void (*product)( const uint64 *a, const uint32 num_a, const uint64 *b, const uint32 num_b, uint64 *out );
+			void (*square)( const uint64 *a, const uint32 num_a, uint64 *out );
+		};
+
+		/* the word kernels of isa, or of the best set below it that this build has */
+		const GF2nWordKernels &getWordKernels( const GF2nIsa isa );
+
+		///////////////////////////////////////////////////////////////////////
+		/*
+			kernels of a field whose modulus has a hard coded reduction. All
+			operands are getNumLimbs() limbs, least significant limb first.
+		*/
+		struct GF2nNativeField
+		{
+			uint32 field_size;
+			GF2nIsa isa;
+			void (*mul)( const ufixn *a, const ufixn *b, ufixn *out );
+			void (*exp)( const ufixn *a, const uint32 value, ufixn *out );
+			void (*inverse)( const ufixn *a, ufixn *out );
+		};
+
+		/**
+		 * @brief      Returns the native kernels of the NIST binary fields
+		 *             163, 233, 283, 409 and 571 built for isa
+		 *
+		 * @param[in]  irred_poly  The exponents of the modulus in descending
+		 *                         order, optionally terminated by -1
+		 *
+		 * @return     NULL if irred_poly is not one of the NIST moduli or
+		 *             isa has no carry-less multiply
+		 */
+		const GF2nNativeField *findNativeField( const std::vector<int> &irred_poly, const GF2nIsa isa );
+	}
+}
+
+#endif // __GF2N_NATIVE_KERNELS_H__
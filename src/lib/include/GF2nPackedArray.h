@@ -0,0 +1,199 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __GF2N_PACKED_ARRAY_H__
+#define __GF2N_PACKED_ARRAY_H__
+
+#include <string>
+#include <sstream>
+#include <exception>
+
+#include "CumffaTypes.h"
+#include "GF2nArithmetic.h"
+
+namespace libcumffa {
+
+	class PackedArrayIOException : public std::exception
+	{
+	public:
+		PackedArrayIOException( const std::string &path, const std::string &reason )
+		{
+			std::stringstream ss;
+			ss << "Packed array " << path << ": " << reason << "!!!";
+			m_str = ss.str();
+		}
+
+	private:
+		virtual const char* what() const throw()
+		{
+			return m_str.c_str();
+		}
+
+	private:
+		std::string m_str;
+	};
+
+	class PackedArrayFormatException : public std::exception
+	{
+	public:
+		PackedArrayFormatException( const std::string &path, const std::string &reason )
+		{
+			std::stringstream ss;
+			ss << "Packed array " << path << " does not match: " << reason << "!!!";
+			m_str = ss.str();
+		}
+
+	private:
+		virtual const char* what() const throw()
+		{
+			return m_str.c_str();
+		}
+
+	private:
+		std::string m_str;
+	};
+
+	/* the current version of the packed array format */
+	const uint32 GF2N_PACKED_ARRAY_VERSION = 1;
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		the first 64 bytes of a packed array file. All fields and the
+		limbs are stored in the byte order of the machine that wrote the
+		file, byte_order tells a reader of the other order apart.
+	*/
+	struct GF2nPackedArrayHeader
+	{
+		/* "GF2NPACK" */
+		char magic[8];
+		uint32 version;
+		uint32 header_bytes;
+		/* 0x01020304 */
+		uint32 byte_order;
+		uint32 field_size;
+		/* GF2nArithmetic::getModulusHash() of the field */
+		uint64 modulus_hash;
+		/* bits of a limb */
+		uint32 limb_bits;
+		/* limbs per element, at least the number of limbs of the field */
+		uint32 stride;
+		/* number of elements */
+		uint64 count;
+		uint8 reserved[16];
+	};
+
+	enum GF2nPackedArrayAccess
+	{
+		GF2N_PACKED_READ = 0,
+		GF2N_PACKED_READ_WRITE = 1
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		a memory mapped file of field elements. The header is followed
+		by getCount() elements of getStride() limbs in the batch layout
+		of GF2nArithmetic, so getLimbs() can be passed to the batch
+		operations as input or, if the array is writable, as output
+		without parsing or copying. The kernel pages the file in and out
+		as the batch runs, so the file may be larger than the memory.
+	*/
+	class GF2nPackedArray
+	{
+	public:
+		GF2nPackedArray();
+		GF2nPackedArray( GF2nPackedArray &&other );
+		GF2nPackedArray &operator=( GF2nPackedArray &&other );
+		~GF2nPackedArray();
+
+	public:
+		/**
+		 * @brief      Creates or truncates the file at path and maps it
+		 *             writable with count zero elements of the field of
+		 *             arithmetic
+		 *
+		 * @param[in]  stride      limbs per element, 0 selects getNumLimbs()
+		 *
+		 * @throw      PackedArrayIOException if the file cannot be created
+		 * @throw      InvalidBatchStrideException if stride is too small
+		 */
+		static GF2nPackedArray create( const std::string &path, GF2nArithmetic &arithmetic, const size_t count, const uint32 stride=0 );
+
+		/**
+		 * @brief      Maps an existing file
+		 *
+		 * @throw      PackedArrayIOException if the file cannot be mapped
+		 * @throw      PackedArrayFormatException if the file is no packed
+		 *             array or holds elements of another field
+		 */
+		static GF2nPackedArray open( const std::string &path, GF2nArithmetic &arithmetic, const GF2nPackedArrayAccess access=GF2N_PACKED_READ );
+
+		/**
+		 * @brief      Returns the header of count elements of stride limbs
+		 *             of the field of arithmetic, for streams that carry
+		 *             the packed format
+		 *
+		 * @throw      InvalidBatchStrideException if stride is too small
+		 */
+		static GF2nPackedArrayHeader makeHeader( GF2nArithmetic &arithmetic, const size_t count, const uint32 stride=0 );
+
+		/**
+		 * @brief      Checks that header describes elements of the field
+		 *             of arithmetic, name is used for the messages
+		 *
+		 * @throw      PackedArrayFormatException if it does not
+		 */
+		static void checkHeader( const std::string &name, const GF2nPackedArrayHeader &header, GF2nArithmetic &arithmetic );
+
+	public:
+		const GF2nPackedArrayHeader &getHeader() const;
+		size_t getCount() const;
+		uint32 getStride() const;
+		bool isWritable() const;
+
+		/* the limbs of element 0, element i starts at getLimbs() + i * getStride() */
+		const ufixn *getLimbs() const;
+		/* writing the limbs of a read only array faults */
+		ufixn *getLimbs();
+
+		/* hints the kernel to read elements [first, first + count) ahead */
+		void prefetch( const size_t first, const size_t count );
+		/* hints the kernel that elements [first, first + count) are done */
+		void evict( const size_t first, const size_t count );
+		/* writes changed limbs back to the file */
+		void sync();
+
+	private:
+		GF2nPackedArray( const GF2nPackedArray& );
+		void operator=( const GF2nPackedArray& );
+
+		void map( const std::string &path, const int fd, const size_t num_bytes, const bool writable );
+		void adviseRange( const size_t first, const size_t count, const int advice );
+		void release();
+
+	private:
+		void *m_mapping;
+		size_t m_mapped_bytes;
+		bool m_writable;
+	};
+}
+
+#endif // __GF2N_PACKED_ARRAY_H__
@@ -0,0 +1,173 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/GF2nAlignedMemory.h"
+#include <new>
+#include <cstdlib>
+#include <cstring>
+#include <sys/mman.h>
+
+namespace libcumffa {
+
+	/**************************************************************************\
+
+						aligned allocation
+
+	\**************************************************************************/
+
+	void *allocAligned( const size_t num_bytes )
+	{
+		void *ptr = NULL;
+
+		if( posix_memalign(&ptr, GF2N_CACHE_LINE_SIZE, num_bytes > 0 ? num_bytes : 1) != 0 )
+			throw std::bad_alloc();
+
+		return ptr;
+	}
+
+	void freeAligned( void *ptr )
+	{
+		std::free(ptr);
+	}
+
+	/**************************************************************************\
+
+						class GF2nBatchBuffer implementations
+
+	\**************************************************************************/
+
+	GF2nBatchBuffer::GF2nBatchBuffer()
+		: m_limbs(NULL)
+		, m_num_limbs(0)
+		, m_mapped_bytes(0)
+		, m_huge_pages(false)
+	{
+	}
+
+	GF2nBatchBuffer::GF2nBatchBuffer( const size_t num_limbs, const GF2nPageMode mode )
+		: m_limbs(NULL)
+		, m_num_limbs(num_limbs)
+		, m_mapped_bytes(0)
+		, m_huge_pages(false)
+	{
+		size_t num_bytes = num_limbs * sizeof(ufixn);
+
+		if( num_bytes < GF2N_HUGE_PAGE_SIZE )
+		{
+			m_limbs = allocAligned<ufixn>(num_limbs);
+			memset(m_limbs, 0, num_bytes);
+			return;
+		}
+
+		// mappings are page aligned and zero filled
+		size_t mapped_bytes = (num_bytes + GF2N_HUGE_PAGE_SIZE - 1) & ~(GF2N_HUGE_PAGE_SIZE - 1);
+		void *ptr = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+		if( mode == GF2N_PAGES_EXPLICIT )
+		{
+			ptr = mmap(NULL, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+			m_huge_pages = (ptr != MAP_FAILED);
+		}
+#endif
+
+		if( ptr == MAP_FAILED )
+		{
+			ptr = mmap(NULL, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+			if( ptr == MAP_FAILED )
+				throw std::bad_alloc();
+
+#ifdef MADV_HUGEPAGE
+			if( mode != GF2N_PAGES_DEFAULT )
+				madvise(ptr, mapped_bytes, MADV_HUGEPAGE);
+#endif
+		}
+
+		m_limbs = static_cast<ufixn *>(ptr);
+		m_mapped_bytes = mapped_bytes;
+	}
+
+	GF2nBatchBuffer::GF2nBatchBuffer( GF2nBatchBuffer &&other )
+		: m_limbs(other.m_limbs)
+		, m_num_limbs(other.m_num_limbs)
+		, m_mapped_bytes(other.m_mapped_bytes)
+		, m_huge_pages(other.m_huge_pages)
+	{
+		other.m_limbs = NULL;
+		other.m_num_limbs = 0;
+		other.m_mapped_bytes = 0;
+		other.m_huge_pages = false;
+	}
+
+	GF2nBatchBuffer &GF2nBatchBuffer::operator=( GF2nBatchBuffer &&other )
+	{
+		if( this != &other )
+		{
+			release();
+
+			m_limbs = other.m_limbs;
+			m_num_limbs = other.m_num_limbs;
+			m_mapped_bytes = other.m_mapped_bytes;
+			m_huge_pages = other.m_huge_pages;
+
+			other.m_limbs = NULL;
+			other.m_num_limbs = 0;
+			other.m_mapped_bytes = 0;
+			other.m_huge_pages = false;
+		}
+
+		return *this;
+	}
+
+	GF2nBatchBuffer::~GF2nBatchBuffer()
+	{
+		release();
+	}
+
+	ufixn *GF2nBatchBuffer::get() const
+	{
+		return m_limbs;
+	}
+
+	size_t GF2nBatchBuffer::getNumLimbs() const
+	{
+		return m_num_limbs;
+	}
+
+	bool GF2nBatchBuffer::isHugePageBacked() const
+	{
+		return m_huge_pages;
+	}
+
+	void GF2nBatchBuffer::release()
+	{
+		if( m_limbs == NULL )
+			return;
+
+		if( m_mapped_bytes > 0 )
+			munmap(m_limbs, m_mapped_bytes);
+		else
+			freeAligned(m_limbs);
+
+		m_limbs = NULL;
+	}
+}
@@ -0,0 +1,177 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/GF2nArena.h"
+#include <new>
+#include <cstdlib>
+#include <algorithm>
+
+namespace libcumffa {
+
+	// all allocations are aligned like malloc
+	static const size_t ALIGNMENT = 16;
+
+	// the size of the header in front of every element allocation,
+	// it holds the arena of the allocation or NULL for the heap
+	static const size_t HEADER_SIZE = ALIGNMENT;
+
+	// the arena bound by the innermost GF2nArenaScope of the thread
+	static thread_local GF2nArena *tl_arena = NULL;
+
+	static size_t alignUp( const size_t size )
+	{
+		return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+	}
+
+	/**************************************************************************\
+
+						class GF2nArena implementations
+
+	\**************************************************************************/
+
+	GF2nArena::GF2nArena( const size_t block_size )
+		: m_block_size(alignUp(block_size))
+		, m_current(0)
+		, m_offset(0)
+		, m_used_before(0)
+	{
+	}
+
+	GF2nArena::~GF2nArena()
+	{
+		for( size_t i=0; i<m_blocks.size(); ++i )
+			std::free(m_blocks[i]);
+	}
+
+	void *GF2nArena::allocate( const size_t size )
+	{
+		size_t aligned_size = alignUp(size);
+
+		// go on with the next block that is large enough, blocks that
+		// are skipped stay unused until the next reset
+		while( m_current < m_blocks.size() && m_offset + aligned_size > m_block_sizes[m_current] )
+		{
+			m_used_before += m_block_sizes[m_current];
+			++m_current;
+			m_offset = 0;
+		}
+
+		if( m_current == m_blocks.size() )
+		{
+			size_t block_size = std::max(m_block_size, aligned_size);
+			char *block = static_cast<char *>(std::malloc(block_size));
+
+			if( block == NULL )
+				throw std::bad_alloc();
+
+			m_blocks.push_back(block);
+			m_block_sizes.push_back(block_size);
+		}
+
+		void *ptr = m_blocks[m_current] + m_offset;
+		m_offset += aligned_size;
+
+		return ptr;
+	}
+
+	void GF2nArena::reset()
+	{
+		m_current = 0;
+		m_offset = 0;
+		m_used_before = 0;
+	}
+
+	size_t GF2nArena::getUsedBytes() const
+	{
+		return m_used_before + m_offset;
+	}
+
+	size_t GF2nArena::getReservedBytes() const
+	{
+		size_t reserved = 0;
+		for( size_t i=0; i<m_block_sizes.size(); ++i )
+			reserved += m_block_sizes[i];
+
+		return reserved;
+	}
+
+	/**************************************************************************\
+
+						class GF2nArenaScope implementations
+
+	\**************************************************************************/
+
+	GF2nArenaScope::GF2nArenaScope( GF2nArena &arena )
+		: m_previous(tl_arena)
+	{
+		tl_arena = &arena;
+	}
+
+	GF2nArenaScope::~GF2nArenaScope()
+	{
+		tl_arena = m_previous;
+	}
+
+	/**************************************************************************\
+
+						element memory
+
+	\**************************************************************************/
+
+	GF2nArena *getThreadArena()
+	{
+		return tl_arena;
+	}
+
+	void *allocElementMemory( const size_t size )
+	{
+		GF2nArena *arena = tl_arena;
+		char *mem = NULL;
+
+		if( arena )
+		{
+			mem = static_cast<char *>(arena->allocate(HEADER_SIZE + size));
+		}
+		else
+		{
+			mem = static_cast<char *>(std::malloc(HEADER_SIZE + size));
+
+			if( mem == NULL )
+				throw std::bad_alloc();
+		}
+
+		*reinterpret_cast<GF2nArena **>(mem) = arena;
+
+		return mem + HEADER_SIZE;
+	}
+
+	void freeElementMemory( void *ptr )
+	{
+		if( ptr == NULL )
+			return;
+
+		char *mem = static_cast<char *>(ptr) - HEADER_SIZE;
+
+		// arena memory is given back by reset
+		if( *reinterpret_cast<GF2nArena **>(mem) == NULL )
+			std::free(mem);
+	}
+}
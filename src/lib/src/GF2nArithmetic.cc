@@ -21,9 +21,43 @@
 
 #include "../include/GF2nArithmeticOpenSSL.h"
 #include "../include/GF2nArithmeticCuda.h"
+#include <algorithm>
 
 namespace libcumffa {
 
+	/**************************************************************************\
+
+						class GF2nArithmeticOp implementations
+
+	\**************************************************************************/
+
+	GF2nArithmeticOp::GF2nArithmeticOp()
+		: m_opcode(GF2N_OP_INVALID) {}
+
+	GF2nArithmeticOp::GF2nArithmeticOp( const int32 opcode )
+		: m_opcode(opcode) {}
+
+	int32 GF2nArithmeticOp::getOpcode() const
+	{
+		return m_opcode;
+	}
+
+	bool GF2nArithmeticOp::isValid() const
+	{
+		return m_opcode != GF2N_OP_INVALID;
+	}
+
+	const GF2nArithmeticElement GF2nArithmeticOp::operator()( GF2nArithmeticElement const& lhs, GF2nArithmeticElement const& rhs ) const
+	{
+		return lhs.runWithElement(*this, rhs);
+	}
+
+	const GF2nArithmeticElement GF2nArithmeticOp::operator()( GF2nArithmeticElement const& lhs, uint32 value ) const
+	{
+		return lhs.runWithValue(*this, value);
+	}
+
+
 	/**************************************************************************\
 
 						class GF2nArithmetic implementations
@@ -33,7 +67,9 @@ namespace libcumffa {
 	GF2nArithmetic::GF2nArithmetic( std::string mode, GF2nArithmeticInterface *element )
 	{
 		m_mode = mode;
+		m_flags = 0;
 		m_element.reset(element);
+		setExecutor(getDefaultExecutor());
 	}
 
 	GF2nArithmetic::~GF2nArithmetic() {}
@@ -46,23 +82,32 @@ namespace libcumffa {
 	void GF2nArithmetic::setDummyParameters( const uint32 field_size, const std::string irred_poly )
 	{
 		m_element->setDummyParameters(field_size, irred_poly);
+		validateModulus();
 	}
 
 	void GF2nArithmetic::setDummyParameters( const uint32 field_size, const unsigned char *irred_poly, const uint32 chunks_irred_poly )
 	{
 		m_element->setDummyParameters(field_size, irred_poly, chunks_irred_poly);
+		validateModulus();
 	}
 
 	void GF2nArithmetic::setDummyParameters( const uint32 field_size, const void *irred_poly, const uint32 chunks_irred_poly )
 	{
 		m_element->setDummyParameters(field_size, irred_poly, chunks_irred_poly);
+		validateModulus();
 	}
 
 	void GF2nArithmetic::setFlags( const unsigned char flags )
 	{
+		m_flags = flags;
 		m_element->setFlags(flags);
 	}
 
+	GF2nArithmeticOp GF2nArithmetic::resolveOp( const std::string &what )
+	{
+		return GF2nArithmeticOp(m_element->resolveOp(what));
+	}
+
 	GF2nArithmeticElement GF2nArithmetic::getElement( const std::string value )
 	{
 		GF2nArithmeticElement res = m_element->getElement(value);
@@ -81,11 +126,323 @@ namespace libcumffa {
 		return res;
 	}
 
+	GF2nArithmeticElement GF2nArithmetic::getElementFromLimbs( const ufixn *limbs )
+	{
+		GF2nArithmeticElement res = m_element->getElementFromLimbs(limbs);
+		return res;
+	}
+
+	GF2nArithmeticElement GF2nArithmetic::getElementFromHex( const std::string &hex )
+	{
+		std::vector<ufixn> limbs(getNumLimbs());
+		utils::hexToLimbs(hex, &limbs[0], getNumLimbs(), getFieldSize());
+		return m_element->getElementFromLimbs(&limbs[0]);
+	}
+
+	GF2nArithmeticElement GF2nArithmetic::getElementFromBytes( const unsigned char *bytes, const size_t num_bytes, const GF2nByteOrder order )
+	{
+		std::vector<ufixn> limbs(getNumLimbs());
+		utils::bytesToLimbs(bytes, num_bytes, order, &limbs[0], getNumLimbs(), getFieldSize());
+		return m_element->getElementFromLimbs(&limbs[0]);
+	}
+
+	uint32 GF2nArithmetic::getNumBytes()
+	{
+		return utils::calcNumberChunks<uint32>(getFieldSize(), 8);
+	}
+
+	void GF2nArithmetic::getElements( const unsigned char *bytes, const size_t count, const size_t stride, const GF2nByteOrder order, std::vector<GF2nArithmeticElement> &elements )
+	{
+		uint32 num_limbs = getNumLimbs();
+		std::vector<ufixn> limbs(count * num_limbs);
+
+		importBatch(bytes, count, stride, order, limbs.data(), num_limbs);
+
+		elements.clear();
+		elements.reserve(count);
+		for( size_t i=0; i<count; ++i )
+			elements.push_back(m_element->getElementFromLimbs(&limbs[i * num_limbs]));
+	}
+
+	void GF2nArithmetic::getValues( std::vector<GF2nArithmeticElement> &elements, unsigned char *bytes, const size_t stride, const GF2nByteOrder order )
+	{
+		uint32 num_limbs = getNumLimbs();
+		std::vector<ufixn> limbs(elements.size() * num_limbs);
+
+		for( size_t i=0; i<elements.size(); ++i )
+			elements[i].getLimbs(&limbs[i * num_limbs], num_limbs);
+
+		exportBatch(limbs.data(), elements.size(), num_limbs, bytes, stride, order);
+	}
+
+	void GF2nArithmetic::importBatch( const unsigned char *bytes, const size_t count, const size_t stride, const GF2nByteOrder order, ufixn *limbs, const uint32 limb_stride )
+	{
+		size_t num_bytes = getNumBytes();
+		size_t byte_stride = (stride == 0) ? num_bytes : stride;
+
+		utils::bytesToLimbArray(bytes, count, num_bytes, byte_stride, order, limbs, getNumLimbs(), getBatchStride(limb_stride), getFieldSize());
+	}
+
+	void GF2nArithmetic::exportBatch( const ufixn *limbs, const size_t count, const uint32 limb_stride, unsigned char *bytes, const size_t stride, const GF2nByteOrder order )
+	{
+		size_t num_bytes = getNumBytes();
+		size_t byte_stride = (stride == 0) ? num_bytes : stride;
+
+		utils::limbArrayToBytes(limbs, count, getNumLimbs(), getBatchStride(limb_stride), order, bytes, num_bytes, byte_stride);
+	}
+
 	std::string GF2nArithmetic::getMode()
 	{
 		return m_mode;
 	}
 
+	GF2nArithmeticInterface *GF2nArithmetic::getBackend()
+	{
+		return m_element.get();
+	}
+
+	uint32 GF2nArithmetic::getFieldSize()
+	{
+		return m_element->getFieldSize();
+	}
+
+	void GF2nArithmetic::getModulus( std::vector<ufixn> &limbs )
+	{
+		m_element->getModulus(limbs);
+	}
+
+	uint64 GF2nArithmetic::getModulusHash()
+	{
+		std::vector<ufixn> limbs;
+		m_element->getModulus(limbs);
+		return utils::hashLimbs(&limbs[0], getFieldSize() + 1);
+	}
+
+	bool GF2nArithmetic::isModulusIrreducible()
+	{
+		std::vector<ufixn> limbs;
+		m_element->getModulus(limbs);
+		return utils::isIrreducible(&limbs[0], static_cast<uint32>(limbs.size()));
+	}
+
+	void GF2nArithmetic::validateModulus()
+	{
+		if( (m_flags & GF2N_FLAG_VALIDATE_MODULUS) && !isModulusIrreducible() )
+			throw ReducibleModulusException();
+	}
+
+	uint32 GF2nArithmetic::getNumLimbs()
+	{
+		return m_element->getNumLimbs();
+	}
+
+	void GF2nArithmetic::addBatch( const ufixn *a, const ufixn *b, ufixn *out, const size_t count, const uint32 stride )
+	{
+		runBatch(GF2nArithmeticOp(GF2N_OP_ADD), a, b, 0, out, count, stride);
+	}
+
+	void GF2nArithmetic::mulBatch( const ufixn *a, const ufixn *b, ufixn *out, const size_t count, const uint32 stride )
+	{
+		runBatch(GF2nArithmeticOp(GF2N_OP_MUL), a, b, 0, out, count, stride);
+	}
+
+	void GF2nArithmetic::expBatch( const ufixn *a, const uint32 value, ufixn *out, const size_t count, const uint32 stride )
+	{
+		runBatch(GF2nArithmeticOp(GF2N_OP_EXP), a, NULL, value, out, count, stride);
+	}
+
+	void GF2nArithmetic::runBatch( GF2nArithmeticOp const& op, const ufixn *a, const ufixn *b, const uint32 value, ufixn *out, const size_t count, const uint32 stride )
+	{
+		uint32 batch_stride = getBatchStride(stride);
+
+		if( count == 0 )
+			return;
+
+		size_t tile_size = getBatchTileSize(count);
+
+		if( tile_size == count )
+		{
+			m_element->runBatch(op.getOpcode(), a, b, value, out, count, batch_stride, GF2N_NO_WORKER);
+			return;
+		}
+
+		int32 opcode = op.getOpcode();
+		GF2nArithmeticInterface *element = m_element.get();
+
+		m_executor->parallelFor(count, tile_size, 
+			[=]( const size_t begin, const size_t end, const uint32 worker ) {
+				element->runBatch(
+					opcode, 
+					a + begin * batch_stride, 
+					b ? b + begin * batch_stride : NULL, 
+					value, 
+					out + begin * batch_stride, 
+					end - begin, 
+					batch_stride, 
+					worker);
+			});
+	}
+
+	uint32 GF2nArithmetic::getBatchStride( const uint32 stride )
+	{
+		uint32 num_limbs = m_element->getNumLimbs();
+		uint32 batch_stride = (stride == 0) ? num_limbs : stride;
+
+		if( batch_stride < num_limbs )
+			throw InvalidBatchStrideException();
+
+		return batch_stride;
+	}
+
+	size_t GF2nArithmetic::getBatchTileSize( const size_t count )
+	{
+		size_t tile_size = m_element->getBatchTileSize();
+
+		if( !m_executor || tile_size == 0 || count <= tile_size )
+			return count;
+
+		// small batches get at least a few tiles per worker
+		size_t min_num_tiles = 4 * static_cast<size_t>(m_executor->getNumWorkers());
+		return std::max<size_t>(1, std::min(tile_size, count / min_num_tiles));
+	}
+
+	void GF2nArithmetic::setExecutor( std::shared_ptr<GF2nExecutorInterface> executor )
+	{
+		m_executor = executor;
+		if( m_executor )
+			m_element->setNumWorkers(m_executor->getNumWorkers());
+	}
+
+	std::shared_ptr<GF2nExecutorInterface> GF2nArithmetic::getExecutor()
+	{
+		return m_executor;
+	}
+
+	std::future<GF2nArithmeticElement> GF2nArithmetic::submit( GF2nArithmeticOp const& op, GF2nArithmeticElement const& lhs, GF2nArithmeticElement const& rhs )
+	{
+		return submitTask([=]() { return op(lhs, rhs); });
+	}
+
+	std::future<GF2nArithmeticElement> GF2nArithmetic::submit( GF2nArithmeticOp const& op, GF2nArithmeticElement const& lhs, const uint32 value )
+	{
+		return submitTask([=]() { return op(lhs, value); });
+	}
+
+	std::future<GF2nArithmeticElement> GF2nArithmetic::submitTask( const std::function<GF2nArithmeticElement ()> &fun )
+	{
+		std::shared_ptr<std::packaged_task<GF2nArithmeticElement ()> > task(
+			new std::packaged_task<GF2nArithmeticElement ()>(fun));
+		std::future<GF2nArithmeticElement> res = task->get_future();
+
+		if( m_executor && m_element->isAsync() )
+			m_executor->post([task]( const uint32 worker ) { (*task)(); });
+		else
+			(*task)();
+
+		return res;
+	}
+
+	std::future<void> GF2nArithmetic::submitBatch( GF2nArithmeticOp const& op, const ufixn *a, const ufixn *b, const uint32 value, ufixn *out, const size_t count, const uint32 stride )
+	{
+		uint32 batch_stride = getBatchStride(stride);
+
+		if( count == 0 || !m_executor || !m_element->isAsync() )
+		{
+			std::promise<void> promise;
+
+			try
+			{
+				runBatch(op, a, b, value, out, count, batch_stride);
+				promise.set_value();
+			}
+			catch( ... )
+			{
+				promise.set_exception(std::current_exception());
+			}
+
+			return promise.get_future();
+		}
+
+		// the tiles are posted one by one, the last finished tile
+		// fulfills the promise
+		struct BatchState
+		{
+			std::promise<void> promise;
+			std::mutex mutex;
+			size_t pending;
+			std::exception_ptr error;
+		};
+
+		size_t tile_size = getBatchTileSize(count);
+		size_t num_tiles = (count + tile_size - 1) / tile_size;
+
+		std::shared_ptr<BatchState> state(new BatchState());
+		state->pending = num_tiles;
+		std::future<void> res = state->promise.get_future();
+
+		int32 opcode = op.getOpcode();
+		std::shared_ptr<GF2nArithmeticInterface> element = m_element;
+
+		for( size_t t=0; t<num_tiles; ++t )
+		{
+			size_t begin = t * tile_size;
+			size_t end = std::min(count, begin + tile_size);
+
+			m_executor->post([=]( const uint32 worker ) {
+				std::exception_ptr error;
+
+				try
+				{
+					element->runBatch(
+						opcode, 
+						a + begin * batch_stride, 
+						b ? b + begin * batch_stride : NULL, 
+						value, 
+						out + begin * batch_stride, 
+						end - begin, 
+						batch_stride, 
+						worker);
+				}
+				catch( ... )
+				{
+					error = std::current_exception();
+				}
+
+				std::lock_guard<std::mutex> lock(state->mutex);
+
+				if( error && !state->error )
+					state->error = error;
+
+				if( --state->pending == 0 )
+				{
+					if( state->error )
+						state->promise.set_exception(state->error);
+					else
+						state->promise.set_value();
+				}
+			});
+		}
+
+		return res;
+	}
+
+
+	/**************************************************************************\
+
+					class GF2nArithmeticElementInterface implementations
+
+	\**************************************************************************/
+
+	void *GF2nArithmeticElementInterface::operator new( size_t size )
+	{
+		return allocElementMemory(size);
+	}
+
+	void GF2nArithmeticElementInterface::operator delete( void *ptr )
+	{
+		freeElementMemory(ptr);
+	}
+
 
 	/**************************************************************************\
 
@@ -127,6 +484,16 @@ namespace libcumffa {
 		return new GF2nArithmeticElementNull();
 	}
 
+	GF2nArithmeticElementInterface *GF2nArithmeticElementNull::runWithElement( const int32 op, GF2nArithmeticElementInterface *other )
+	{
+		return new GF2nArithmeticElementNull();
+	}
+
+	GF2nArithmeticElementInterface *GF2nArithmeticElementNull::runWithValue( const int32 op, uint32 value )
+	{
+		return new GF2nArithmeticElementNull();
+	}
+
 	std::string GF2nArithmeticElementNull::toString()
 	{
 		std::string ret;	
@@ -137,6 +504,21 @@ namespace libcumffa {
 	{
 	}
 
+	void GF2nArithmeticElementNull::getValue( uint8_t *value, const size_t num_bytes )
+	{
+		std::fill(value, value + num_bytes, 0);
+	}
+
+	void GF2nArithmeticElementNull::getLimbs( ufixn *limbs, const uint32 num_limbs )
+	{
+		std::fill(limbs, limbs + num_limbs, 0);
+	}
+
+	uint32 GF2nArithmeticElementNull::getFieldSize()
+	{
+		return 0;
+	}
+
 	std::string GF2nArithmeticElementNull::getMetrics()
 	{
 		std::string dummy;
@@ -163,17 +545,23 @@ namespace libcumffa {
 	
 	GF2nArithmeticElement::GF2nArithmeticElement()
 	{
-		m_element.reset(new GF2nArithmeticElementNull());
+		setElement(new GF2nArithmeticElementNull());
 	}
 
 	GF2nArithmeticElement::GF2nArithmeticElement( GF2nArithmeticElementInterface *element )
 	{
-		m_element.reset(element);
+		setElement(element);
 	}
 
 	void GF2nArithmeticElement::operator=( GF2nArithmeticElementInterface *element )
 	{
-		m_element.reset(element);
+		setElement(element);
+	}
+
+	void GF2nArithmeticElement::setElement( GF2nArithmeticElementInterface *element )
+	{
+		// the control block goes to the same arena as the element
+		m_element.reset(element, std::default_delete<GF2nArithmeticElementInterface>(), GF2nArenaAllocator<GF2nArithmeticElementInterface>());
 	}
 
 	GF2nArithmeticElement::~GF2nArithmeticElement() {}
@@ -220,6 +608,18 @@ namespace libcumffa {
 		return res;
 	}	
 
+	const GF2nArithmeticElement GF2nArithmeticElement::runWithElement( GF2nArithmeticOp const& op, GF2nArithmeticElement const& other ) const
+	{
+		GF2nArithmeticElement res = GF2nArithmeticElement(m_element->runWithElement(op.getOpcode(), other.m_element.get()));
+		return res;
+	}
+
+	const GF2nArithmeticElement GF2nArithmeticElement::runWithValue( GF2nArithmeticOp const& op, uint32 value ) const
+	{
+		GF2nArithmeticElement res = GF2nArithmeticElement(m_element->runWithValue(op.getOpcode(), value));
+		return res;
+	}
+
 	std::string GF2nArithmeticElement::toString()
 	{
 		return m_element->toString();
@@ -230,6 +630,44 @@ namespace libcumffa {
 		m_element->getValue(value);
 	}
 
+	void GF2nArithmeticElement::getValue( uint8_t *value, const size_t num_bytes )
+	{
+		m_element->getValue(value, num_bytes);
+	}
+
+	void GF2nArithmeticElement::getLimbs( ufixn *limbs, const uint32 num_limbs )
+	{
+		m_element->getLimbs(limbs, num_limbs);
+	}
+
+	uint32 GF2nArithmeticElement::getFieldSize()
+	{
+		return m_element->getFieldSize();
+	}
+
+	std::string GF2nArithmeticElement::toHex()
+	{
+		uint32 num_limbs = utils::calcNumberChunks<uint32>(getFieldSize(), sizeof(ufixn) * 8);
+		if( num_limbs == 0 )
+			return "0";
+
+		std::vector<ufixn> limbs(num_limbs);
+		m_element->getLimbs(&limbs[0], num_limbs);
+		return utils::limbsToHex(&limbs[0], num_limbs);
+	}
+
+	void GF2nArithmeticElement::getBytes( std::vector<uint8_t> &bytes, const GF2nByteOrder order )
+	{
+		uint32 num_limbs = utils::calcNumberChunks<uint32>(getFieldSize(), sizeof(ufixn) * 8);
+		bytes.assign(utils::calcNumberChunks<size_t>(getFieldSize(), 8), 0);
+		if( num_limbs == 0 )
+			return;
+
+		std::vector<ufixn> limbs(num_limbs);
+		m_element->getLimbs(&limbs[0], num_limbs);
+		utils::limbsToBytes(&limbs[0], num_limbs, order, &bytes[0], bytes.size());
+	}
+
 	std::string GF2nArithmeticElement::getMetrics()
 	{
 		return m_element->getMetrics();	
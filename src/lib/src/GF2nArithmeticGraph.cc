@@ -0,0 +1,529 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/GF2nArithmeticGraph.h"
+#include <algorithm>
+
+namespace libcumffa {
+
+	/* index of a missing operand */
+	const uint32 GF2N_NO_NODE = 0xFFFFFFFF;
+
+	/* a recorded operation, inputs have the opcode GF2N_OP_INVALID */
+	struct GF2nGraphNode
+	{
+		int32 opcode;
+		uint32 lhs;
+		uint32 rhs;
+		uint32 value;
+		GF2nArithmeticElement input;
+		GF2nArithmeticElement result;
+		uint32 num_handles;
+		bool computed;
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		the state of a graph that is shared with the element handles
+	*/
+	class GF2nArithmeticGraphData
+	{
+	public:
+		explicit GF2nArithmeticGraphData( GF2nArithmetic const& arithm );
+
+	public:
+		uint32 addNode( const int32 opcode, const uint32 lhs, const uint32 rhs, const uint32 value );
+		int32 resolveOp( const std::string &what );
+		void execute();
+
+	private:
+		void collectAddOperands( const uint32 node, const std::vector<bool> &fused, std::vector<uint32> &operands );
+		void runNode( const uint32 node, const uint32 worker );
+
+	public:
+		GF2nArithmetic m_arithm;
+		std::vector<GF2nGraphNode> m_nodes;
+
+	private:
+		/* used while executing */
+		uint32 m_num_limbs;
+		std::vector<std::vector<uint32> > m_operands;
+		std::vector<uint32> m_slot;
+		std::vector<ufixn> m_buffers;
+	};
+
+	///////////////////////////////////////////////////////////////////////
+	/*
+		element handle that records every operation in the graph
+	*/
+	class GF2nArithmeticElementGraph : public GF2nArithmeticElementInterface
+	{
+	public:
+		GF2nArithmeticElementGraph( std::shared_ptr<GF2nArithmeticGraphData> graph, const uint32 node );
+		virtual ~GF2nArithmeticElementGraph();
+
+	public:
+		virtual GF2nArithmeticElementInterface *add( GF2nArithmeticElementInterface *other );
+		virtual GF2nArithmeticElementInterface *sub( GF2nArithmeticElementInterface *other );
+		virtual GF2nArithmeticElementInterface *mul( GF2nArithmeticElementInterface *other );
+		virtual GF2nArithmeticElementInterface *div( GF2nArithmeticElementInterface *other );
+		virtual GF2nArithmeticElementInterface *runWithElement( const std::string &what, GF2nArithmeticElementInterface *other );
+		virtual GF2nArithmeticElementInterface *runWithValue( const std::string &what, uint32 value );
+		virtual GF2nArithmeticElementInterface *runWithElement( const int32 op, GF2nArithmeticElementInterface *other );
+		virtual GF2nArithmeticElementInterface *runWithValue( const int32 op, uint32 value );
+		virtual std::string toString();
+		virtual void getValue( std::vector<uint8_t> &value );
+		virtual void getValue( uint8_t *value, const size_t num_bytes );
+		virtual void getLimbs( ufixn *limbs, const uint32 num_limbs );
+		virtual uint32 getFieldSize();
+		virtual std::string getMetrics();
+		virtual std::string getMetrics( const std::string &metrics_name );
+		virtual void setProperty( const std::string &property_name, const std::string &property_value );
+
+	public:
+		GF2nArithmeticElement &getResult();
+
+	private:
+		uint32 getNode( GF2nArithmeticElementInterface *other );
+
+	private:
+		std::shared_ptr<GF2nArithmeticGraphData> m_graph;
+		uint32 m_node;
+	};
+
+
+	/**************************************************************************\
+
+					class GF2nArithmeticGraph implementations
+
+	\**************************************************************************/
+
+	GF2nArithmeticGraph::GF2nArithmeticGraph( GF2nArithmetic const& arithm )
+		: m_data(new GF2nArithmeticGraphData(arithm)) {}
+
+	GF2nArithmeticGraph::~GF2nArithmeticGraph() {}
+
+	GF2nArithmeticElement GF2nArithmeticGraph::input( GF2nArithmeticElement const& value )
+	{
+		uint32 node = m_data->addNode(GF2N_OP_INVALID, GF2N_NO_NODE, GF2N_NO_NODE, 0);
+		m_data->m_nodes[node].input = value;
+
+		return GF2nArithmeticElement(new GF2nArithmeticElementGraph(m_data, node));
+	}
+
+	void GF2nArithmeticGraph::execute()
+	{
+		m_data->execute();
+	}
+
+	GF2nArithmeticElement GF2nArithmeticGraph::getResult( GF2nArithmeticElement const& element )
+	{
+		GF2nArithmeticElementGraph *handle = dynamic_cast<GF2nArithmeticElementGraph *>(element.m_element.get());
+
+		if( handle == NULL )
+			throw InvalidGraphElementException();
+
+		return handle->getResult();
+	}
+
+
+	/**************************************************************************\
+
+					class GF2nArithmeticGraphData implementations
+
+	\**************************************************************************/
+
+	GF2nArithmeticGraphData::GF2nArithmeticGraphData( GF2nArithmetic const& arithm )
+		: m_arithm(arithm)
+		, m_num_limbs(0) {}
+
+	uint32 GF2nArithmeticGraphData::addNode( const int32 opcode, const uint32 lhs, const uint32 rhs, const uint32 value )
+	{
+		GF2nGraphNode node;
+		node.opcode = opcode;
+		node.lhs = lhs;
+		node.rhs = rhs;
+		node.value = value;
+		node.num_handles = 0;
+		node.computed = false;
+
+		m_nodes.push_back(node);
+
+		return static_cast<uint32>(m_nodes.size() - 1);
+	}
+
+	int32 GF2nArithmeticGraphData::resolveOp( const std::string &what )
+	{
+		return m_arithm.resolveOp(what).getOpcode();
+	}
+
+	void GF2nArithmeticGraphData::collectAddOperands( const uint32 node, const std::vector<bool> &fused, std::vector<uint32> &operands )
+	{
+		if( fused[node] )
+		{
+			collectAddOperands(m_nodes[node].lhs, fused, operands);
+			collectAddOperands(m_nodes[node].rhs, fused, operands);
+		}
+		else
+		{
+			operands.push_back(node);
+		}
+	}
+
+	void GF2nArithmeticGraphData::execute()
+	{
+		uint32 num_nodes = static_cast<uint32>(m_nodes.size());
+		m_num_limbs = m_arithm.getNumLimbs();
+
+		// the operands of a node are always recorded before the node, so
+		// the index order is a topological order of the graph
+		std::vector<bool> needed(num_nodes, false);
+		std::vector<uint32> num_uses(num_nodes, 0);
+
+		for( uint32 i=num_nodes; i-- > 0; )
+		{
+			GF2nGraphNode &node = m_nodes[i];
+
+			if( node.num_handles > 0 )
+				needed[i] = true;
+
+			if( !needed[i] )
+				continue;
+
+			if( node.lhs != GF2N_NO_NODE )
+			{
+				needed[node.lhs] = true;
+				++num_uses[node.lhs];
+			}
+			if( node.rhs != GF2N_NO_NODE )
+			{
+				needed[node.rhs] = true;
+				++num_uses[node.rhs];
+			}
+		}
+
+		// an addition whose only user is another addition is merged into it
+		std::vector<bool> fused(num_nodes, false);
+		std::vector<bool> is_add(num_nodes, false);
+
+		for( uint32 i=0; i<num_nodes; ++i )
+		{
+			int32 opcode = m_nodes[i].opcode;
+			is_add[i] = needed[i] && (opcode == GF2N_OP_ADD || opcode == GF2N_OP_SUB);
+		}
+
+		for( uint32 i=0; i<num_nodes; ++i )
+		{
+			if( !is_add[i] )
+				continue;
+
+			GF2nGraphNode &node = m_nodes[i];
+
+			if( is_add[node.lhs] && num_uses[node.lhs] == 1 && m_nodes[node.lhs].num_handles == 0 )
+				fused[node.lhs] = true;
+			if( is_add[node.rhs] && num_uses[node.rhs] == 1 && m_nodes[node.rhs].num_handles == 0 )
+				fused[node.rhs] = true;
+		}
+
+		// the level of a node is one more than the highest level of its
+		// operands, all nodes of a level are independent of each other
+		m_operands.assign(num_nodes, std::vector<uint32>());
+		std::vector<uint32> level(num_nodes, 0);
+		std::vector<uint32> last_use(num_nodes, 0);
+		std::vector<std::vector<uint32> > levels(1);
+
+		for( uint32 i=0; i<num_nodes; ++i )
+		{
+			if( !needed[i] || fused[i] )
+				continue;
+
+			GF2nGraphNode &node = m_nodes[i];
+
+			if( is_add[i] )
+			{
+				collectAddOperands(node.lhs, fused, m_operands[i]);
+				collectAddOperands(node.rhs, fused, m_operands[i]);
+			}
+			else
+			{
+				if( node.lhs != GF2N_NO_NODE )
+					m_operands[i].push_back(node.lhs);
+				if( node.rhs != GF2N_NO_NODE )
+					m_operands[i].push_back(node.rhs);
+			}
+
+			for( uint32 j=0; j<m_operands[i].size(); ++j )
+				level[i] = std::max(level[i], level[m_operands[i][j]] + 1);
+
+			for( uint32 j=0; j<m_operands[i].size(); ++j )
+				last_use[m_operands[i][j]] = std::max(last_use[m_operands[i][j]], level[i]);
+
+			if( level[i] >= levels.size() )
+				levels.resize(level[i] + 1);
+			levels[level[i]].push_back(i);
+		}
+
+		// every live value owns a slot of m_buffers, the slot is free
+		// again after the level of its last use
+		m_slot.assign(num_nodes, GF2N_NO_NODE);
+		std::vector<uint32> free_slots;
+		uint32 num_slots = 0;
+
+		for( uint32 l=0; l<levels.size(); ++l )
+		{
+			std::vector<uint32> &curr_level = levels[l];
+
+			for( uint32 j=0; j<curr_level.size(); ++j )
+			{
+				if( free_slots.empty() )
+				{
+					m_slot[curr_level[j]] = num_slots++;
+				}
+				else
+				{
+					m_slot[curr_level[j]] = free_slots.back();
+					free_slots.pop_back();
+				}
+			}
+
+			if( m_buffers.size() < num_slots * m_num_limbs )
+				m_buffers.resize(num_slots * m_num_limbs);
+
+			std::shared_ptr<GF2nExecutorInterface> executor = m_arithm.getExecutor();
+
+			if( executor && curr_level.size() > 1 )
+			{
+				executor->parallelFor(curr_level.size(), 1, 
+					[this, &curr_level]( const size_t begin, const size_t end, const uint32 worker ) {
+						for( size_t j=begin; j<end; ++j )
+							runNode(curr_level[j], worker);
+					});
+			}
+			else
+			{
+				for( uint32 j=0; j<curr_level.size(); ++j )
+					runNode(curr_level[j], GF2N_NO_WORKER);
+			}
+
+			for( uint32 j=0; j<curr_level.size(); ++j )
+			{
+				std::vector<uint32> &operands = m_operands[curr_level[j]];
+
+				for( uint32 k=0; k<operands.size(); ++k )
+				{
+					uint32 operand = operands[k];
+
+					if( last_use[operand] == l && m_nodes[operand].num_handles == 0 && m_slot[operand] != GF2N_NO_NODE )
+					{
+						free_slots.push_back(m_slot[operand]);
+						m_slot[operand] = GF2N_NO_NODE;
+					}
+				}
+			}
+		}
+
+		for( uint32 i=0; i<num_nodes; ++i )
+		{
+			GF2nGraphNode &node = m_nodes[i];
+
+			if( node.num_handles == 0 )
+				continue;
+
+			if( node.opcode == GF2N_OP_INVALID )
+				node.result = node.input;
+			else
+				node.result = m_arithm.getElementFromLimbs(&m_buffers[m_slot[i] * m_num_limbs]);
+
+			node.computed = true;
+		}
+
+		m_operands.clear();
+	}
+
+	void GF2nArithmeticGraphData::runNode( const uint32 node, const uint32 worker )
+	{
+		GF2nGraphNode &curr_node = m_nodes[node];
+		std::vector<uint32> &operands = m_operands[node];
+		ufixn *out = &m_buffers[m_slot[node] * m_num_limbs];
+
+		if( curr_node.opcode == GF2N_OP_INVALID )
+		{
+			curr_node.input.getLimbs(out, m_num_limbs);
+		}
+		else if( curr_node.opcode == GF2N_OP_ADD || curr_node.opcode == GF2N_OP_SUB )
+		{
+			// the sum of all operands of the fused chain
+			std::fill(out, out + m_num_limbs, 0);
+
+			for( uint32 k=0; k<operands.size(); ++k )
+			{
+				const ufixn *operand = &m_buffers[m_slot[operands[k]] * m_num_limbs];
+
+				for( uint32 j=0; j<m_num_limbs; ++j )
+					out[j] ^= operand[j];
+			}
+		}
+		else
+		{
+			const ufixn *lhs = &m_buffers[m_slot[curr_node.lhs] * m_num_limbs];
+			const ufixn *rhs = NULL;
+
+			if( curr_node.rhs != GF2N_NO_NODE )
+				rhs = &m_buffers[m_slot[curr_node.rhs] * m_num_limbs];
+
+			m_arithm.m_element->runBatch(curr_node.opcode, lhs, rhs, curr_node.value, out, 1, m_num_limbs, worker);
+		}
+	}
+
+
+	/**************************************************************************\
+
+					class GF2nArithmeticElementGraph implementations
+
+	\**************************************************************************/
+
+	GF2nArithmeticElementGraph::GF2nArithmeticElementGraph( std::shared_ptr<GF2nArithmeticGraphData> graph, const uint32 node )
+		: m_graph(graph)
+		, m_node(node)
+	{
+		++m_graph->m_nodes[m_node].num_handles;
+	}
+
+	GF2nArithmeticElementGraph::~GF2nArithmeticElementGraph()
+	{
+		GF2nGraphNode &node = m_graph->m_nodes[m_node];
+
+		// nobody can ask for the value anymore
+		if( --node.num_handles == 0 )
+		{
+			node.result = GF2nArithmeticElement();
+			node.computed = false;
+		}
+	}
+
+	GF2nArithmeticElementInterface *GF2nArithmeticElementGraph::add( GF2nArithmeticElementInterface *other )
+	{
+		return runWithElement(GF2N_OP_ADD, other);
+	}
+
+	GF2nArithmeticElementInterface *GF2nArithmeticElementGraph::sub( GF2nArithmeticElementInterface *other )
+	{
+		return runWithElement(GF2N_OP_SUB, other);
+	}
+
+	GF2nArithmeticElementInterface *GF2nArithmeticElementGraph::mul( GF2nArithmeticElementInterface *other )
+	{
+		return runWithElement(GF2N_OP_MUL, other);
+	}
+
+	GF2nArithmeticElementInterface *GF2nArithmeticElementGraph::div( GF2nArithmeticElementInterface *other )
+	{
+		return runWithElement(GF2N_OP_DIV, other);
+	}
+
+	GF2nArithmeticElementInterface *GF2nArithmeticElementGraph::runWithElement( const std::string &what, GF2nArithmeticElementInterface *other )
+	{
+		return runWithElement(m_graph->resolveOp(what), other);
+	}
+
+	GF2nArithmeticElementInterface *GF2nArithmeticElementGraph::runWithValue( const std::string &what, uint32 value )
+	{
+		return runWithValue(m_graph->resolveOp(what), value);
+	}
+
+	GF2nArithmeticElementInterface *GF2nArithmeticElementGraph::runWithElement( const int32 op, GF2nArithmeticElementInterface *other )
+	{
+		uint32 other_node = getNode(other);
+
+		// the batch interface has no division, a / b is recorded as a * b^-1
+		if( op == GF2N_OP_DIV )
+		{
+			uint32 inverse_node = m_graph->addNode(GF2N_OP_INVERSE, other_node, GF2N_NO_NODE, 0);
+			return new GF2nArithmeticElementGraph(m_graph, m_graph->addNode(GF2N_OP_MUL, m_node, inverse_node, 0));
+		}
+
+		return new GF2nArithmeticElementGraph(m_graph, m_graph->addNode(op, m_node, other_node, 0));
+	}
+
+	GF2nArithmeticElementInterface *GF2nArithmeticElementGraph::runWithValue( const int32 op, uint32 value )
+	{
+		return new GF2nArithmeticElementGraph(m_graph, m_graph->addNode(op, m_node, GF2N_NO_NODE, value));
+	}
+
+	std::string GF2nArithmeticElementGraph::toString()
+	{
+		return getResult().toString();
+	}
+
+	void GF2nArithmeticElementGraph::getValue( std::vector<uint8_t> &value )
+	{
+		getResult().getValue(value);
+	}
+
+	void GF2nArithmeticElementGraph::getValue( uint8_t *value, const size_t num_bytes )
+	{
+		getResult().getValue(value, num_bytes);
+	}
+
+	void GF2nArithmeticElementGraph::getLimbs( ufixn *limbs, const uint32 num_limbs )
+	{
+		getResult().getLimbs(limbs, num_limbs);
+	}
+
+	uint32 GF2nArithmeticElementGraph::getFieldSize()
+	{
+		return getResult().getFieldSize();
+	}
+
+	std::string GF2nArithmeticElementGraph::getMetrics()
+	{
+		return getResult().getMetrics();
+	}
+
+	std::string GF2nArithmeticElementGraph::getMetrics( const std::string &metrics_name )
+	{
+		return getResult().getMetrics(metrics_name);
+	}
+
+	void GF2nArithmeticElementGraph::setProperty( const std::string &property_name, const std::string &property_value )
+	{
+	}
+
+	GF2nArithmeticElement &GF2nArithmeticElementGraph::getResult()
+	{
+		GF2nGraphNode &node = m_graph->m_nodes[m_node];
+
+		if( !node.computed )
+			throw GraphNotExecutedException();
+
+		return node.result;
+	}
+
+	uint32 GF2nArithmeticElementGraph::getNode( GF2nArithmeticElementInterface *other )
+	{
+		GF2nArithmeticElementGraph *other_graph = dynamic_cast<GF2nArithmeticElementGraph *>(other);
+
+		if( other_graph == NULL || other_graph->m_graph != m_graph )
+			throw InvalidGraphElementException();
+
+		return other_graph->m_node;
+	}
+}
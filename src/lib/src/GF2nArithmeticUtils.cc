@@ -27,9 +27,21 @@
 #include <cstring>
 #include <sys/time.h>
 
-void libcumffa::utils::convertStringToArray( std::string str, int size_chunk_bits, int num_chunks, std::vector<std::string> &arr )
+// the value of a non negative decimal string
+static mpz_class parseDecimal( const std::string &str )
 {
-    mpz_class bn_value(str.c_str(), 10);
+    mpz_class value;
+    if( value.set_str(str, 10) != 0 || value < 0 )
+        throw libcumffa::InvalidEncodingException("the string is no decimal number");
+
+    return value;
+}
+
+// the chunk conversions below fall back to these for chunks of more
+// than 64 bits, they need one mpz division or multiplication per chunk
+static void convertStringToArrayByDivision( std::string str, int size_chunk_bits, int num_chunks, std::vector<std::string> &arr )
+{
+    mpz_class bn_value = parseDecimal(str);
     mpz_class bn_base_2 = 2;
     mpz_class bn_num_chunks = num_chunks;
 
@@ -58,6 +70,90 @@ void libcumffa::utils::convertStringToArray( std::string str, int size_chunk_bit
     std::reverse(arr.begin(), arr.end());
 }
 
+static void convertArrayToStringByMultiplication( std::vector<std::string> &arr, int size_chunk_bits, int num_chunks, std::string &str )
+{
+    mpz_class bn_value;
+    mpz_class bn_base_2 = 2;
+
+    mpz_class bn_num_field_elements;
+    mpz_pow_ui(bn_num_field_elements.get_mpz_t(), bn_base_2.get_mpz_t(), size_chunk_bits);
+
+    // no chunks are the value 0
+    for( unsigned int i = 0; i < arr.size(); ++i )
+    {
+        bn_value *= bn_num_field_elements;
+
+        mpz_class bn_curr_chunk(arr[i], 10);
+
+        bn_value += bn_curr_chunk;
+    }
+    
+    str = bn_value.get_str();
+}
+
+// reads the num_bits bits at bit offset pos of least significant first words
+static uint64 extractBits( const std::vector<uint64> &words, size_t pos, int num_bits )
+{
+    size_t word = pos / 64;
+    size_t shift = pos % 64;
+
+    if( word >= words.size() )
+        return 0;
+
+    uint64 value = words[word] >> shift;
+    if( shift + num_bits > 64 && word + 1 < words.size() )
+        value |= words[word + 1] << (64 - shift);
+
+    return num_bits < 64 ? value & ((1ULL << num_bits) - 1) : value;
+}
+
+void libcumffa::utils::decimalToLimbs( const std::string &str, std::vector<ufixn> &limbs )
+{
+    mpz_class value = parseDecimal(str);
+
+    // GMP converts large strings by divide and conquer over powers of ten
+    limbs.assign(calcNumberChunks<size_t>(mpz_sizeinbase(value.get_mpz_t(), 2), sizeof(ufixn) * 8), 0);
+    mpz_export(&limbs[0], NULL, -1, sizeof(ufixn), 0, 0, value.get_mpz_t());
+}
+
+std::string libcumffa::utils::limbsToDecimal( const ufixn *limbs, const uint32 num_limbs )
+{
+    mpz_class value;
+    mpz_import(value.get_mpz_t(), num_limbs, -1, sizeof(ufixn), 0, 0, limbs);
+
+    return value.get_str(10);
+}
+
+void libcumffa::utils::convertStringToArray( std::string str, int size_chunk_bits, int num_chunks, std::vector<std::string> &arr )
+{
+    if( size_chunk_bits <= 0 || size_chunk_bits > 64 )
+    {
+        convertStringToArrayByDivision(str, size_chunk_bits, num_chunks, arr);
+        return;
+    }
+
+    // one subquadratic conversion to binary, then the chunks are cut
+    // out of the words in linear time
+    mpz_class bn_value = parseDecimal(str);
+
+    size_t num_bits = (bn_value == 0) ? 0 : mpz_sizeinbase(bn_value.get_mpz_t(), 2);
+    size_t num_value_chunks = calcNumberChunks<size_t>(num_bits, size_chunk_bits);
+
+    std::vector<uint64> words(calcNumberChunks<size_t>(num_bits, 64) + 1, 0);
+    mpz_export(&words[0], NULL, -1, sizeof(uint64), 0, 0, bn_value.get_mpz_t());
+
+    // the missing chunks are padded at the most significant end
+    for( size_t i = num_value_chunks; i < static_cast<size_t>(num_chunks); ++i )
+    {
+        arr.push_back(std::string(size_chunk_bits, '0'));
+    }
+
+    for( size_t i = num_value_chunks; i-- > 0; )
+    {
+        arr.push_back(std::to_string(extractBits(words, i * size_chunk_bits, size_chunk_bits)));
+    }
+}
+
 void libcumffa::utils::convertStringToArray2( std::string str, int size_chunk_bits, int num_chunks, std::vector<std::string> &arr )
 {
     mpz_class bn_value(str.c_str(), 10);
@@ -91,22 +187,50 @@ void libcumffa::utils::convertStringToArray2( std::string str, int size_chunk_bi
 
 void libcumffa::utils::convertArrayToString( std::vector<std::string> &arr, int size_chunk_bits, int num_chunks, std::string &str )
 {
+    if( size_chunk_bits <= 0 || size_chunk_bits > 64 )
+    {
+        convertArrayToStringByMultiplication(arr, size_chunk_bits, num_chunks, str);
+        return;
+    }
+
+    // the chunks are put together in binary, only the whole value is
+    // converted to decimal
+    size_t num_value_chunks = arr.size();
+    std::vector<uint64> words(calcNumberChunks<size_t>(num_value_chunks * size_chunk_bits, 64) + 1, 0);
+
+    for( size_t i = 0; i < num_value_chunks; ++i )
+    {
+        // chunk i counts from the least significant end
+        uint64 chunk = std::stoull(arr[num_value_chunks - 1 - i], NULL, 10);
+        size_t pos = i * size_chunk_bits;
+
+        words[pos / 64] |= chunk << (pos % 64);
+        if( pos % 64 + size_chunk_bits > 64 )
+            words[pos / 64 + 1] |= chunk >> (64 - pos % 64);
+    }
+
     mpz_class bn_value;
-    mpz_class bn_base_2 = 2;
+    mpz_import(bn_value.get_mpz_t(), words.size(), -1, sizeof(uint64), 0, 0, &words[0]);
 
-    mpz_class bn_num_field_elements;
-    mpz_pow_ui(bn_num_field_elements.get_mpz_t(), bn_base_2.get_mpz_t(), size_chunk_bits);
+    str = bn_value.get_str();
+}
 
-    bn_value.set_str(arr.front(), 10);
+uint64 libcumffa::utils::hashLimbs( const ufixn *limbs, const uint32 num_bits )
+{
+    uint64 hash = 14695981039346656037ULL;
+    uint32 num_bytes = calcNumberChunks<uint32>(num_bits, 8);
 
-    for( unsigned int i = 1; i < arr.size(); ++i )
+    for( uint32 i = 0; i < num_bytes; ++i )
     {
-        bn_value *= bn_num_field_elements;
+        uint8 byte = static_cast<uint8>(limbs[i / sizeof(ufixn)] >> (8 * (i % sizeof(ufixn))));
 
-        mpz_class bn_curr_chunk(arr[i], 10);
+        // mask the bits above num_bits in the last byte
+        if( i == num_bytes - 1 && num_bits % 8 != 0 )
+            byte &= static_cast<uint8>((1u << (num_bits % 8)) - 1);
 
-        bn_value += bn_curr_chunk;
+        hash ^= byte;
+        hash *= 1099511628211ULL;
     }
-    
-    str = bn_value.get_str();
-}
\ No newline at end of file
+
+    return hash;
+}
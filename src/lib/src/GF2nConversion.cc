@@ -0,0 +1,289 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../include/GF2nConversion.h"
+#include <vector>
+#include <cstring>
+#include <algorithm>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace libcumffa {
+	namespace utils {
+
+		/* value of a hex digit, -1 for any other character */
+		static int8 hexValue( const char c )
+		{
+			if( c >= '0' && c <= '9' )
+				return static_cast<int8>(c - '0');
+			if( c >= 'a' && c <= 'f' )
+				return static_cast<int8>(c - 'a' + 10);
+			if( c >= 'A' && c <= 'F' )
+				return static_cast<int8>(c - 'A' + 10);
+			return -1;
+		}
+
+		static inline uint8 getByte( const ufixn *limbs, const size_t i )
+		{
+			return static_cast<uint8>(limbs[i / sizeof(ufixn)] >> (8 * (i % sizeof(ufixn))));
+		}
+
+		static inline void setByte( ufixn *limbs, const size_t i, const uint8 byte )
+		{
+			limbs[i / sizeof(ufixn)] |= static_cast<ufixn>(byte) << (8 * (i % sizeof(ufixn)));
+		}
+
+		bool limbsFit( const ufixn *limbs, const uint32 num_limbs, const uint32 num_bits )
+		{
+			const uint32 limb_bits = sizeof(ufixn) * 8;
+
+			for( uint32 i=num_bits / limb_bits; i<num_limbs; ++i )
+			{
+				ufixn mask = (i == num_bits / limb_bits) ? ~((static_cast<ufixn>(1) << (num_bits % limb_bits)) - 1) : ~static_cast<ufixn>(0);
+
+				if( limbs[i] & mask )
+					return false;
+			}
+
+			return true;
+		}
+
+		/* throws if a bit at or above num_bits is set */
+		static void checkFits( const ufixn *limbs, const uint32 num_limbs, const uint32 num_bits )
+		{
+			if( !limbsFit(limbs, num_limbs, num_bits) )
+				throw InvalidEncodingException("the value does not fit into the field");
+		}
+
+		/* writes two hex digits per byte of bytes */
+		static void encodeHex( const uint8 *bytes, const size_t num_bytes, char *out )
+		{
+			static const char digits[] = "0123456789abcdef";
+			size_t i = 0;
+
+#ifdef __SSE2__
+			// splits 16 bytes into 32 nibbles and maps them to digits
+			// with a compare instead of a table lookup
+			const __m128i low_mask = _mm_set1_epi8(0x0f);
+			const __m128i nine = _mm_set1_epi8(9);
+			const __m128i zero_char = _mm_set1_epi8('0');
+			const __m128i letter_offset = _mm_set1_epi8('a' - '0' - 10);
+
+			for( ; i + 16 <= num_bytes; i += 16 )
+			{
+				__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + i));
+				__m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), low_mask);
+				__m128i lo = _mm_and_si128(x, low_mask);
+				__m128i first = _mm_unpacklo_epi8(hi, lo);
+				__m128i second = _mm_unpackhi_epi8(hi, lo);
+
+				first = _mm_add_epi8(_mm_add_epi8(first, zero_char), _mm_and_si128(_mm_cmpgt_epi8(first, nine), letter_offset));
+				second = _mm_add_epi8(_mm_add_epi8(second, zero_char), _mm_and_si128(_mm_cmpgt_epi8(second, nine), letter_offset));
+
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * i), first);
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(out + 2 * i + 16), second);
+			}
+#endif
+
+			for( ; i<num_bytes; ++i )
+			{
+				out[2 * i] = digits[bytes[i] >> 4];
+				out[2 * i + 1] = digits[bytes[i] & 0x0f];
+			}
+		}
+
+		/* dst[i] = src[num_bytes - 1 - i], the buffers must not overlap */
+		static void reverseBytes( const uint8 *src, uint8 *dst, const size_t num_bytes )
+		{
+			size_t i = 0;
+
+#ifdef __SSE2__
+			// reverses 16 bytes at once: the dwords, the words in the
+			// dwords and finally the bytes in the words
+			for( ; i + 16 <= num_bytes; i += 16 )
+			{
+				__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + num_bytes - i - 16));
+				x = _mm_shuffle_epi32(x, _MM_SHUFFLE(0, 1, 2, 3));
+				x = _mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+				x = _mm_shufflehi_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+				x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), x);
+			}
+#endif
+
+			for( ; i<num_bytes; ++i )
+				dst[i] = src[num_bytes - 1 - i];
+		}
+
+		void hexToLimbs( const std::string &hex, ufixn *limbs, const uint32 num_limbs, const uint32 num_bits )
+		{
+			size_t begin = 0;
+			if( hex.size() >= 2 && hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X') )
+				begin = 2;
+
+			if( begin == hex.size() )
+				throw InvalidEncodingException("the hex string has no digits");
+
+			// leading zeros do not count against the size of the field
+			size_t first = begin;
+			while( first + 1 < hex.size() && hex[first] == '0' )
+				++first;
+
+			size_t num_digits = hex.size() - first;
+			if( num_digits > static_cast<size_t>(num_limbs) * sizeof(ufixn) * 2 )
+				throw InvalidEncodingException("the value does not fit into the field");
+
+			std::fill(limbs, limbs + num_limbs, 0);
+
+			// the last digit is the least significant nibble
+			for( size_t i=0; i<num_digits; ++i )
+			{
+				int8 value = hexValue(hex[hex.size() - 1 - i]);
+				if( value < 0 )
+					throw InvalidEncodingException("the string has a character that is no hex digit");
+
+				limbs[i / (sizeof(ufixn) * 2)] |= static_cast<ufixn>(value) << (4 * (i % (sizeof(ufixn) * 2)));
+			}
+
+			checkFits(limbs, num_limbs, num_bits);
+		}
+
+		std::string limbsToHex( const ufixn *limbs, const uint32 num_limbs )
+		{
+			size_t num_bytes = static_cast<size_t>(num_limbs) * sizeof(ufixn);
+
+			// the most significant byte first
+			std::vector<uint8> bytes(num_bytes);
+			for( size_t i=0; i<num_bytes; ++i )
+				bytes[i] = getByte(limbs, num_bytes - 1 - i);
+
+			std::string hex(2 * num_bytes, '0');
+			if( num_bytes > 0 )
+				encodeHex(&bytes[0], num_bytes, &hex[0]);
+
+			size_t first = hex.find_first_not_of('0');
+			if( first == std::string::npos )
+				return "0";
+
+			return hex.substr(first);
+		}
+
+		void bytesToLimbs( const unsigned char *bytes, const size_t num_bytes, const GF2nByteOrder order, ufixn *limbs, const uint32 num_limbs, const uint32 num_bits )
+		{
+			size_t limb_bytes = static_cast<size_t>(num_limbs) * sizeof(ufixn);
+
+			std::fill(limbs, limbs + num_limbs, 0);
+
+			for( size_t i=0; i<num_bytes; ++i )
+			{
+				// i counts from the least significant byte
+				uint8 byte = (order == GF2N_LITTLE_ENDIAN) ? bytes[i] : bytes[num_bytes - 1 - i];
+
+				if( i < limb_bytes )
+					setByte(limbs, i, byte);
+				else if( byte != 0 )
+					throw InvalidEncodingException("the value does not fit into the field");
+			}
+
+			checkFits(limbs, num_limbs, num_bits);
+		}
+
+		void limbsToBytes( const ufixn *limbs, const uint32 num_limbs, const GF2nByteOrder order, unsigned char *bytes, const size_t num_bytes )
+		{
+			size_t limb_bytes = static_cast<size_t>(num_limbs) * sizeof(ufixn);
+
+			for( size_t i=num_bytes; i<limb_bytes; ++i )
+			{
+				if( getByte(limbs, i) != 0 )
+					throw InvalidEncodingException("the value does not fit into the byte buffer");
+			}
+
+			for( size_t i=0; i<num_bytes; ++i )
+			{
+				uint8 byte = (i < limb_bytes) ? getByte(limbs, i) : 0;
+
+				if( order == GF2N_LITTLE_ENDIAN )
+					bytes[i] = byte;
+				else
+					bytes[num_bytes - 1 - i] = byte;
+			}
+		}
+	
+		void bytesToLimbArray( const unsigned char *bytes, const size_t count, const size_t num_bytes, const size_t byte_stride, const GF2nByteOrder order, ufixn *limbs, const uint32 num_limbs, const uint32 limb_stride, const uint32 num_bits )
+		{
+			size_t limb_bytes = static_cast<size_t>(num_limbs) * sizeof(ufixn);
+
+			if( num_bytes > limb_bytes )
+				throw InvalidEncodingException("the value does not fit into the field");
+
+			// the limbs of a little endian host are a little endian byte
+			// string, so the elements are copied or reversed in one go
+			for( size_t i=0; i<count; ++i )
+			{
+				const uint8 *src = bytes + i * byte_stride;
+				ufixn *dst = limbs + i * limb_stride;
+				uint8 *dst_bytes = reinterpret_cast<uint8 *>(dst);
+
+				if( order == GF2N_LITTLE_ENDIAN )
+					memcpy(dst_bytes, src, num_bytes);
+				else
+					reverseBytes(src, dst_bytes, num_bytes);
+
+				memset(dst_bytes + num_bytes, 0, static_cast<size_t>(limb_stride) * sizeof(ufixn) - num_bytes);
+				checkFits(dst, num_limbs, num_bits);
+			}
+		}
+
+		void limbArrayToBytes( const ufixn *limbs, const size_t count, const uint32 num_limbs, const uint32 limb_stride, const GF2nByteOrder order, unsigned char *bytes, const size_t num_bytes, const size_t byte_stride )
+		{
+			size_t limb_bytes = static_cast<size_t>(num_limbs) * sizeof(ufixn);
+			size_t num_copied = std::min(num_bytes, limb_bytes);
+
+			for( size_t i=0; i<count; ++i )
+			{
+				const ufixn *src = limbs + i * limb_stride;
+				const uint8 *src_bytes = reinterpret_cast<const uint8 *>(src);
+				uint8 *dst = bytes + i * byte_stride;
+
+				for( size_t j=num_copied; j<limb_bytes; ++j )
+				{
+					if( src_bytes[j] != 0 )
+						throw InvalidEncodingException("the value does not fit into the byte buffer");
+				}
+
+				// a wider byte string is padded at its most significant end
+				if( order == GF2N_LITTLE_ENDIAN )
+				{
+					memcpy(dst, src_bytes, num_copied);
+					memset(dst + num_copied, 0, num_bytes - num_copied);
+				}
+				else
+				{
+					memset(dst, 0, num_bytes - num_copied);
+					reverseBytes(src_bytes, dst + num_bytes - num_copied, num_copied);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,176 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#include "../include/GF2nElementView.h"
+#include <algorithm>
+
+namespace libcumffa {
+
+	/**************************************************************************\
+
+						class GF2nConstElementView implementations
+
+	\**************************************************************************/
+
+	GF2nConstElementView::GF2nConstElementView( GF2nArithmetic &arithmetic, const ufixn *limbs )
+		: m_arithmetic(arithmetic.getBackend())
+		, m_limbs(limbs)
+		, m_num_limbs(arithmetic.getNumLimbs())
+		, m_field_size(arithmetic.getFieldSize())
+	{
+	}
+
+	const ufixn *GF2nConstElementView::getLimbs() const
+	{
+		return m_limbs;
+	}
+
+	uint32 GF2nConstElementView::getNumLimbs() const
+	{
+		return m_num_limbs;
+	}
+
+	uint32 GF2nConstElementView::getFieldSize() const
+	{
+		return m_field_size;
+	}
+
+	GF2nArithmeticInterface *GF2nConstElementView::getArithmetic() const
+	{
+		return m_arithmetic;
+	}
+
+	GF2nArithmeticElement GF2nConstElementView::getElement() const
+	{
+		return m_arithmetic->getElementFromLimbs(m_limbs);
+	}
+
+	std::string GF2nConstElementView::toHex() const
+	{
+		if( m_num_limbs == 0 )
+			return "0";
+
+		return utils::limbsToHex(m_limbs, m_num_limbs);
+	}
+
+	void GF2nConstElementView::getValue( uint8_t *value, const size_t num_bytes, const GF2nByteOrder order ) const
+	{
+		utils::limbsToBytes(m_limbs, m_num_limbs, order, value, num_bytes);
+	}
+
+	/**************************************************************************\
+
+						class GF2nElementView implementations
+
+	\**************************************************************************/
+
+	GF2nElementView::GF2nElementView( GF2nArithmetic &arithmetic, ufixn *limbs )
+		: GF2nConstElementView(arithmetic, limbs)
+	{
+	}
+
+	ufixn *GF2nElementView::getLimbs() const
+	{
+		return const_cast<ufixn *>(m_limbs);
+	}
+
+	void GF2nElementView::setZero()
+	{
+		std::fill(getLimbs(), getLimbs() + m_num_limbs, 0);
+	}
+
+	void GF2nElementView::setElement( GF2nArithmeticElement &element )
+	{
+		element.getLimbs(getLimbs(), m_num_limbs);
+	}
+
+	void GF2nElementView::setValue( GF2nConstElementView const& other )
+	{
+		checkOperand(other);
+
+		if( other.getLimbs() != m_limbs )
+			std::copy(other.getLimbs(), other.getLimbs() + m_num_limbs, getLimbs());
+	}
+
+	void GF2nElementView::setValue( const uint8_t *value, const size_t num_bytes, const GF2nByteOrder order )
+	{
+		utils::bytesToLimbs(value, num_bytes, order, getLimbs(), m_num_limbs, m_field_size);
+	}
+
+	void GF2nElementView::add( GF2nConstElementView const& lhs, GF2nConstElementView const& rhs )
+	{
+		checkOperand(lhs);
+		checkOperand(rhs);
+
+		// an addition is a xor of the limbs, no backend call needed
+		const ufixn *a = lhs.getLimbs();
+		const ufixn *b = rhs.getLimbs();
+		ufixn *out = getLimbs();
+
+		for( uint32 i=0; i<m_num_limbs; ++i )
+			out[i] = a[i] ^ b[i];
+	}
+
+	void GF2nElementView::sub( GF2nConstElementView const& lhs, GF2nConstElementView const& rhs )
+	{
+		add(lhs, rhs);
+	}
+
+	void GF2nElementView::mul( GF2nConstElementView const& lhs, GF2nConstElementView const& rhs )
+	{
+		run(GF2nArithmeticOp(GF2N_OP_MUL), lhs, rhs);
+	}
+
+	void GF2nElementView::exp( GF2nConstElementView const& lhs, const uint32 value )
+	{
+		run(GF2nArithmeticOp(GF2N_OP_EXP), lhs, value);
+	}
+
+	void GF2nElementView::inverse( GF2nConstElementView const& lhs )
+	{
+		run(GF2nArithmeticOp(GF2N_OP_INVERSE), lhs, 0);
+	}
+
+	void GF2nElementView::run( GF2nArithmeticOp const& op, GF2nConstElementView const& lhs, GF2nConstElementView const& rhs )
+	{
+		checkOperand(lhs);
+		checkOperand(rhs);
+
+		// a batch of one element runs on the calling thread, the backends
+		// read both operands before they write the result
+		m_arithmetic->runBatch(op.getOpcode(), lhs.getLimbs(), rhs.getLimbs(), 0, getLimbs(), 1, m_num_limbs, GF2N_NO_WORKER);
+	}
+
+	void GF2nElementView::run( GF2nArithmeticOp const& op, GF2nConstElementView const& lhs, const uint32 value )
+	{
+		checkOperand(lhs);
+
+		m_arithmetic->runBatch(op.getOpcode(), lhs.getLimbs(), NULL, value, getLimbs(), 1, m_num_limbs, GF2N_NO_WORKER);
+	}
+
+	void GF2nElementView::checkOperand( GF2nConstElementView const& other ) const
+	{
+		if( other.getArithmetic() != m_arithmetic )
+			throw ElementViewMismatchException();
+	}
+}
@@ -0,0 +1,268 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/GF2nExecutor.h"
+#include <algorithm>
+#include <unistd.h>
+
+namespace libcumffa {
+
+	/* the executor and worker id of the current thread, if it is a worker */
+	static thread_local GF2nWorkStealingExecutor *tl_executor = NULL;
+	static thread_local uint32 tl_worker = GF2N_NO_WORKER;
+
+
+	/**************************************************************************\
+
+					class GF2nWorkStealingExecutor implementations
+
+	\**************************************************************************/
+
+	GF2nWorkStealingExecutor::GF2nWorkStealingExecutor( const uint32 num_workers )
+		: m_num_workers(num_workers),
+		  m_num_queued(0),
+		  m_next_worker(0),
+		  m_stop(false)
+	{
+		if( m_num_workers == 0 )
+			m_num_workers = std::max(1u, std::thread::hardware_concurrency());
+
+		for( uint32 i=0; i<m_num_workers; ++i )
+			m_workers.push_back(std::unique_ptr<Worker>(new Worker()));
+	}
+
+	GF2nWorkStealingExecutor::~GF2nWorkStealingExecutor()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stop = true;
+		}
+		m_wakeup.notify_all();
+
+		for( uint32 i=0; i<m_threads.size(); ++i )
+			m_threads[i].join();
+	}
+
+	uint32 GF2nWorkStealingExecutor::getNumWorkers()
+	{
+		return m_num_workers;
+	}
+
+	void GF2nWorkStealingExecutor::parallelFor( const size_t count, const size_t tile_size, const GF2nTileFunction &fun )
+	{
+		if( count == 0 )
+			return;
+
+		// a worker that starts a batch runs it on its own, waiting for
+		// the other workers could dead lock the pool
+		if( tl_executor == this )
+		{
+			fun(0, count, tl_worker);
+			return;
+		}
+
+		std::call_once(m_started, &GF2nWorkStealingExecutor::start, this);
+
+		size_t tile = (tile_size == 0) ? count : tile_size;
+		size_t num_tiles = (count + tile - 1) / tile;
+
+		Job job;
+		job.fun = &fun;
+		job.pending = num_tiles;
+
+		// every worker gets a contiguous block of tiles, stealing only
+		// happens when the blocks are not finished at the same time
+		for( uint32 i=0; i<m_num_workers; ++i )
+		{
+			size_t first = num_tiles * i / m_num_workers;
+			size_t last = num_tiles * (i + 1) / m_num_workers;
+
+			std::lock_guard<std::mutex> lock(m_workers[i]->mutex);
+			for( size_t t=first; t<last; ++t )
+			{
+				Tile curr_tile = { &job, t * tile, std::min(count, (t + 1) * tile), GF2nTaskFunction() };
+				m_workers[i]->tiles.push_back(curr_tile);
+			}
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_num_queued += num_tiles;
+		}
+		m_wakeup.notify_all();
+
+		std::unique_lock<std::mutex> lock(job.mutex);
+		job.done.wait(lock, [&job] { return job.pending == 0; });
+
+		if( job.error )
+			std::rethrow_exception(job.error);
+	}
+
+	void GF2nWorkStealingExecutor::post( const GF2nTaskFunction &task )
+	{
+		std::call_once(m_started, &GF2nWorkStealingExecutor::start, this);
+
+		// a task posted by a worker stays with that worker until it is stolen
+		uint32 worker = (tl_executor == this) ? tl_worker : (m_next_worker++ % m_num_workers);
+
+		{
+			Tile curr_tile = { NULL, 0, 0, task };
+
+			std::lock_guard<std::mutex> lock(m_workers[worker]->mutex);
+			m_workers[worker]->tiles.push_back(curr_tile);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			++m_num_queued;
+		}
+		m_wakeup.notify_one();
+	}
+
+	void GF2nWorkStealingExecutor::start()
+	{
+		for( uint32 i=0; i<m_num_workers; ++i )
+			m_threads.push_back(std::thread(&GF2nWorkStealingExecutor::work, this, i));
+	}
+
+	void GF2nWorkStealingExecutor::work( const uint32 worker )
+	{
+		tl_executor = this;
+		tl_worker = worker;
+
+		while( true )
+		{
+			Tile tile;
+
+			if( popTile(worker, tile) )
+			{
+				runTile(tile, worker);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wakeup.wait(lock, [this] { return m_stop || m_num_queued > 0; });
+
+			if( m_stop && m_num_queued == 0 )
+				return;
+		}
+	}
+
+	bool GF2nWorkStealingExecutor::popTile( const uint32 worker, Tile &tile )
+	{
+		// the newest tile of the own deque is the one that is still in the cache
+		{
+			Worker &own = *m_workers[worker];
+			std::lock_guard<std::mutex> lock(own.mutex);
+			if( !own.tiles.empty() )
+			{
+				tile = own.tiles.back();
+				own.tiles.pop_back();
+				--m_num_queued;
+				return true;
+			}
+		}
+
+		for( uint32 i=1; i<m_num_workers; ++i )
+		{
+			Worker &victim = *m_workers[(worker + i) % m_num_workers];
+			std::lock_guard<std::mutex> lock(victim.mutex);
+			if( !victim.tiles.empty() )
+			{
+				tile = victim.tiles.front();
+				victim.tiles.pop_front();
+				--m_num_queued;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void GF2nWorkStealingExecutor::runTile( const Tile &tile, const uint32 worker )
+	{
+		Job *job = tile.job;
+
+		// posted tasks report their results on their own, an exception
+		// must not end the worker
+		if( job == NULL )
+		{
+			try
+			{
+				tile.task(worker);
+			}
+			catch( ... ) {}
+
+			return;
+		}
+
+		try
+		{
+			(*job->fun)(tile.begin, tile.end, worker);
+		}
+		catch( ... )
+		{
+			std::lock_guard<std::mutex> lock(job->mutex);
+			if( !job->error )
+				job->error = std::current_exception();
+		}
+
+		// the job lives on the stack of parallelFor, it must not be
+		// touched after the last tile has been reported
+		std::lock_guard<std::mutex> lock(job->mutex);
+		if( --job->pending == 0 )
+			job->done.notify_all();
+	}
+
+
+	/**************************************************************************\
+
+								global functions
+
+	\**************************************************************************/
+
+	std::shared_ptr<GF2nExecutorInterface> getDefaultExecutor()
+	{
+		static std::shared_ptr<GF2nExecutorInterface> executor(new GF2nWorkStealingExecutor());
+		return executor;
+	}
+
+	static size_t readCacheTileBytes()
+	{
+		long cache_size = 0;
+#ifdef _SC_LEVEL2_CACHE_SIZE
+		cache_size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+		if( cache_size <= 0 )
+			cache_size = 256 * 1024;
+
+		// leave half of the cache for the temporaries of the backend
+		return static_cast<size_t>(cache_size) / 2;
+	}
+
+	size_t calcCacheTileSize( const size_t bytes_per_element )
+	{
+		// initialized once even if the first calls come from several threads
+		static const size_t tile_bytes = readCacheTileBytes();
+
+		return std::max<size_t>(1, tile_bytes / std::max<size_t>(1, bytes_per_element));
+	}
+}
@@ -0,0 +1,411 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../include/GF2nFieldCache.h"
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace libcumffa {
+
+	static const char GF2N_FIELD_CACHE_MAGIC[8] = { 'G', 'F', '2', 'N', 'F', 'C', 'A', 'C' };
+	static const uint32 GF2N_FIELD_CACHE_BYTE_ORDER = 0x01020304;
+
+	/* the least size of a mapping, a mapping reserves room for the file to grow */
+	static const size_t GF2N_FIELD_CACHE_MIN_MAPPING = 1 << 20;
+
+	static_assert(sizeof(GF2nFieldCacheHeader) == 32, "the field cache header has to be 32 bytes");
+	static_assert(sizeof(GF2nFieldCacheRecord) == 24, "a field cache record has to be 24 bytes");
+
+	static uint64 checksumOf( const void *data, const size_t num_bytes )
+	{
+		const uint8 *bytes = static_cast<const uint8 *>(data);
+		uint64 hash = 0xCBF29CE484222325ULL;
+
+		for( size_t i=0; i<num_bytes; ++i )
+		{
+			hash ^= bytes[i];
+			hash *= 0x100000001B3ULL;
+		}
+
+		return hash;
+	}
+
+	static size_t paddedSize( const size_t num_bytes )
+	{
+		return (num_bytes + 7) & ~static_cast<size_t>(7);
+	}
+
+	/* the end of the record at offset, 0 if it is torn or past file_bytes */
+	static size_t recordEnd( const char *base, const size_t offset, const size_t file_bytes )
+	{
+		if( offset + sizeof(GF2nFieldCacheRecord) > file_bytes )
+			return 0;
+
+		const GF2nFieldCacheRecord *record = reinterpret_cast<const GF2nFieldCacheRecord *>(base + offset);
+		size_t end = offset + sizeof(GF2nFieldCacheRecord) + paddedSize(record->num_bytes);
+
+		if( end > file_bytes || record->checksum != checksumOf(record + 1, record->num_bytes) )
+			return 0;
+
+		return end;
+	}
+
+	static bool isOwnHeader( const GF2nFieldCacheHeader &header )
+	{
+		return memcmp(header.magic, GF2N_FIELD_CACHE_MAGIC, sizeof(header.magic)) == 0
+			&& header.version == GF2N_FIELD_CACHE_VERSION
+			&& header.header_bytes >= sizeof(GF2nFieldCacheHeader)
+			&& header.byte_order == GF2N_FIELD_CACHE_BYTE_ORDER;
+	}
+
+	/*
+		the end of the last record before the first torn one, file_bytes
+		if the file has no own header. Only call it under LOCK_EX, then
+		no writer is in the middle of a record.
+	*/
+	static size_t validBytes( const std::string &path, const int fd, const size_t file_bytes )
+	{
+		if( file_bytes < sizeof(GF2nFieldCacheHeader) )
+			return file_bytes;
+
+		void *ptr = mmap(NULL, file_bytes, PROT_READ, MAP_SHARED, fd, 0);
+		if( ptr == MAP_FAILED )
+			throw FieldCacheIOException(path, strerror(errno));
+
+		const char *base = static_cast<const char *>(ptr);
+		const GF2nFieldCacheHeader &header = *reinterpret_cast<const GF2nFieldCacheHeader *>(base);
+		size_t valid_bytes = file_bytes;
+
+		if( isOwnHeader(header) )
+		{
+			valid_bytes = paddedSize(header.header_bytes);
+			for( size_t end; (end = recordEnd(base, valid_bytes, file_bytes)) != 0; )
+				valid_bytes = end;
+			valid_bytes = std::min(valid_bytes, file_bytes);
+		}
+
+		munmap(ptr, file_bytes);
+
+		return valid_bytes;
+	}
+
+	static void writeAll( const std::string &path, const int fd, const void *data, const size_t num_bytes )
+	{
+		const char *bytes = static_cast<const char *>(data);
+
+		for( size_t done=0; done<num_bytes; )
+		{
+			ssize_t res = ::write(fd, bytes + done, num_bytes - done);
+
+			if( res < 0 && errno == EINTR )
+				continue;
+			if( res < 0 )
+				throw FieldCacheIOException(path, strerror(errno));
+
+			done += static_cast<size_t>(res);
+		}
+	}
+
+	/**************************************************************************\
+
+						class GF2nFieldCache implementations
+
+	\**************************************************************************/
+
+	GF2nFieldCache::GF2nFieldCache()
+		: m_fd(-1)
+		, m_writable(false)
+		, m_indexed_bytes(0)
+	{
+	}
+
+	GF2nFieldCache::~GF2nFieldCache()
+	{
+		release();
+	}
+
+	void GF2nFieldCache::open( const std::string &path )
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		release();
+
+		bool writable = true;
+		int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+
+		// a cache that is shared read only
+		if( fd < 0 && (errno == EACCES || errno == EROFS) )
+		{
+			writable = false;
+			fd = ::open(path.c_str(), O_RDONLY);
+		}
+
+		if( fd < 0 )
+			throw FieldCacheIOException(path, strerror(errno));
+
+		m_path = path;
+		m_fd = fd;
+		m_writable = writable;
+
+		try
+		{
+			if( writable )
+			{
+				// the first process writes the header, the others wait
+				// for it
+				flock(fd, LOCK_EX);
+
+				struct stat st;
+				if( fstat(fd, &st) != 0 )
+					throw FieldCacheIOException(path, strerror(errno));
+
+				// a record torn by a crashed writer would hide every
+				// record appended after it, it is cut off
+				size_t file_bytes = static_cast<size_t>(st.st_size);
+				size_t valid_bytes = validBytes(path, fd, file_bytes);
+
+				if( valid_bytes < file_bytes && ftruncate(fd, static_cast<off_t>(valid_bytes)) != 0 )
+					throw FieldCacheIOException(path, strerror(errno));
+
+				if( file_bytes == 0 )
+				{
+					GF2nFieldCacheHeader header;
+					memset(&header, 0, sizeof(header));
+					memcpy(header.magic, GF2N_FIELD_CACHE_MAGIC, sizeof(header.magic));
+					header.version = GF2N_FIELD_CACHE_VERSION;
+					header.header_bytes = sizeof(GF2nFieldCacheHeader);
+					header.byte_order = GF2N_FIELD_CACHE_BYTE_ORDER;
+
+					writeAll(path, fd, &header, sizeof(header));
+				}
+
+				flock(fd, LOCK_UN);
+			}
+
+			remap();
+		}
+		catch( ... )
+		{
+			release();
+			throw;
+		}
+	}
+
+	void GF2nFieldCache::close()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		release();
+	}
+
+	bool GF2nFieldCache::isOpen()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_fd >= 0;
+	}
+
+	const void *GF2nFieldCache::find( const uint32 kind, const uint64 key, uint32 &num_bytes )
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if( m_fd < 0 )
+			return NULL;
+
+		std::pair<uint32, uint64> id(kind, key);
+		std::map<std::pair<uint32, uint64>, const GF2nFieldCacheRecord *>::const_iterator it = m_records.find(id);
+
+		// other processes may have appended the record
+		if( it == m_records.end() )
+		{
+			remap();
+			it = m_records.find(id);
+		}
+
+		if( it == m_records.end() )
+			return NULL;
+
+		num_bytes = it->second->num_bytes;
+		return it->second + 1;
+	}
+
+	void GF2nFieldCache::insert( const uint32 kind, const uint64 key, const void *data, const uint32 num_bytes )
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if( m_fd < 0 || !m_writable )
+			return;
+
+		std::vector<uint8> buf(sizeof(GF2nFieldCacheRecord) + paddedSize(num_bytes), 0);
+
+		GF2nFieldCacheRecord record;
+		record.key = key;
+		record.kind = kind;
+		record.num_bytes = num_bytes;
+		record.checksum = checksumOf(data, num_bytes);
+
+		memcpy(&buf[0], &record, sizeof(record));
+		memcpy(&buf[sizeof(record)], data, num_bytes);
+
+		// the record is appended by a single write, the lock keeps the
+		// records of processes that append at once apart
+		flock(m_fd, LOCK_EX);
+
+		try
+		{
+			writeAll(m_path, m_fd, &buf[0], buf.size());
+		}
+		catch( ... )
+		{
+			flock(m_fd, LOCK_UN);
+			throw;
+		}
+
+		flock(m_fd, LOCK_UN);
+	}
+
+	void GF2nFieldCache::remap()
+	{
+		// writers append and cut off torn records under LOCK_EX, the
+		// shared lock keeps the file from shrinking below the size that
+		// is indexed, which would fault on the pages past its end
+		flock(m_fd, LOCK_SH);
+
+		try
+		{
+			indexRecords();
+		}
+		catch( ... )
+		{
+			flock(m_fd, LOCK_UN);
+			throw;
+		}
+
+		flock(m_fd, LOCK_UN);
+	}
+
+	void GF2nFieldCache::indexRecords()
+	{
+		struct stat st;
+		if( fstat(m_fd, &st) != 0 )
+			throw FieldCacheIOException(m_path, strerror(errno));
+
+		size_t file_bytes = static_cast<size_t>(st.st_size);
+		size_t mapped_bytes = m_mappings.empty() ? 0 : m_mappings.back().second;
+
+		if( file_bytes <= m_indexed_bytes )
+			return;
+
+		// the pages of a mapping past the end of the file become valid
+		// as the file grows, a new mapping is only needed once it is full
+		if( file_bytes > mapped_bytes )
+		{
+			size_t num_bytes = std::max(2 * file_bytes, GF2N_FIELD_CACHE_MIN_MAPPING);
+			void *ptr = mmap(NULL, num_bytes, PROT_READ, MAP_SHARED, m_fd, 0);
+
+			if( ptr == MAP_FAILED )
+				throw FieldCacheIOException(m_path, strerror(errno));
+
+			m_mappings.push_back(std::make_pair(ptr, num_bytes));
+			m_records.clear();
+			m_indexed_bytes = 0;
+		}
+
+		const char *base = static_cast<const char *>(m_mappings.back().first);
+
+		if( m_indexed_bytes == 0 )
+		{
+			if( file_bytes < sizeof(GF2nFieldCacheHeader) )
+				throw FieldCacheFormatException(m_path, "the file is too small for the header");
+
+			const GF2nFieldCacheHeader &header = *reinterpret_cast<const GF2nFieldCacheHeader *>(base);
+
+			if( memcmp(header.magic, GF2N_FIELD_CACHE_MAGIC, sizeof(header.magic)) != 0 )
+				throw FieldCacheFormatException(m_path, "no field cache");
+			if( header.version != GF2N_FIELD_CACHE_VERSION || header.header_bytes < sizeof(GF2nFieldCacheHeader) )
+				throw FieldCacheFormatException(m_path, "unsupported version");
+			if( header.byte_order != GF2N_FIELD_CACHE_BYTE_ORDER )
+				throw FieldCacheFormatException(m_path, "the file has another byte order");
+
+			m_indexed_bytes = paddedSize(header.header_bytes);
+		}
+
+		// no writer is in the middle of a record under the lock, a torn
+		// one is left by a crashed writer. It is cut off by the next
+		// writable open, until then the records after it are not indexed.
+		for( size_t end; (end = recordEnd(base, m_indexed_bytes, file_bytes)) != 0; m_indexed_bytes = end )
+		{
+			const GF2nFieldCacheRecord *record = reinterpret_cast<const GF2nFieldCacheRecord *>(base + m_indexed_bytes);
+
+			// the first record of a key wins, a later one holds the same data
+			m_records.insert(std::make_pair(std::make_pair(record->kind, record->key), record));
+		}
+	}
+
+	void GF2nFieldCache::release()
+	{
+		for( size_t i=0; i<m_mappings.size(); ++i )
+			munmap(m_mappings[i].first, m_mappings[i].second);
+
+		if( m_fd >= 0 )
+			::close(m_fd);
+
+		m_mappings.clear();
+		m_records.clear();
+		m_indexed_bytes = 0;
+		m_fd = -1;
+		m_writable = false;
+		m_path.clear();
+	}
+
+	/* opens the file named by GF2N_FIELD_CACHE_ENV, if any */
+	static bool openFromEnvironment( GF2nFieldCache &cache )
+	{
+		const char *path = getenv(GF2N_FIELD_CACHE_ENV);
+		if( path == NULL || *path == '\0' )
+			return false;
+
+		// the cache only saves work, without it everything is computed
+		try
+		{
+			cache.open(path);
+		}
+		catch( std::exception & )
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	GF2nFieldCache &getFieldCache()
+	{
+		static GF2nFieldCache cache;
+		static bool from_environment = openFromEnvironment(cache);
+		(void)from_environment;
+		return cache;
+	}
+}
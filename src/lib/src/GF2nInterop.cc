@@ -0,0 +1,111 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../include/GF2nInterop.h"
+#include "../include/GF2nArithmeticOpenSSL.h"
+
+namespace libcumffa {
+	namespace interop {
+
+		GF2nLimbView viewOf( const BIGNUM *value, const uint32 num_limbs )
+		{
+			if( BN_num_bytes(value) > static_cast<int>(num_limbs * sizeof(ufixn)) )
+				throw InvalidEncodingException("the value does not fit into the field");
+
+			GF2nLimbView view;
+			ufixn *limbs = view.allocate(num_limbs);
+			cpu::openssl::bn2limbs(value, limbs, num_limbs);
+
+			return view;
+		}
+
+		GF2nLimbView viewOf( mpz_srcptr value, const uint32 num_limbs )
+		{
+			uint32 num_words = static_cast<uint32>(mpz_size(value));
+
+			if( num_words * sizeof(mp_limb_t) > num_limbs * sizeof(ufixn) )
+				throw InvalidEncodingException("the value does not fit into the field");
+
+			// mpz_t keeps no leading zero limbs, so only a value with the
+			// top limb set covers all limbs
+			if( sizeof(mp_limb_t) == sizeof(ufixn) && num_words == num_limbs )
+				return GF2nLimbView(reinterpret_cast<const ufixn *>(mpz_limbs_read(value)), num_limbs);
+
+			GF2nLimbView view;
+			ufixn *limbs = view.allocate(num_limbs);
+			mpz_export(limbs, NULL, -1, sizeof(ufixn), 0, 0, value);
+
+			return view;
+		}
+
+		void copyTo( GF2nArithmeticElement &element, BIGNUM *ret )
+		{
+			uint32 num_limbs = utils::calcNumberChunks<uint32>(element.getFieldSize(), sizeof(ufixn) * 8);
+			std::vector<ufixn> limbs(num_limbs);
+
+			element.getLimbs(limbs.data(), num_limbs);
+			cpu::openssl::limbs2bn(limbs.data(), num_limbs, ret);
+		}
+
+		void copyTo( GF2nArithmeticElement &element, mpz_ptr ret )
+		{
+			uint32 num_limbs = utils::calcNumberChunks<uint32>(element.getFieldSize(), sizeof(ufixn) * 8);
+
+			if( sizeof(mp_limb_t) == sizeof(ufixn) )
+			{
+				// the element writes straight into the limbs of ret
+				mp_limb_t *words = mpz_limbs_write(ret, num_limbs > 0 ? num_limbs : 1);
+				words[0] = 0;
+				element.getLimbs(reinterpret_cast<ufixn *>(words), num_limbs);
+				mpz_limbs_finish(ret, num_limbs);
+				return;
+			}
+
+			std::vector<ufixn> limbs(num_limbs);
+			element.getLimbs(limbs.data(), num_limbs);
+			mpz_import(ret, num_limbs, -1, sizeof(ufixn), 0, 0, limbs.data());
+		}
+
+		GF2nArithmeticElement adopt( GF2nArithmetic &arithmetic, BIGNUM *value )
+		{
+			cpu::GF2nArithmeticOpenSSL *backend = dynamic_cast<cpu::GF2nArithmeticOpenSSL *>(arithmetic.getBackend());
+
+			if( backend )
+				return backend->adoptValue(value);
+
+			GF2nArithmeticElement element;
+
+			try
+			{
+				element = getElement(arithmetic, value);
+			}
+			catch( ... )
+			{
+				BN_free(value);
+				throw;
+			}
+
+			BN_free(value);
+			return element;
+		}
+	}
+}
@@ -0,0 +1,725 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/GF2nIrreducible.h"
+#include "GF2nNativeKernels.h"
+#include "GF2nExecutor.h"
+#include "GF2nArithmetic.h"
+#include "GF2nFieldCache.h"
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <cstring>
+
+namespace libcumffa {
+
+	/* the definition of the table, the rows are read through pointers */
+	constexpr int16 GF2nIrreducibleTable::rows[GF2N_IRRED_MAX_DEGREE][GF2N_IRRED_MAX_TERMS];
+
+	namespace utils {
+
+		/*
+			Ben-Or rounds before Rabin's test, round i rejects a modulus
+			with a factor whose degree divides i
+		*/
+		static const uint32 GF2N_IRRED_BEN_OR_ROUNDS = 12;
+
+		/*
+			further Ben-Or rounds on the squaring chain of Rabin's test.
+			The factors x^(2^i) - x of a window are multiplied, so a
+			window costs one gcd.
+		*/
+		static const uint32 GF2N_IRRED_BEN_OR_CHAIN_ROUNDS = 512;
+		static const uint32 GF2N_IRRED_BEN_OR_WINDOW = 32;
+
+		/* candidates of a search that are tested in parallel */
+		static const size_t GF2N_IRRED_SEARCH_BLOCK = 64;
+
+		/* degree of the num_words words of a, -1 for the zero polynomial */
+		static int64 degreeOf( const uint64 *a, const uint32 num_words )
+		{
+			for( uint32 i=num_words; i-->0; )
+			{
+				if( a[i] != 0 )
+					return 64 * static_cast<int64>(i) + 63 - __builtin_clzll(a[i]);
+			}
+
+			return -1;
+		}
+
+		/*
+			true if gcd(u, v) = 1. Both have a spare top word for the
+			shifted xor.
+		*/
+		static bool isCoprime( std::vector<uint64> &u, std::vector<uint64> &v )
+		{
+			int64 deg_u = degreeOf(&u[0], static_cast<uint32>(u.size()));
+			int64 deg_v = degreeOf(&v[0], static_cast<uint32>(v.size()));
+
+			while( deg_u > 0 && deg_v > 0 )
+			{
+				if( deg_u < deg_v )
+				{
+					u.swap(v);
+					std::swap(deg_u, deg_v);
+				}
+
+				uint32 shift = static_cast<uint32>(deg_u - deg_v);
+				uint32 num_words = static_cast<uint32>(deg_v / 64) + 1;
+
+				for( uint32 j=0; j<num_words; ++j )
+					native::xorShifted(&u[0], v[j], 64 * j + shift);
+
+				deg_u = degreeOf(&u[0], static_cast<uint32>(deg_u / 64) + 1);
+			}
+
+			// a constant is a unit, zero leaves the other one as gcd
+			return deg_u == 0 || deg_v == 0;
+		}
+
+		/*
+			Ben-Or round i, true if gcd(x^(2^i) + x, f) = 1. x^(2^i) = x
+			modulo x^(2^i) + x, so the terms of f fold onto the exponents
+			1 to 2^i - 1 and the gcd is one of two small polynomials.
+		*/
+		static bool passesBenOrRound( const std::vector<uint32> &exponents, const uint32 i )
+		{
+			const uint64 period = (1ULL << i) - 1;
+			const uint32 num_words = static_cast<uint32>((1ULL << i) / 64) + 2;
+
+			std::vector<uint64> g(num_words, 0), r(num_words, 0);
+			native::xorShifted(&g[0], 1, 1U << i);
+			native::xorShifted(&g[0], 1, 1);
+
+			for( size_t j=0; j<exponents.size(); ++j )
+			{
+				uint64 e = exponents[j];
+				if( e > period )
+					e = (e - 1) % period + 1;
+
+				native::xorShifted(&r[0], 1, static_cast<uint32>(e));
+			}
+
+			return isCoprime(g, r);
+		}
+
+		/* the num_dst words of src shifted down by shift bits */
+		static void shiftDown( const uint64 *src, const uint32 num_src, const uint32 shift, uint64 *dst, const uint32 num_dst )
+		{
+			const uint32 word = shift / 64;
+			const uint32 bits = shift % 64;
+
+			for( uint32 i=0; i<num_dst; ++i )
+			{
+				uint64 lo = (i + word < num_src) ? src[i + word] : 0;
+				uint64 hi = (i + word + 1 < num_src) ? src[i + word + 1] : 0;
+				dst[i] = (bits == 0) ? lo : ((lo >> bits) | (hi << (64 - bits)));
+			}
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		/*
+			polynomials modulo a sparse f of degree n, stored in n / 64 + 1
+			words, least significant word first. Words are one larger than
+			needed for n bits, so f itself fits, too.
+		*/
+		class GF2nSparseRing
+		{
+		public:
+			explicit GF2nSparseRing( GF2nIrreducibleTerms const& terms )
+				: m_terms(terms)
+				, m_degree(static_cast<uint32>(terms.exponents[0]))
+				, m_num_words(m_degree / 64 + 1)
+				, m_scratch(2 * m_num_words + 1)
+				, m_kernels(native::getWordKernels(native::getIsa()))
+				{}
+
+		public:
+			uint32 getNumWords() const { return m_num_words; }
+
+			void getModulus( uint64 *f ) const
+			{
+				std::fill(f, f + m_num_words, 0);
+
+				for( uint32 i=0; i<GF2N_IRRED_MAX_TERMS && m_terms.exponents[i] >= 0; ++i )
+					f[m_terms.exponents[i] / 64] |= 1ULL << (m_terms.exponents[i] % 64);
+			}
+
+			/* res = a * b mod f, res may be a or b */
+			void mul( const uint64 *a, const uint64 *b, uint64 *res )
+			{
+				uint64 *c = &m_scratch[0];
+
+				m_kernels.product(a, m_num_words, b, m_num_words, c);
+				c[2 * m_num_words] = 0;
+
+				reduce(c, res);
+			}
+
+			/* res = a^2 mod f, res may be a */
+			void sqr( const uint64 *a, uint64 *res )
+			{
+				uint64 *c = &m_scratch[0];
+
+				m_kernels.square(a, m_num_words, c);
+				c[2 * m_num_words] = 0;
+
+				reduce(c, res);
+			}
+
+			/* true if gcd(a, f) = 1 */
+			bool isCoprime( const uint64 *a )
+			{
+				std::vector<uint64> u(a, a + m_num_words), v(m_num_words);
+				u.push_back(0);
+				getModulus(&v[0]);
+				v.push_back(0);
+
+				return utils::isCoprime(u, v);
+			}
+
+		private:
+			void fold( uint64 *c, const uint64 value, const uint32 bit_pos )
+			{
+				for( uint32 i=1; i<GF2N_IRRED_MAX_TERMS && m_terms.exponents[i] >= 0; ++i )
+					native::xorShifted(c, value, bit_pos + m_terms.exponents[i]);
+			}
+
+			/*
+				reduces the 2 * num_words words of c from the top. A fold
+				lands in the word it came from if a middle term is close to
+				n, so every word is folded until it is clear.
+			*/
+			void reduce( uint64 *c, uint64 *res )
+			{
+				const uint32 top_word = m_degree / 64;
+				const uint32 top_shift = m_degree % 64;
+
+				for( uint32 i=2 * m_num_words - 1; i>top_word; --i )
+				{
+					while( c[i] != 0 )
+					{
+						uint64 t = c[i];
+						c[i] = 0;
+						fold(c, t, 64 * i - m_degree);
+					}
+				}
+
+				for( uint64 t = c[top_word] >> top_shift; t != 0; t = c[top_word] >> top_shift )
+				{
+					c[top_word] ^= t << top_shift;
+					fold(c, t, 0);
+				}
+
+				std::copy(c, c + m_num_words, res);
+			}
+
+		private:
+			GF2nIrreducibleTerms m_terms;
+			uint32 m_degree;
+			uint32 m_num_words;
+			std::vector<uint64> m_scratch;
+			const native::GF2nWordKernels &m_kernels;
+		};
+
+		///////////////////////////////////////////////////////////////////////
+		/*
+			polynomials modulo any f of degree n in the words of
+			GF2nSparseRing. Products are reduced with Barrett's method,
+			q = floor(floor(c / x^n) * mu / x^n) with mu = floor(x^2n / f)
+			is the exact quotient of c by f, so a reduction costs two
+			multiplications.
+		*/
+		class GF2nDenseRing
+		{
+		public:
+			GF2nDenseRing( const std::vector<uint64> &f, const uint32 degree )
+				: m_f(f)
+				, m_degree(degree)
+				, m_num_words(degree / 64 + 1)
+				, m_mu(m_num_words + 1, 0)
+				, m_scratch(2 * m_num_words + 2)
+				, m_hi(m_num_words + 1)
+				, m_quot(m_num_words + 1)
+				, m_prod(2 * m_num_words + 2)
+				, m_kernels(native::getWordKernels(native::getIsa()))
+			{
+				m_f.resize(m_num_words, 0);
+
+				// mu by long division of x^2n
+				std::vector<uint64> rem(2 * m_num_words + 1, 0);
+				native::xorShifted(&rem[0], 1, 2 * m_degree);
+
+				for( uint32 bit=2 * m_degree + 1; bit-->m_degree; )
+				{
+					if( ((rem[bit / 64] >> (bit % 64)) & 1) == 0 )
+						continue;
+
+					for( uint32 j=0; j<m_num_words; ++j )
+						native::xorShifted(&rem[0], m_f[j], 64 * j + bit - m_degree);
+					m_mu[(bit - m_degree) / 64] |= 1ULL << ((bit - m_degree) % 64);
+				}
+			}
+
+		public:
+			uint32 getNumWords() const { return m_num_words; }
+
+			void getModulus( uint64 *f ) const
+			{
+				std::copy(m_f.begin(), m_f.end(), f);
+			}
+
+			/* res = a * b mod f, res may be a or b */
+			void mul( const uint64 *a, const uint64 *b, uint64 *res )
+			{
+				m_kernels.product(a, m_num_words, b, m_num_words, &m_scratch[0]);
+				reduce(&m_scratch[0], res);
+			}
+
+			/* res = a^2 mod f, res may be a */
+			void sqr( const uint64 *a, uint64 *res )
+			{
+				m_kernels.square(a, m_num_words, &m_scratch[0]);
+				reduce(&m_scratch[0], res);
+			}
+
+			/* true if gcd(a, f) = 1 */
+			bool isCoprime( const uint64 *a )
+			{
+				std::vector<uint64> u(a, a + m_num_words), v(m_f);
+				u.push_back(0);
+				v.push_back(0);
+
+				return utils::isCoprime(u, v);
+			}
+
+		private:
+			/* reduces the 2 * num_words words of c, which has a degree below 2n - 1 */
+			void reduce( const uint64 *c, uint64 *res )
+			{
+				shiftDown(c, 2 * m_num_words, m_degree, &m_hi[0], m_num_words);
+				m_kernels.product(&m_hi[0], m_num_words, &m_mu[0], m_num_words + 1, &m_prod[0]);
+				shiftDown(&m_prod[0], 2 * m_num_words + 1, m_degree, &m_quot[0], m_num_words);
+				m_kernels.product(&m_quot[0], m_num_words, &m_f[0], m_num_words, &m_prod[0]);
+
+				for( uint32 i=0; i<m_num_words; ++i )
+					res[i] = c[i] ^ m_prod[i];
+			}
+
+		private:
+			std::vector<uint64> m_f;
+			uint32 m_degree;
+			uint32 m_num_words;
+			std::vector<uint64> m_mu;
+			std::vector<uint64> m_scratch;
+			std::vector<uint64> m_hi;
+			std::vector<uint64> m_quot;
+			std::vector<uint64> m_prod;
+			const native::GF2nWordKernels &m_kernels;
+		};
+
+		/* the distinct prime factors of n */
+		static void primeFactors( uint32 n, std::vector<uint32> &factors )
+		{
+			for( uint32 p=2; p * p <= n; ++p )
+			{
+				if( n % p != 0 )
+					continue;
+
+				factors.push_back(p);
+				while( n % p == 0 )
+					n /= p;
+			}
+
+			if( n > 1 )
+				factors.push_back(n);
+		}
+
+		/*
+			the irreducibility test of a modulus of degree n > 1 with the
+			exponents of its nonzero terms
+		*/
+		template<typename Ring>
+		static bool passesIrreducibilityTest( Ring &ring, const std::vector<uint32> &exponents, const uint32 degree )
+		{
+			// most candidates have a small factor, the Ben-Or rounds
+			// reject them before the squarings of Rabin's test
+			for( uint32 i=1; i<=GF2N_IRRED_BEN_OR_ROUNDS && 2 * i <= degree; ++i )
+			{
+				if( !passesBenOrRound(exponents, i) )
+					return false;
+			}
+
+			// f is irreducible if and only if x^(2^n) = x mod f and
+			// gcd(x^(2^(n/p)) - x, f) = 1 for every prime p dividing n
+			std::vector<uint32> factors;
+			primeFactors(degree, factors);
+
+			std::vector<uint64> u(ring.getNumWords(), 0);
+			std::vector<uint64> prod(ring.getNumWords(), 0);
+			u[0] = 2;
+			prod[0] = 1;
+
+			for( uint32 i=1; i<=degree; ++i )
+			{
+				ring.sqr(&u[0], &u[0]);
+
+				// the Ben-Or rounds of the chain catch the factors of
+				// moderate degree long before the chain ends
+				if( i > GF2N_IRRED_BEN_OR_ROUNDS && i <= GF2N_IRRED_BEN_OR_CHAIN_ROUNDS && 2 * i <= degree )
+				{
+					u[0] ^= 2;
+					ring.mul(&prod[0], &u[0], &prod[0]);
+					u[0] ^= 2;
+
+					bool window_end = (i % GF2N_IRRED_BEN_OR_WINDOW == 0 || i == GF2N_IRRED_BEN_OR_CHAIN_ROUNDS || 2 * (i + 1) > degree);
+					if( window_end && !ring.isCoprime(&prod[0]) )
+						return false;
+				}
+
+				bool check = false;
+				for( size_t j=0; j<factors.size() && !check; ++j )
+					check = (i == degree / factors[j]);
+
+				if( !check )
+					continue;
+
+				u[0] ^= 2;
+				bool coprime = ring.isCoprime(&u[0]);
+				u[0] ^= 2;
+
+				if( !coprime )
+					return false;
+			}
+
+			u[0] ^= 2;
+			return degreeOf(&u[0], ring.getNumWords()) < 0;
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		/*
+			the candidates of a search in the order of NTL's
+			BuildSparseIrred: trinomials x^n + x^k + 1 by k up to n / 2,
+			then pentanomials x^n + x^k1 + x^k2 + x^k3 + 1 by k1, k2 and
+			k3. A trinomial of a degree divisible by 8 is never
+			irreducible (Swan), those are skipped.
+		*/
+		class GF2nSparseCandidates
+		{
+		public:
+			explicit GF2nSparseCandidates( const uint32 degree )
+				: m_degree(degree)
+				, m_k1(1)
+				, m_k2(0)
+				, m_k3(0)
+				, m_trinomials(degree % 8 != 0)
+			{
+				if( !m_trinomials )
+					startPentanomials();
+			}
+
+			bool next( GF2nIrreducibleTerms &terms )
+			{
+				std::fill(terms.exponents, terms.exponents + GF2N_IRRED_MAX_TERMS, -1);
+				terms.exponents[0] = static_cast<int32>(m_degree);
+
+				if( m_trinomials )
+				{
+					terms.exponents[1] = static_cast<int32>(m_k1);
+					terms.exponents[2] = 0;
+
+					if( ++m_k1 > m_degree / 2 )
+					{
+						m_trinomials = false;
+						startPentanomials();
+					}
+					return true;
+				}
+
+				if( m_k1 >= m_degree )
+					return false;
+
+				terms.exponents[1] = static_cast<int32>(m_k1);
+				terms.exponents[2] = static_cast<int32>(m_k2);
+				terms.exponents[3] = static_cast<int32>(m_k3);
+				terms.exponents[4] = 0;
+
+				if( ++m_k3 == m_k2 )
+				{
+					m_k3 = 1;
+					if( ++m_k2 == m_k1 )
+					{
+						m_k2 = 2;
+						++m_k1;
+					}
+				}
+				return true;
+			}
+
+		private:
+			void startPentanomials()
+			{
+				m_k1 = 3;
+				m_k2 = 2;
+				m_k3 = 1;
+			}
+
+		private:
+			uint32 m_degree;
+			uint32 m_k1;
+			uint32 m_k2;
+			uint32 m_k3;
+			bool m_trinomials;
+		};
+
+		///////////////////////////////////////////////////////////////////////
+		/*
+			the moduli found by searches of this process and the results
+			of the tests of other moduli
+		*/
+		struct GF2nModulusTest
+		{
+			std::vector<ufixn> modulus;
+			bool irreducible;
+		};
+
+		struct GF2nIrreducibleCache
+		{
+			std::mutex mutex;
+			std::map<uint32, GF2nIrreducibleTerms> found;
+
+			/* the tested moduli by hash */
+			std::map<uint64, GF2nModulusTest> tested;
+		};
+
+		static GF2nIrreducibleCache &getCache()
+		{
+			static GF2nIrreducibleCache cache;
+			return cache;
+		}
+
+		/**************************************************************************\
+
+						irreducible polynomial implementations
+
+		\**************************************************************************/
+
+		GF2nIrreducibleTerms getIrreducibleTerms( const uint32 field_size )
+		{
+			if( field_size == 0 )
+				throw FieldSizeNotSupportedException(field_size);
+
+			GF2nIrreducibleTerms terms;
+
+			if( field_size <= GF2N_IRRED_MAX_DEGREE )
+			{
+				const int16 *row = GF2nIrreducibleTable::rows[field_size - 1];
+				std::copy(row, row + GF2N_IRRED_MAX_TERMS, terms.exponents);
+				return terms;
+			}
+
+			GF2nIrreducibleCache &cache = getCache();
+
+			{
+				std::lock_guard<std::mutex> lock(cache.mutex);
+				std::map<uint32, GF2nIrreducibleTerms>::const_iterator it = cache.found.find(field_size);
+				if( it != cache.found.end() )
+					return it->second;
+			}
+
+			uint32 num_bytes = 0;
+			const void *data = getFieldCache().find(GF2N_FIELD_CACHE_MODULUS, field_size, num_bytes);
+
+			if( data && num_bytes == sizeof(terms) )
+				memcpy(&terms, data, sizeof(terms));
+
+			// two threads may search the same degree, both find the same
+			// modulus
+			if( !data || num_bytes != sizeof(terms) || terms.exponents[0] != static_cast<int32>(field_size) )
+			{
+				terms = findIrreducible(field_size);
+				getFieldCache().insert(GF2N_FIELD_CACHE_MODULUS, field_size, &terms, sizeof(terms));
+			}
+
+			std::lock_guard<std::mutex> lock(cache.mutex);
+			cache.found.insert(std::make_pair(field_size, terms));
+
+			return terms;
+		}
+
+		void getIrreducibleExponents( const uint32 field_size, std::vector<int> &exponents )
+		{
+			GF2nIrreducibleTerms terms = getIrreducibleTerms(field_size);
+
+			for( uint32 i=0; i<GF2N_IRRED_MAX_TERMS && terms.exponents[i] >= 0; ++i )
+				exponents.push_back(terms.exponents[i]);
+		}
+
+		void getIrreducibleLimbs( const uint32 field_size, ufixn *limbs, const uint32 num_limbs )
+		{
+			GF2nIrreducibleTerms terms = getIrreducibleTerms(field_size);
+			const uint32 limb_bits = sizeof(ufixn) * 8;
+
+			std::fill(limbs, limbs + num_limbs, 0);
+
+			for( uint32 i=0; i<GF2N_IRRED_MAX_TERMS && terms.exponents[i] >= 0; ++i )
+			{
+				uint32 exponent = static_cast<uint32>(terms.exponents[i]);
+				if( exponent / limb_bits < num_limbs )
+					limbs[exponent / limb_bits] |= static_cast<ufixn>(1) << (exponent % limb_bits);
+			}
+		}
+
+		bool isIrreducible( GF2nIrreducibleTerms const& terms )
+		{
+			uint32 degree = static_cast<uint32>(std::max(terms.exponents[0], 0));
+
+			if( degree <= 1 )
+				return degree == 1;
+
+			// without the constant term x divides the polynomial
+			uint32 num_terms = 0;
+			while( num_terms < GF2N_IRRED_MAX_TERMS && terms.exponents[num_terms] >= 0 )
+				++num_terms;
+			if( terms.exponents[num_terms - 1] != 0 )
+				return false;
+
+			std::vector<uint32> exponents(terms.exponents, terms.exponents + num_terms);
+			GF2nSparseRing ring(terms);
+
+			return passesIrreducibilityTest(ring, exponents, degree);
+		}
+
+		bool isIrreducible( const ufixn *limbs, const uint32 num_limbs )
+		{
+			const uint32 limb_bits = sizeof(ufixn) * 8;
+
+			std::vector<uint32> exponents;
+			for( uint32 i=num_limbs * limb_bits; i-->0; )
+			{
+				if( (limbs[i / limb_bits] >> (i % limb_bits)) & 1 )
+					exponents.push_back(i);
+			}
+
+			if( exponents.empty() || exponents[0] <= 1 )
+				return !exponents.empty() && exponents[0] == 1;
+
+			uint32 degree = exponents[0];
+			std::vector<ufixn> modulus(limbs, limbs + degree / limb_bits + 1);
+			uint64 hash = hashLimbs(&modulus[0], degree + 1);
+
+			GF2nIrreducibleCache &cache = getCache();
+
+			{
+				std::lock_guard<std::mutex> lock(cache.mutex);
+				std::map<uint64, GF2nModulusTest>::const_iterator it = cache.tested.find(hash);
+				if( it != cache.tested.end() && it->second.modulus == modulus )
+					return it->second.irreducible;
+			}
+
+			// a record of the field cache is the result followed by the
+			// words of the modulus
+			std::vector<uint64> record(degree / 64 + 2, 0);
+			uint64 *f = &record[1];
+			for( size_t i=0; i<exponents.size(); ++i )
+				f[exponents[i] / 64] |= 1ULL << (exponents[i] % 64);
+
+			uint32 num_bytes = 0;
+			const uint64 *data = static_cast<const uint64 *>(getFieldCache().find(GF2N_FIELD_CACHE_IRREDUCIBLE, hash, num_bytes));
+			bool cached = (data != NULL && num_bytes == record.size() * sizeof(uint64) && std::equal(f, f + record.size() - 1, data + 1));
+
+			bool irreducible = false;
+
+			if( cached )
+				irreducible = (data[0] != 0);
+			else if( exponents.back() != 0 )
+				irreducible = false;
+			else if( exponents.size() <= GF2N_IRRED_MAX_TERMS )
+			{
+				GF2nIrreducibleTerms terms;
+				std::fill(terms.exponents, terms.exponents + GF2N_IRRED_MAX_TERMS, -1);
+				std::copy(exponents.begin(), exponents.end(), terms.exponents);
+				irreducible = isIrreducible(terms);
+			}
+			else
+			{
+				GF2nDenseRing ring(std::vector<uint64>(f, f + record.size() - 1), degree);
+				irreducible = passesIrreducibilityTest(ring, exponents, degree);
+			}
+
+			if( !cached )
+			{
+				record[0] = irreducible ? 1 : 0;
+				getFieldCache().insert(GF2N_FIELD_CACHE_IRREDUCIBLE, hash, &record[0], static_cast<uint32>(record.size() * sizeof(uint64)));
+			}
+
+			std::lock_guard<std::mutex> lock(cache.mutex);
+			GF2nModulusTest &entry = cache.tested[hash];
+			entry.modulus = modulus;
+			entry.irreducible = irreducible;
+
+			return irreducible;
+		}
+
+		GF2nIrreducibleTerms findIrreducible( const uint32 field_size )
+		{
+			if( field_size == 0 )
+				throw FieldSizeNotSupportedException(field_size);
+
+			// there is no trinomial of degree 1, x is the modulus of the table
+			if( field_size == 1 )
+			{
+				GF2nIrreducibleTerms terms;
+				std::fill(terms.exponents, terms.exponents + GF2N_IRRED_MAX_TERMS, -1);
+				terms.exponents[0] = 1;
+				return terms;
+			}
+
+			GF2nSparseCandidates candidates(field_size);
+			std::vector<GF2nIrreducibleTerms> block(GF2N_IRRED_SEARCH_BLOCK);
+			std::vector<char> irreducible(GF2N_IRRED_SEARCH_BLOCK);
+
+			// the first irreducible of a block in candidate order wins, so
+			// the result is the same for every number of workers
+			for( ;; )
+			{
+				size_t count = 0;
+				while( count < block.size() && candidates.next(block[count]) )
+					++count;
+
+				if( count == 0 )
+					throw FieldSizeNotSupportedException(field_size);
+
+				getDefaultExecutor()->parallelFor(count, 1,
+					[&]( const size_t begin, const size_t end, const uint32 worker ) {
+						for( size_t i=begin; i<end; ++i )
+							irreducible[i] = isIrreducible(block[i]);
+					});
+
+				for( size_t i=0; i<count; ++i )
+				{
+					if( irreducible[i] )
+						return block[i];
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,187 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/GF2nLimbPool.h"
+#include "../include/GF2nAlignedMemory.h"
+
+namespace libcumffa {
+
+	/**************************************************************************\
+
+						class GF2nHostSlabAllocator implementations
+
+	\**************************************************************************/
+
+	void *GF2nHostSlabAllocator::allocate( const size_t num_bytes )
+	{
+		return allocAligned(num_bytes);
+	}
+
+	void GF2nHostSlabAllocator::free( void *slab )
+	{
+		freeAligned(slab);
+	}
+
+	/**************************************************************************\
+
+						class GF2nLimbPool implementations
+
+	\**************************************************************************/
+
+	GF2nLimbPool::GF2nLimbPool( const size_t slot_bytes, const uint32 slots_per_slab, std::shared_ptr<GF2nSlabAllocatorInterface> allocator )
+		: m_slot_bytes(slot_bytes)
+		, m_slot_stride(alignToCacheLine(slot_bytes))
+		, m_slots_per_slab(slots_per_slab > 0 ? slots_per_slab : 1)
+		, m_allocator(allocator ? allocator : std::make_shared<GF2nHostSlabAllocator>())
+		, m_num_slabs(0)
+		, m_head(0)
+		, m_in_use(0)
+		, m_peak_in_use(0)
+	{
+	}
+
+	GF2nLimbPool::~GF2nLimbPool()
+	{
+		uint32 num_slabs = m_num_slabs.load();
+
+		for( uint32 i=0; i<num_slabs; ++i )
+			m_allocator->free(m_slabs[i].data);
+	}
+
+	uint32 GF2nLimbPool::get()
+	{
+		uint64 head = m_head.load(std::memory_order_acquire);
+
+		for( ;; )
+		{
+			uint32 top = static_cast<uint32>(head);
+
+			if( top == 0 )
+			{
+				grow();
+				head = m_head.load(std::memory_order_acquire);
+				continue;
+			}
+
+			// next may be stale if another thread took top in between,
+			// the tag lets the exchange fail in that case
+			uint32 slab = getSlabIndex(top - 1);
+			uint32 next = m_slabs[slab].next[top - 1 - getFirstSlot(slab)].load(std::memory_order_relaxed);
+			uint64 new_head = (((head >> 32) + 1) << 32) | next;
+
+			if( m_head.compare_exchange_weak(head, new_head, std::memory_order_acquire, std::memory_order_acquire) )
+			{
+				uint32 in_use = m_in_use.fetch_add(1, std::memory_order_relaxed) + 1;
+				uint32 peak = m_peak_in_use.load(std::memory_order_relaxed);
+
+				while( in_use > peak && !m_peak_in_use.compare_exchange_weak(peak, in_use, std::memory_order_relaxed) )
+					;
+
+				return top - 1;
+			}
+		}
+	}
+
+	void GF2nLimbPool::free( const uint32 slot )
+	{
+		uint32 slab = getSlabIndex(slot);
+		std::atomic<uint32> &next = m_slabs[slab].next[slot - getFirstSlot(slab)];
+		uint64 head = m_head.load(std::memory_order_relaxed);
+
+		do
+		{
+			next.store(static_cast<uint32>(head), std::memory_order_relaxed);
+		}
+		while( !m_head.compare_exchange_weak(head, (((head >> 32) + 1) << 32) | (slot + 1), std::memory_order_release, std::memory_order_relaxed) );
+
+		m_in_use.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	void *GF2nLimbPool::getData( const uint32 slot ) const
+	{
+		uint32 slab = getSlabIndex(slot);
+		return m_slabs[slab].data + (slot - getFirstSlot(slab)) * m_slot_stride;
+	}
+
+	size_t GF2nLimbPool::getSlotBytes() const
+	{
+		return m_slot_bytes;
+	}
+
+	GF2nLimbPoolStats GF2nLimbPool::getStats() const
+	{
+		GF2nLimbPoolStats stats;
+		stats.num_slabs = m_num_slabs.load();
+		stats.capacity = getFirstSlot(stats.num_slabs);
+		stats.in_use = m_in_use.load();
+		stats.peak_in_use = m_peak_in_use.load();
+
+		return stats;
+	}
+
+	void GF2nLimbPool::grow()
+	{
+		std::lock_guard<std::mutex> lock(m_grow_mutex);
+
+		// another thread may have grown the pool or freed slots
+		if( static_cast<uint32>(m_head.load(std::memory_order_acquire)) != 0 )
+			return;
+
+		uint32 num_slabs = m_num_slabs.load(std::memory_order_relaxed);
+
+		// slot + 1 has to fit into the lower half of m_head
+		if( num_slabs == MAX_SLABS || (static_cast<uint64>(m_slots_per_slab) << (num_slabs + 1)) >= 0xFFFFFFFFULL )
+			throw EmptyLimbPoolException();
+
+		uint32 first = getFirstSlot(num_slabs);
+		uint32 num_slots = m_slots_per_slab << num_slabs;
+
+		Slab &slab = m_slabs[num_slabs];
+		slab.next.reset(new std::atomic<uint32>[num_slots]);
+		slab.data = static_cast<char *>(m_allocator->allocate(m_slot_stride * num_slots));
+
+		// chain the new slots in ascending order and put the chain on
+		// top of the free list in one exchange
+		for( uint32 i=0; i+1<num_slots; ++i )
+			slab.next[i].store(first + i + 2, std::memory_order_relaxed);
+
+		m_num_slabs.store(num_slabs + 1, std::memory_order_release);
+
+		uint64 head = m_head.load(std::memory_order_relaxed);
+		do
+		{
+			slab.next[num_slots - 1].store(static_cast<uint32>(head), std::memory_order_relaxed);
+		}
+		while( !m_head.compare_exchange_weak(head, (((head >> 32) + 1) << 32) | (first + 1), std::memory_order_release, std::memory_order_relaxed) );
+	}
+
+	uint32 GF2nLimbPool::getSlabIndex( const uint32 slot ) const
+	{
+		// slab k starts at slot m_slots_per_slab * (2^k - 1)
+		uint32 x = slot / m_slots_per_slab + 1;
+		return 31 - static_cast<uint32>(__builtin_clz(x));
+	}
+
+	uint32 GF2nLimbPool::getFirstSlot( const uint32 slab ) const
+	{
+		return static_cast<uint32>((static_cast<uint64>(m_slots_per_slab) << slab) - m_slots_per_slab);
+	}
+}
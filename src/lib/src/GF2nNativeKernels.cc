@@ -0,0 +1,244 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/GF2nNativeKernels.h"
+#include "../include/GF2nFixed.h"
+#include <algorithm>
+#include <atomic>
+
+namespace libcumffa {
+	namespace native {
+
+		///////////////////////////////////////////////////////////////////////
+		/* cpu features */
+		static uint32 readCpuFeatures()
+		{
+			uint32 features = 0;
+
+#ifdef GF2N_NATIVE_X86
+			__builtin_cpu_init();
+
+			if( __builtin_cpu_supports("pclmul") )
+				features |= GF2N_CPU_PCLMUL;
+			if( __builtin_cpu_supports("sse4.1") )
+				features |= GF2N_CPU_SSE41;
+			if( __builtin_cpu_supports("avx2") )
+				features |= GF2N_CPU_AVX2;
+			if( __builtin_cpu_supports("avx512f") )
+				features |= GF2N_CPU_AVX512F;
+			if( __builtin_cpu_supports("vpclmulqdq") )
+				features |= GF2N_CPU_VPCLMUL;
+#endif
+
+			return features;
+		}
+
+		uint32 getCpuFeatures()
+		{
+			static const uint32 features = readCpuFeatures();
+			return features;
+		}
+
+		static std::atomic<int> isa_limit(GF2N_ISA_AVX512);
+
+		GF2nIsa getIsa()
+		{
+			const uint32 features = getCpuFeatures();
+			const uint32 pclmul = GF2N_CPU_PCLMUL | GF2N_CPU_SSE41;
+			const uint32 avx2 = pclmul | GF2N_CPU_AVX2;
+			const uint32 avx512 = avx2 | GF2N_CPU_AVX512F | GF2N_CPU_VPCLMUL;
+
+			GF2nIsa isa = GF2N_ISA_BASELINE;
+			if( (features & avx512) == avx512 )
+				isa = GF2N_ISA_AVX512;
+			else if( (features & avx2) == avx2 )
+				isa = GF2N_ISA_AVX2;
+			else if( (features & pclmul) == pclmul )
+				isa = GF2N_ISA_PCLMUL;
+
+			return static_cast<GF2nIsa>(std::min<int>(isa, isa_limit.load()));
+		}
+
+		void setIsaLimit( const GF2nIsa isa )
+		{
+			isa_limit.store(isa);
+		}
+
+		const char *getIsaName( const GF2nIsa isa )
+		{
+			switch( isa )
+			{
+			case GF2N_ISA_PCLMUL:
+				return "pclmul";
+			case GF2N_ISA_AVX2:
+				return "avx2";
+			case GF2N_ISA_AVX512:
+				return "avx512";
+			default:
+				return "baseline";
+			}
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		/* word kernels */
+		template<typename Clmul>
+		struct GF2nWordKernelsOf
+		{
+			static const GF2nWordKernels kernels;
+		};
+
+		template<typename Clmul>
+		const GF2nWordKernels GF2nWordKernelsOf<Clmul>::kernels = {
+			Clmul::isa,
+			&Clmul::product,
+			&Clmul::square
+		};
+
+		const GF2nWordKernels &getWordKernels( const GF2nIsa isa )
+		{
+#ifdef GF2N_NATIVE_X86
+			switch( isa )
+			{
+			case GF2N_ISA_AVX512:
+				return GF2nWordKernelsOf<GF2nClmulAvx512>::kernels;
+			case GF2N_ISA_AVX2:
+				return GF2nWordKernelsOf<GF2nClmulAvx2>::kernels;
+			case GF2N_ISA_PCLMUL:
+				return GF2nWordKernelsOf<GF2nClmulPclmul>::kernels;
+			default:
+				break;
+			}
+#endif
+			return GF2nWordKernelsOf<GF2nClmulBaseline>::kernels;
+		}
+
+		///////////////////////////////////////////////////////////////////////
+		/* limb kernels of the fixed field of degree N */
+		template<uint32 N, typename Clmul>
+		struct GF2nNistKernels
+		{
+			typedef GF2nFixed<N, Clmul> Element;
+			typedef typename Element::Modulus Modulus;
+
+			static void mul( const ufixn *a, const ufixn *b, ufixn *out )
+			{
+				(Element::fromLimbs(a) * Element::fromLimbs(b)).toLimbs(out);
+			}
+
+			static void exp( const ufixn *a, const uint32 value, ufixn *out )
+			{
+				Element::fromLimbs(a).exp(value).toLimbs(out);
+			}
+
+			static void inverse( const ufixn *a, ufixn *out )
+			{
+				Element::fromLimbs(a).inverse().toLimbs(out);
+			}
+
+			static bool matches( const std::vector<int> &irred_poly )
+			{
+				const int terms[] = {
+					static_cast<int>(Modulus::degree),
+					static_cast<int>(Modulus::k1),
+					static_cast<int>(Modulus::k2),
+					static_cast<int>(Modulus::k3),
+					0 };
+
+				size_t pos = 0;
+				for( uint32 i=0; i<sizeof(terms) / sizeof(terms[0]); ++i )
+				{
+					// unused middle terms are 0
+					if( i > 0 && i < 4 && terms[i] == 0 )
+						continue;
+
+					if( pos >= irred_poly.size() || irred_poly[pos] != terms[i] )
+						return false;
+					++pos;
+				}
+
+				return pos == irred_poly.size() || irred_poly[pos] == -1;
+			}
+
+			static const GF2nNativeField field;
+		};
+
+		template<uint32 N, typename Clmul>
+		const GF2nNativeField GF2nNistKernels<N, Clmul>::field = {
+			N,
+			Clmul::isa,
+			&GF2nNistKernels<N, Clmul>::mul,
+			&GF2nNistKernels<N, Clmul>::exp,
+			&GF2nNistKernels<N, Clmul>::inverse
+		};
+
+		///////////////////////////////////////////////////////////////////////
+		/* returns the kernels of degree N if their modulus is irred_poly */
+		template<uint32 N, typename Clmul>
+		const GF2nNativeField *findField( const std::vector<int> &irred_poly )
+		{
+			typedef GF2nNistKernels<N, Clmul> Kernels;
+			return Kernels::matches(irred_poly) ? &Kernels::field : NULL;
+		}
+
+		template<typename Clmul>
+		const GF2nNativeField *findField( const std::vector<int> &irred_poly )
+		{
+			switch( irred_poly[0] )
+			{
+			case 163:
+				return findField<163, Clmul>(irred_poly);
+			case 233:
+				return findField<233, Clmul>(irred_poly);
+			case 283:
+				return findField<283, Clmul>(irred_poly);
+			case 409:
+				return findField<409, Clmul>(irred_poly);
+			case 571:
+				return findField<571, Clmul>(irred_poly);
+			default:
+				return NULL;
+			}
+		}
+
+		const GF2nNativeField *findNativeField( const std::vector<int> &irred_poly, const GF2nIsa isa )
+		{
+			if( irred_poly.empty() )
+				return NULL;
+
+#ifdef GF2N_NATIVE_X86
+			switch( isa )
+			{
+			case GF2N_ISA_AVX512:
+				return findField<GF2nClmulAvx512>(irred_poly);
+			case GF2N_ISA_AVX2:
+				return findField<GF2nClmulAvx2>(irred_poly);
+			case GF2N_ISA_PCLMUL:
+				return findField<GF2nClmulPclmul>(irred_poly);
+			default:
+				break;
+			}
+#endif
+			// without the carry-less multiply instruction the
+			// multiplication of OpenSSL is faster
+			return NULL;
+		}
+	}
+}
@@ -0,0 +1,276 @@
+/*
+ * cubffa (CUda Binary Finite Field Arithmetic library) provides 
+ * functions for large binary galois field arithmetic on GPUs. 
+ * Besides CUDA it is also possible to extend cubffa to any other 
+ * underlying framework.
+ * Copyright (C) 2016  Dominik Stamm
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../include/GF2nPackedArray.h"
+#include <cstring>
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace libcumffa {
+
+	static const char GF2N_PACKED_ARRAY_MAGIC[8] = { 'G', 'F', '2', 'N', 'P', 'A', 'C', 'K' };
+	static const uint32 GF2N_PACKED_ARRAY_BYTE_ORDER = 0x01020304;
+
+	static_assert(sizeof(GF2nPackedArrayHeader) == 64, "the packed array header has to be 64 bytes");
+
+	/**************************************************************************\
+
+						class GF2nPackedArray implementations
+
+	\**************************************************************************/
+
+	GF2nPackedArray::GF2nPackedArray()
+		: m_mapping(NULL)
+		, m_mapped_bytes(0)
+		, m_writable(false)
+	{
+	}
+
+	GF2nPackedArray::GF2nPackedArray( GF2nPackedArray &&other )
+		: m_mapping(other.m_mapping)
+		, m_mapped_bytes(other.m_mapped_bytes)
+		, m_writable(other.m_writable)
+	{
+		other.m_mapping = NULL;
+		other.m_mapped_bytes = 0;
+		other.m_writable = false;
+	}
+
+	GF2nPackedArray &GF2nPackedArray::operator=( GF2nPackedArray &&other )
+	{
+		if( this != &other )
+		{
+			release();
+
+			m_mapping = other.m_mapping;
+			m_mapped_bytes = other.m_mapped_bytes;
+			m_writable = other.m_writable;
+
+			other.m_mapping = NULL;
+			other.m_mapped_bytes = 0;
+			other.m_writable = false;
+		}
+
+		return *this;
+	}
+
+	GF2nPackedArray::~GF2nPackedArray()
+	{
+		release();
+	}
+
+	GF2nPackedArray GF2nPackedArray::create( const std::string &path, GF2nArithmetic &arithmetic, const size_t count, const uint32 stride )
+	{
+		GF2nPackedArrayHeader header = makeHeader(arithmetic, count, stride);
+		size_t num_bytes = sizeof(GF2nPackedArrayHeader) + count * header.stride * sizeof(ufixn);
+
+		int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+		if( fd < 0 )
+			throw PackedArrayIOException(path, strerror(errno));
+
+		// the file grows as a sparse file, the limbs read as zero
+		if( ftruncate(fd, static_cast<off_t>(num_bytes)) != 0 )
+		{
+			int error = errno;
+			::close(fd);
+			throw PackedArrayIOException(path, strerror(error));
+		}
+
+		GF2nPackedArray res;
+		res.map(path, fd, num_bytes, true);
+		memcpy(res.m_mapping, &header, sizeof(header));
+
+		return res;
+	}
+
+	GF2nPackedArray GF2nPackedArray::open( const std::string &path, GF2nArithmetic &arithmetic, const GF2nPackedArrayAccess access )
+	{
+		bool writable = (access == GF2N_PACKED_READ_WRITE);
+
+		int fd = ::open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+		if( fd < 0 )
+			throw PackedArrayIOException(path, strerror(errno));
+
+		struct stat st;
+		if( fstat(fd, &st) != 0 )
+		{
+			int error = errno;
+			::close(fd);
+			throw PackedArrayIOException(path, strerror(error));
+		}
+
+		size_t num_bytes = static_cast<size_t>(st.st_size);
+		if( num_bytes < sizeof(GF2nPackedArrayHeader) )
+		{
+			::close(fd);
+			throw PackedArrayFormatException(path, "the file is too small for the header");
+		}
+
+		GF2nPackedArray res;
+		res.map(path, fd, num_bytes, writable);
+
+		const GF2nPackedArrayHeader &header = res.getHeader();
+		checkHeader(path, header, arithmetic);
+
+		if( header.header_bytes > num_bytes || (num_bytes - header.header_bytes) / sizeof(ufixn) / header.stride < header.count )
+			throw PackedArrayFormatException(path, "the file is truncated");
+
+		return res;
+	}
+
+	GF2nPackedArrayHeader GF2nPackedArray::makeHeader( GF2nArithmetic &arithmetic, const size_t count, const uint32 stride )
+	{
+		uint32 num_limbs = arithmetic.getNumLimbs();
+		uint32 element_stride = stride == 0 ? num_limbs : stride;
+
+		if( element_stride < num_limbs )
+			throw InvalidBatchStrideException();
+
+		GF2nPackedArrayHeader header;
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, GF2N_PACKED_ARRAY_MAGIC, sizeof(header.magic));
+		header.version = GF2N_PACKED_ARRAY_VERSION;
+		header.header_bytes = sizeof(GF2nPackedArrayHeader);
+		header.byte_order = GF2N_PACKED_ARRAY_BYTE_ORDER;
+		header.field_size = arithmetic.getFieldSize();
+		header.modulus_hash = arithmetic.getModulusHash();
+		header.limb_bits = sizeof(ufixn) * 8;
+		header.stride = element_stride;
+		header.count = count;
+
+		return header;
+	}
+
+	void GF2nPackedArray::checkHeader( const std::string &name, const GF2nPackedArrayHeader &header, GF2nArithmetic &arithmetic )
+	{
+		if( memcmp(header.magic, GF2N_PACKED_ARRAY_MAGIC, sizeof(header.magic)) != 0 )
+			throw PackedArrayFormatException(name, "no packed array");
+		if( header.version != GF2N_PACKED_ARRAY_VERSION || header.header_bytes < sizeof(GF2nPackedArrayHeader) )
+			throw PackedArrayFormatException(name, "unsupported version");
+		if( header.byte_order != GF2N_PACKED_ARRAY_BYTE_ORDER || header.limb_bits != sizeof(ufixn) * 8 )
+			throw PackedArrayFormatException(name, "the limbs have another width or byte order");
+		if( header.field_size != arithmetic.getFieldSize() || header.modulus_hash != arithmetic.getModulusHash() )
+			throw PackedArrayFormatException(name, "the elements belong to another field");
+		if( header.stride < arithmetic.getNumLimbs() )
+			throw PackedArrayFormatException(name, "the stride is smaller than the number of limbs");
+	}
+
+	const GF2nPackedArrayHeader &GF2nPackedArray::getHeader() const
+	{
+		return *static_cast<const GF2nPackedArrayHeader *>(m_mapping);
+	}
+
+	size_t GF2nPackedArray::getCount() const
+	{
+		return m_mapping ? static_cast<size_t>(getHeader().count) : 0;
+	}
+
+	uint32 GF2nPackedArray::getStride() const
+	{
+		return m_mapping ? getHeader().stride : 0;
+	}
+
+	bool GF2nPackedArray::isWritable() const
+	{
+		return m_writable;
+	}
+
+	const ufixn *GF2nPackedArray::getLimbs() const
+	{
+		if( m_mapping == NULL )
+			return NULL;
+
+		return reinterpret_cast<const ufixn *>(static_cast<const char *>(m_mapping) + getHeader().header_bytes);
+	}
+
+	ufixn *GF2nPackedArray::getLimbs()
+	{
+		return const_cast<ufixn *>(static_cast<const GF2nPackedArray *>(this)->getLimbs());
+	}
+
+	void GF2nPackedArray::prefetch( const size_t first, const size_t count )
+	{
+		adviseRange(first, count, MADV_WILLNEED);
+	}
+
+	void GF2nPackedArray::evict( const size_t first, const size_t count )
+	{
+		adviseRange(first, count, MADV_DONTNEED);
+	}
+
+	void GF2nPackedArray::sync()
+	{
+		if( m_mapping && m_writable )
+			msync(m_mapping, m_mapped_bytes, MS_SYNC);
+	}
+
+	void GF2nPackedArray::map( const std::string &path, const int fd, const size_t num_bytes, const bool writable )
+	{
+		int prot = writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+		void *ptr = mmap(NULL, num_bytes, prot, MAP_SHARED, fd, 0);
+		int error = errno;
+
+		// the mapping keeps the file open
+		::close(fd);
+
+		if( ptr == MAP_FAILED )
+			throw PackedArrayIOException(path, strerror(error));
+
+		// batches walk the elements from the front
+		madvise(ptr, num_bytes, MADV_SEQUENTIAL);
+
+		m_mapping = ptr;
+		m_mapped_bytes = num_bytes;
+		m_writable = writable;
+	}
+
+	void GF2nPackedArray::adviseRange( const size_t first, const size_t count, const int advice )
+	{
+		if( m_mapping == NULL || first >= getCount() )
+			return;
+
+		size_t num_elements = std::min(count, getCount() - first);
+		size_t element_bytes = getStride() * sizeof(ufixn);
+		size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+		// madvise takes page aligned ranges. Dropping a page of a shared
+		// file mapping never loses data, it is read again on the next access
+		size_t begin = getHeader().header_bytes + first * element_bytes;
+		size_t end = begin + num_elements * element_bytes;
+		begin &= ~(page_size - 1);
+
+		madvise(static_cast<char *>(m_mapping) + begin, end - begin, advice);
+	}
+
+	void GF2nPackedArray::release()
+	{
+		if( m_mapping == NULL )
+			return;
+
+		munmap(m_mapping, m_mapped_bytes);
+		m_mapping = NULL;
+	}
+}
@@ -1,9 +1,1844 @@
 #include "../include/GF2nArithmetic.h"
+#include "../include/GF2nArithmeticGraph.h"
+#include "../include/GF2nPackedArray.h"
+#include "../include/GF2nElementView.h"
+#include "../include/GF2nConversion.h"
+#include "../include/GF2nIrreducible.h"
+#include "../include/GF2nFieldCache.h"
+#include "../include/GF2nNativeKernels.h"
+#include "../include/GF2nFixed.h"
+#include "../include/GF2nLimbPool.h"
+#include "../include/GF2nExecutor.h"
+#include "../include/GF2nArena.h"
+#include "../include/GF2nInterop.h"
+#include "../cpu_code/include/GF2nArithmeticOpenSSL.h"
+#include <openssl/crypto.h>
 #include <iostream>
+#include <random>
+#include <cstring>
+#include <cctype>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <sstream>
+#include <future>
+#include <chrono>
+#include <stdexcept>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <fcntl.h>
 
 using namespace libcumffa;
 
-int main(int argc, char *argv[])
+///////////////////////////////////////////////////////////////////////////////
+/* checks */
+
+/* number of failed checks of the current run */
+static uint32 num_failures = 0;
+
+#define CHECK(cond) check((cond), #cond, __FILE__, __LINE__)
+
+void check( const bool ok, const char *what, const char *file, const int line )
+{
+	if( !ok )
+	{
+		++num_failures;
+		std::cerr << file << ":" << line << ": check failed: " << what << std::endl;
+	}
+}
+
+/* true if fun throws an E */
+template<typename E, typename F>
+bool throws( F fun )
+{
+	try
+	{
+		fun();
+	}
+	catch( E & )
+	{
+		return true;
+	}
+	catch( ... )
+	{
+		return false;
+	}
+
+	return false;
+}
+
+/* a random element of arithm */
+GF2nArithmeticElement randomElement( GF2nArithmetic &arithm, std::mt19937_64 &rng )
+{
+	uint32 num_limbs = arithm.getNumLimbs();
+	uint32 top_bits = arithm.getFieldSize() % (sizeof(ufixn) * 8);
+	std::vector<ufixn> limbs(num_limbs);
+
+	for( uint32 i=0; i<num_limbs; ++i )
+		limbs[i] = static_cast<ufixn>(rng());
+	if( top_bits != 0 )
+		limbs[num_limbs - 1] &= (static_cast<ufixn>(1) << top_bits) - 1;
+
+	return arithm.getElementFromLimbs(&limbs[0]);
+}
+
+bool equal( GF2nArithmeticElement lhs, GF2nArithmeticElement rhs )
+{
+	return lhs.toString() == rhs.toString();
+}
+
+/* a path in the temporary directory unique to this process */
+std::string tempPath( const std::string &name )
+{
+	const char *dir = getenv("TMPDIR");
+	std::stringstream ss;
+	ss << (dir != NULL ? dir : "/tmp") << "/cumffa_test_" << getpid() << "_" << name;
+	return ss.str();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* allocations of OpenSSL */
+
+/* the counts since the hooks were installed and the block that is watched */
+static std::atomic<uint64> crypto_allocs(0);
+static std::atomic<uint64> crypto_frees(0);
+static std::atomic<const void *> crypto_watched(NULL);
+static std::atomic<bool> crypto_watched_freed(false);
+static bool crypto_hooked = false;
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+static void *countingMalloc( size_t num_bytes, const char *file, int line )
+{
+	++crypto_allocs;
+	return malloc(num_bytes);
+}
+
+static void *countingRealloc( void *ptr, size_t num_bytes, const char *file, int line )
+{
+	++crypto_allocs;
+	return realloc(ptr, num_bytes);
+}
+
+static void countingFree( void *ptr, const char *file, int line )
+{
+	if( ptr != NULL )
+	{
+		++crypto_frees;
+		if( ptr == crypto_watched.load() )
+			crypto_watched_freed = true;
+	}
+	free(ptr);
+}
+#endif
+
+/* routes the allocations of OpenSSL through the counters, before its first allocation */
+void hookCryptoMemory()
+{
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+	crypto_hooked = CRYPTO_set_mem_functions(&countingMalloc, &countingRealloc, &countingFree) != 0;
+#endif
+}
+
+/* watches for the free of ptr, which has to come from OPENSSL_malloc */
+void watchCryptoFree( const void *ptr )
+{
+	crypto_watched_freed = false;
+	crypto_watched = ptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* GF2nArithmeticGraph */
+
+void testGraph()
+{
+	std::mt19937_64 rng(30);
+
+	for( uint32 field_size : {163, 1000} )
+	{
+		GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("OpenSSL", field_size);
+		GF2nArithmeticElement a = randomElement(arithm, rng);
+		GF2nArithmeticElement b = randomElement(arithm, rng);
+		GF2nArithmeticElement c = randomElement(arithm, rng);
+		GF2nArithmeticElement d = randomElement(arithm, rng);
+
+		// eager results of the formula below, the OpenSSL elements
+		// divide by multiplying with the inverse
+		GF2nArithmeticElement s = a * b;
+		GF2nArithmeticElement t = s + c + d + a;
+		GF2nArithmeticElement u = s.runWithValue("exp", 5);
+		GF2nArithmeticElement e = b + d;
+		GF2nArithmeticElement v = (t * u) * e.runWithValue("inverse", 0);
+		GF2nArithmeticElement w = s + u + v;
+
+		GF2nArithmeticGraph graph(arithm);
+		GF2nArithmeticElement ga = graph.input(a);
+		GF2nArithmeticElement gb = graph.input(b);
+		GF2nArithmeticElement gc = graph.input(c);
+		GF2nArithmeticElement gd = graph.input(d);
+
+		// s is shared by t, u and w, the additions of t are one chain
+		GF2nArithmeticElement gs = ga * gb;
+		GF2nArithmeticElement gt = gs + gc + gd + ga;
+		GF2nArithmeticElement gv, gw;
+		{
+			// the handle of u is dropped before execute()
+			GF2nArithmeticElement gu = gs.runWithValue("exp", 5);
+			gv = (gt * gu) / (gb + gd);
+			gw = gs + gu + gv;
+		}
+
+		// a long chain whose intermediate buffers are reused
+		GF2nArithmeticElement gx = ga;
+		GF2nArithmeticElement x = a;
+		for( uint32 i=0; i<20; ++i )
+		{
+			gx = gx * gb + gc;
+			x = x * b + c;
+		}
+
+		CHECK(throws<GraphNotExecutedException>([&]() { graph.getResult(gv); }));
+		CHECK(throws<InvalidGraphElementException>([&]() { graph.getResult(a); }));
+
+		graph.execute();
+
+		CHECK(equal(graph.getResult(gs), s));
+		CHECK(equal(graph.getResult(gt), t));
+		CHECK(equal(graph.getResult(gv), v));
+		CHECK(equal(graph.getResult(gw), w));
+		CHECK(equal(graph.getResult(gx), x));
+		CHECK(equal(graph.getResult(ga), a));
+		CHECK(gw.toString() == w.toString());
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* inverse */
+
+void testInverse()
+{
+	std::mt19937_64 rng(33);
+
+	// below and above the field limit of BN_GF2m_mod_inv
+	for( uint32 field_size : {163, 1000} )
+	{
+		GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("OpenSSL", field_size);
+		GF2nArithmeticElement one = arithm.getElementFromHex("1");
+
+		for( uint32 i=0; i<8; ++i )
+		{
+			GF2nArithmeticElement a = randomElement(arithm, rng);
+			CHECK(equal(a * a.runWithValue("inverse", 0), one));
+		}
+	}
+
+	// x + 1 divides the reducible x^n + 1 and has no inverse
+	for( uint32 field_size : {8, 1000} )
+	{
+		int irred_poly[] = {static_cast<int>(field_size), 0};
+
+		GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("OpenSSL", field_size);
+		arithm.setDummyParameters(field_size, static_cast<const void *>(irred_poly), 2);
+
+		GF2nArithmeticElement x = arithm.getElementFromHex("3");
+		GF2nArithmeticElement zero = arithm.getElementFromHex("0");
+		CHECK(equal(x.runWithValue("inverse", 0), zero));
+
+		std::vector<ufixn> limbs(arithm.getNumLimbs());
+		x.getLimbs(&limbs[0], arithm.getNumLimbs());
+		std::vector<ufixn> res(limbs.size(), 1);
+		arithm.runBatch(arithm.resolveOp("inverse"), &limbs[0], NULL, 0, &res[0], 1);
+		CHECK(std::count(res.begin(), res.end(), 0) == static_cast<long>(res.size()));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* hex and byte conversions */
+
+void testConversion()
+{
+	std::mt19937_64 rng(40);
+	const uint32 limb_bits = sizeof(ufixn) * 8;
+
+	for( uint32 num_bits : {1, 4, 63, 64, 65, 163, 571} )
+	{
+		uint32 num_limbs = (num_bits + limb_bits - 1) / limb_bits;
+		uint32 num_bytes = (num_bits + 7) / 8;
+		std::vector<ufixn> limbs(num_limbs), back(num_limbs);
+
+		for( uint32 round=0; round<16; ++round )
+		{
+			for( uint32 i=0; i<num_limbs; ++i )
+				limbs[i] = round == 0 ? 0 : static_cast<ufixn>(rng());
+			if( num_bits % limb_bits != 0 )
+				limbs[num_limbs - 1] &= (static_cast<ufixn>(1) << (num_bits % limb_bits)) - 1;
+
+			std::string hex = utils::limbsToHex(&limbs[0], num_limbs);
+			CHECK(round != 0 || hex == "0");
+			CHECK(hex.size() == 1 || hex[0] != '0');
+
+			std::string upper(hex);
+			for( size_t i=0; i<upper.size(); ++i )
+				upper[i] = static_cast<char>(toupper(upper[i]));
+
+			// with and without prefix, with leading zeros beyond the limbs
+			for( std::string text : {hex, "0x" + hex, "0X" + upper, "000" + hex, "0x" + std::string(40, '0') + hex} )
+			{
+				std::fill(back.begin(), back.end(), 1);
+				utils::hexToLimbs(text, &back[0], num_limbs, num_bits);
+				CHECK(back == limbs);
+			}
+
+			// exactly num_bytes and zero padded to more
+			for( GF2nByteOrder order : {GF2N_LITTLE_ENDIAN, GF2N_BIG_ENDIAN} )
+			{
+				for( uint32 size : {num_bytes, num_bytes + 5} )
+				{
+					std::vector<unsigned char> bytes(size, 0xff);
+					utils::limbsToBytes(&limbs[0], num_limbs, order, &bytes[0], size);
+
+					// the least significant byte and the most significant padding
+					unsigned char first = bytes[0], last = bytes[size - 1];
+					CHECK((order == GF2N_LITTLE_ENDIAN ? first : last) == static_cast<unsigned char>(limbs[0]));
+					CHECK(size == num_bytes || (order == GF2N_LITTLE_ENDIAN ? last : first) == 0);
+
+					std::fill(back.begin(), back.end(), 1);
+					utils::bytesToLimbs(&bytes[0], size, order, &back[0], num_limbs, num_bits);
+					CHECK(back == limbs);
+				}
+			}
+		}
+
+		// 2^num_bits is one bit too large
+		std::string too_large(1, "1248"[num_bits % 4]);
+		too_large += std::string(num_bits / 4, '0');
+		CHECK(throws<InvalidEncodingException>([&]() { utils::hexToLimbs(too_large, &back[0], num_limbs, num_bits); }));
+		CHECK(throws<InvalidEncodingException>([&]() { utils::hexToLimbs("1" + std::string(num_limbs * limb_bits / 4, '0'), &back[0], num_limbs, num_bits); }));
+
+		std::vector<unsigned char> bytes(num_bytes + 1, 0);
+		bytes[num_bits / 8] = static_cast<unsigned char>(1 << (num_bits % 8));
+		CHECK(throws<InvalidEncodingException>([&]() { utils::bytesToLimbs(&bytes[0], bytes.size(), GF2N_LITTLE_ENDIAN, &back[0], num_limbs, num_bits); }));
+		std::reverse(bytes.begin(), bytes.end());
+		CHECK(throws<InvalidEncodingException>([&]() { utils::bytesToLimbs(&bytes[0], bytes.size(), GF2N_BIG_ENDIAN, &back[0], num_limbs, num_bits); }));
+
+		// the top limb does not fit into fewer bytes
+		std::fill(limbs.begin(), limbs.end(), 0);
+		limbs[num_limbs - 1] = static_cast<ufixn>(1) << ((num_bits - 1) % limb_bits);
+		CHECK(throws<InvalidEncodingException>([&]() { utils::limbsToBytes(&limbs[0], num_limbs, GF2N_BIG_ENDIAN, &bytes[0], num_bytes - 1); }));
+	}
+
+	ufixn limb;
+	for( std::string text : {"", "0x", "12g4", "0x12 3", "-1", "0xx1"} )
+		CHECK(throws<InvalidEncodingException>([&]() { utils::hexToLimbs(text, &limb, 1, 64); }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* bulk import and export */
+
+void testBulkConversion()
+{
+	std::mt19937_64 rng(42);
+	const size_t count = 19;
+	const unsigned char gap = 0xa5;
+
+	// element sizes of 1, 16, 21, 52 and 72 bytes, most with a tail
+	// that is no multiple of 16 bytes
+	for( uint32 field_size : {8, 128, 163, 409, 571} )
+	{
+		GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("OpenSSL", field_size);
+		uint32 num_limbs = arithm.getNumLimbs();
+		size_t num_bytes = arithm.getNumBytes();
+		CHECK(num_bytes == (field_size + 7) / 8);
+
+		std::vector<GF2nArithmeticElement> expected;
+		for( size_t i=0; i<count; ++i )
+			expected.push_back(randomElement(arithm, rng));
+
+		for( GF2nByteOrder order : {GF2N_LITTLE_ENDIAN, GF2N_BIG_ENDIAN} )
+		{
+			for( size_t stride : {static_cast<size_t>(0), num_bytes + 7} )
+			{
+				size_t byte_stride = stride == 0 ? num_bytes : stride;
+				uint32 limb_stride = num_limbs + 1;
+
+				// the elements with gap bytes between them
+				std::vector<unsigned char> bytes(count * byte_stride, gap);
+				for( size_t i=0; i<count; ++i )
+				{
+					std::vector<ufixn> limbs(num_limbs);
+					expected[i].getLimbs(&limbs[0], num_limbs);
+					utils::limbsToBytes(&limbs[0], num_limbs, order, &bytes[i * byte_stride], num_bytes);
+				}
+
+				std::vector<GF2nArithmeticElement> elements;
+				arithm.getElements(&bytes[0], count, stride, order, elements);
+				CHECK(elements.size() == count);
+				for( size_t i=0; i<count && i<elements.size(); ++i )
+				{
+					CHECK(equal(elements[i], expected[i]));
+					CHECK(equal(arithm.getElementFromBytes(&bytes[i * byte_stride], num_bytes, order), expected[i]));
+				}
+
+				std::vector<unsigned char> values(count * byte_stride, gap);
+				arithm.getValues(elements, &values[0], stride, order);
+				CHECK(values == bytes);
+
+				// the limb after num_limbs is cleared
+				std::vector<ufixn> limbs(count * limb_stride, ~static_cast<ufixn>(0));
+				arithm.importBatch(&bytes[0], count, stride, order, &limbs[0], limb_stride);
+				for( size_t i=0; i<count; ++i )
+				{
+					CHECK(equal(arithm.getElementFromLimbs(&limbs[i * limb_stride]), expected[i]));
+					CHECK(limbs[i * limb_stride + num_limbs] == 0);
+				}
+
+				std::vector<unsigned char> exported(count * byte_stride, gap);
+				arithm.exportBatch(&limbs[0], count, limb_stride, &exported[0], stride, order);
+				CHECK(exported == bytes);
+			}
+		}
+
+		// 2^n fits into the bytes of a partial top byte, but not the field
+		if( field_size % 8 != 0 )
+		{
+			std::vector<unsigned char> too_large(num_bytes, 0);
+			too_large[field_size / 8] = static_cast<unsigned char>(1 << (field_size % 8));
+			std::vector<ufixn> limbs(num_limbs);
+			std::vector<GF2nArithmeticElement> elements;
+			CHECK(throws<InvalidEncodingException>([&]() { arithm.importBatch(&too_large[0], 1, 0, GF2N_LITTLE_ENDIAN, &limbs[0]); }));
+			CHECK(throws<InvalidEncodingException>([&]() { arithm.getElements(&too_large[0], 1, 0, GF2N_LITTLE_ENDIAN, elements); }));
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* irreducible polynomials */
+
+/* the product of two polynomials of num_limbs limbs, 2 * num_limbs limbs */
+std::vector<ufixn> polyMul( const std::vector<ufixn> &a, const std::vector<ufixn> &b )
+{
+	const uint32 limb_bits = sizeof(ufixn) * 8;
+	std::vector<ufixn> res(a.size() + b.size(), 0);
+
+	for( size_t i=0; i<a.size() * limb_bits; ++i )
+	{
+		if( !((a[i / limb_bits] >> (i % limb_bits)) & 1) )
+			continue;
+
+		// res ^= b * x^i
+		uint32 shift = i % limb_bits;
+		for( size_t j=0; j<b.size(); ++j )
+		{
+			res[i / limb_bits + j] ^= b[j] << shift;
+			if( shift != 0 )
+				res[i / limb_bits + j + 1] ^= b[j] >> (limb_bits - shift);
+		}
+	}
+
+	return res;
+}
+
+std::vector<ufixn> irreducibleLimbs( const uint32 degree, const uint32 num_limbs )
+{
+	std::vector<ufixn> limbs(num_limbs);
+	utils::getIrreducibleLimbs(degree, &limbs[0], num_limbs);
+	return limbs;
+}
+
+bool equalTerms( GF2nIrreducibleTerms const& lhs, GF2nIrreducibleTerms const& rhs )
+{
+	return std::equal(lhs.exponents, lhs.exponents + GF2N_IRRED_MAX_TERMS, rhs.exponents);
+}
+
+void testIrreducible()
+{
+	std::mt19937_64 rng(46);
+	const uint32 limb_bits = sizeof(ufixn) * 8;
+	const uint32 max_limbs = GF2N_IRRED_MAX_DEGREE / limb_bits + 1;
+
+	// the table is readable at compile time
+	static_assert(utils::getTableExponent(163, 0) == 163 && utils::getTableExponent(163, 1) == 7, "the table has to hold the NIST modulus of degree 163");
+	static_assert(utils::getTableExponent(233, 2) == 0 && utils::getTableExponent(233, 3) == -1, "the table has to hold the NIST modulus of degree 233");
+
+	// every modulus of the table in both forms
+	for( uint32 n=2; n<=GF2N_IRRED_MAX_DEGREE; ++n )
+	{
+		GF2nIrreducibleTerms terms = utils::getIrreducibleTerms(n);
+		CHECK(utils::isIrreducible(terms));
+		for( uint32 i=0; i<GF2N_IRRED_MAX_TERMS; ++i )
+			CHECK(terms.exponents[i] == utils::getTableExponent(n, i));
+
+		uint32 num_limbs = n / limb_bits + 1;
+		CHECK(utils::isIrreducible(&irreducibleLimbs(n, num_limbs)[0], num_limbs));
+	}
+
+	// zero limbs above the modulus do not matter
+	for( uint32 n : {2, 163, 1000} )
+		CHECK(utils::isIrreducible(&irreducibleLimbs(n, max_limbs + 1)[0], max_limbs + 1));
+
+	// products of two moduli of the table
+	for( uint32 i=0; i<40; ++i )
+	{
+		uint32 n1 = 2 + rng() % (GF2N_IRRED_MAX_DEGREE / 2 - 2);
+		uint32 n2 = 2 + rng() % (GF2N_IRRED_MAX_DEGREE / 2 - 2);
+		if( i == 0 )
+			n2 = n1;
+
+		std::vector<ufixn> product = polyMul(irreducibleLimbs(n1, max_limbs / 2 + 1), irreducibleLimbs(n2, max_limbs / 2 + 1));
+		CHECK(!utils::isIrreducible(&product[0], static_cast<uint32>(product.size())));
+	}
+
+	// by Swan's theorem every trinomial of a degree divisible by 8 is
+	// reducible
+	for( int32 n=8; n<=256; n+=8 )
+	{
+		for( int32 k=1; k<n; ++k )
+		{
+			GF2nIrreducibleTerms terms = {{n, k, 0, -1, -1}};
+			CHECK(!utils::isIrreducible(terms));
+
+			std::vector<ufixn> limbs(n / limb_bits + 1, 0);
+			for( int32 e : {n, k, 0} )
+				limbs[e / limb_bits] |= static_cast<ufixn>(1) << (e % limb_bits);
+			CHECK(!utils::isIrreducible(&limbs[0], static_cast<uint32>(limbs.size())));
+		}
+	}
+
+	// products of dense random polynomials
+	for( uint32 i=0; i<20; ++i )
+	{
+		std::vector<ufixn> factors[2];
+		for( std::vector<ufixn> &factor : factors )
+		{
+			uint32 degree = 1 + rng() % (GF2N_IRRED_MAX_DEGREE / 2);
+			factor.assign(degree / limb_bits + 1, 0);
+			for( ufixn &limb : factor )
+				limb = static_cast<ufixn>(rng());
+			if( (degree + 1) % limb_bits != 0 )
+				factor.back() &= (static_cast<ufixn>(1) << ((degree + 1) % limb_bits)) - 1;
+			factor.back() |= static_cast<ufixn>(1) << (degree % limb_bits);
+		}
+
+		std::vector<ufixn> product = polyMul(factors[0], factors[1]);
+		CHECK(!utils::isIrreducible(&product[0], static_cast<uint32>(product.size())));
+	}
+
+	// the search agrees with the table
+	for( uint32 n=2; n<=GF2N_IRRED_MAX_DEGREE; n += (n < 300 ? 1 : 97) )
+		CHECK(equalTerms(utils::findIrreducible(n), utils::getIrreducibleTerms(n)));
+	CHECK(equalTerms(utils::findIrreducible(GF2N_IRRED_MAX_DEGREE), utils::getIrreducibleTerms(GF2N_IRRED_MAX_DEGREE)));
+
+	// above the table, checked with an independent implementation of
+	// Rabin's test
+	const GF2nIrreducibleTerms above_table[] = {
+		{{2049, 124, 0, -1, -1}},
+		{{2050, 15, 13, 8, 0}},
+		{{2051, 13, 6, 5, 0}},
+		{{2052, 323, 0, -1, -1}},
+		{{2053, 21, 13, 6, 0}},
+		{{3000, 15, 12, 9, 0}}
+	};
+
+	for( GF2nIrreducibleTerms const& terms : above_table )
+	{
+		uint32 n = static_cast<uint32>(terms.exponents[0]);
+		CHECK(equalTerms(utils::findIrreducible(n), terms));
+		CHECK(equalTerms(utils::getIrreducibleTerms(n), terms));
+	}
+
+	CHECK(throws<FieldSizeNotSupportedException>([]() { utils::getIrreducibleTerms(0); }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* modulus validation */
+
+/* a dummy modulus of the given exponents */
+void setDummyModulus( GF2nArithmetic &arithm, std::vector<int> exponents )
+{
+	arithm.setDummyParameters(static_cast<uint32>(exponents[0]), static_cast<const void *>(&exponents[0]), static_cast<uint32>(exponents.size()));
+}
+
+void testModulusValidation()
+{
+	std::mt19937_64 rng(47);
+
+	// x^n + 1, trinomials of degrees divisible by 8 and the table
+	const std::vector<int> reducible[] = {{8, 0}, {16, 3, 0}, {1000, 1, 0}};
+	std::vector<int> irreducible[] = {{9, 4, 0}, {233, 74, 0}, {}};
+	utils::getIrreducibleExponents(1000, irreducible[2]);
+
+	for( std::vector<int> const& exponents : reducible )
+	{
+		GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("OpenSSL", 163);
+		setDummyModulus(arithm, exponents);
+		CHECK(!arithm.isModulusIrreducible());
+
+		arithm.setFlags(GF2N_FLAG_VALIDATE_MODULUS);
+		CHECK(throws<ReducibleModulusException>([&]() { setDummyModulus(arithm, exponents); }));
+	}
+
+	for( std::vector<int> const& exponents : irreducible )
+	{
+		GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("OpenSSL", 163);
+		arithm.setFlags(GF2N_FLAG_VALIDATE_MODULUS);
+		setDummyModulus(arithm, exponents);
+		CHECK(arithm.getFieldSize() == static_cast<uint32>(exponents[0]));
+		CHECK(arithm.isModulusIrreducible());
+	}
+
+	// a record of the field cache is only used for the modulus it holds,
+	// the dense moduli are not tested anywhere else in this process
+	GF2nFieldCache &cache = getFieldCache();
+	CHECK(cache.isOpen());
+
+	const uint32 degree = 300;
+	const uint32 num_words = degree / 64 + 1;
+	std::vector<uint64> moduli[2];
+	for( std::vector<uint64> &modulus : moduli )
+	{
+		std::vector<ufixn> factor(degree / 2 / (sizeof(ufixn) * 8) + 1);
+		for( ufixn &limb : factor )
+			limb = static_cast<ufixn>(rng());
+		factor[0] |= 1;
+		factor.back() &= (static_cast<ufixn>(1) << ((degree / 2) % (sizeof(ufixn) * 8))) - 1;
+		factor.back() |= static_cast<ufixn>(1) << ((degree / 2) % (sizeof(ufixn) * 8));
+
+		// the square of a degree 150 factor
+		std::vector<ufixn> square = polyMul(factor, factor);
+		modulus.assign(square.begin(), square.begin() + num_words);
+	}
+
+	for( uint32 i=0; i<2; ++i )
+	{
+		// claims that the modulus is irreducible, for the first one the
+		// record holds a modulus with another bit
+		std::vector<uint64> record(1, 1);
+		record.insert(record.end(), moduli[i].begin(), moduli[i].end());
+		if( i == 0 )
+			record[1] ^= 2;
+
+		uint64 hash = utils::hashLimbs(&moduli[i][0], degree + 1);
+		cache.insert(GF2N_FIELD_CACHE_IRREDUCIBLE, hash, &record[0], static_cast<uint32>(record.size() * sizeof(uint64)));
+	}
+
+	CHECK(!utils::isIrreducible(&moduli[0][0], num_words));
+	CHECK(utils::isIrreducible(&moduli[1][0], num_words));
+
+	// now both results come from the memory
+	CHECK(!utils::isIrreducible(&moduli[0][0], num_words));
+	CHECK(utils::isIrreducible(&moduli[1][0], num_words));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* GF2nFieldCache */
+
+bool cacheHolds( GF2nFieldCache &cache, const uint64 key, const std::string &data )
+{
+	uint32 num_bytes = 0;
+	const char *found = static_cast<const char *>(cache.find(GF2N_FIELD_CACHE_MODULUS, key, num_bytes));
+	return found != NULL && std::string(found, num_bytes) == data;
+}
+
+void testFieldCache()
+{
+	std::string path = tempPath("field.cache");
+	std::remove(path.c_str());
+
+	// a cache of its own, the one of the library may be in use
+	GF2nFieldCache cache;
+	cache.open(path);
+	CHECK(cache.isOpen());
+	cache.insert(GF2N_FIELD_CACHE_MODULUS, 1, "first", 5);
+	cache.insert(GF2N_FIELD_CACHE_MODULUS, 2, "second record", 13);
+	CHECK(cacheHolds(cache, 1, "first"));
+	CHECK(cacheHolds(cache, 2, "second record"));
+	cache.close();
+	CHECK(!cache.isOpen());
+
+	// reopened
+	cache.open(path);
+	CHECK(cacheHolds(cache, 1, "first"));
+	CHECK(cacheHolds(cache, 2, "second record"));
+	cache.close();
+
+	// a writer crashed in the middle of the last record
+	struct stat st;
+	CHECK(stat(path.c_str(), &st) == 0);
+	CHECK(truncate(path.c_str(), st.st_size - 3) == 0);
+
+	cache.open(path);
+	CHECK(cacheHolds(cache, 1, "first"));
+	CHECK(!cacheHolds(cache, 2, "second record"));
+	cache.insert(GF2N_FIELD_CACHE_MODULUS, 3, "third", 5);
+	CHECK(cacheHolds(cache, 3, "third"));
+	cache.close();
+
+	cache.open(path);
+	CHECK(cacheHolds(cache, 1, "first"));
+	CHECK(cacheHolds(cache, 3, "third"));
+	cache.close();
+
+	// a reader does not index while another process holds the file
+	// exclusively, which may cut it off or be in the middle of a record
+	{
+		GF2nFieldCache reader;
+		reader.open(path);
+
+		int fd = ::open(path.c_str(), O_RDWR | O_APPEND);
+		CHECK(fd >= 0);
+		CHECK(flock(fd, LOCK_EX) == 0);
+
+		std::atomic<bool> found(false), done(false);
+		std::thread lookup([&]() {
+			found = cacheHolds(reader, 4, "fourth");
+			done = true;
+		});
+
+		// half a record, cut off by the writer below
+		GF2nFieldCacheRecord record;
+		memset(&record, 0, sizeof(record));
+		record.key = 4;
+		record.kind = GF2N_FIELD_CACHE_MODULUS;
+		record.num_bytes = 6;
+		CHECK(write(fd, &record, sizeof(record) / 2) == static_cast<ssize_t>(sizeof(record) / 2));
+
+		usleep(100000);
+		CHECK(!done.load());
+		CHECK(flock(fd, LOCK_UN) == 0);
+		lookup.join();
+		::close(fd);
+		CHECK(!found.load());
+
+		// a writable open cuts the torn record off under the nose of the reader
+		GF2nFieldCache writer;
+		writer.open(path);
+		writer.insert(GF2N_FIELD_CACHE_MODULUS, 4, "fourth", 6);
+		CHECK(cacheHolds(reader, 4, "fourth"));
+		CHECK(cacheHolds(reader, 1, "first"));
+		CHECK(cacheHolds(reader, 3, "third"));
+	}
+
+	std::remove(path.c_str());
+
+	// the library has opened the file of the environment, a search
+	// above the table ends up in it
+	const uint32 degree = 2101;
+	GF2nIrreducibleTerms terms = utils::getIrreducibleTerms(degree);
+	CHECK(getFieldCache().isOpen());
+
+	cache.open(getenv(GF2N_FIELD_CACHE_ENV));
+	CHECK(cacheHolds(cache, degree, std::string(reinterpret_cast<const char *>(&terms), sizeof(terms))));
+	cache.close();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* native kernels of every instruction set */
+
+void testIsa()
+{
+	std::mt19937_64 rng(50);
+	const size_t count = 37;
+	const uint32 exponents[] = {0, 1, 2, 5, 0xffffffff};
+
+	for( uint32 field_size : {163, 233, 283, 409, 571} )
+	{
+		// the reference of the BIGNUM path without native kernels
+		native::setIsaLimit(native::GF2N_ISA_BASELINE);
+		GF2nArithmetic reference = GF2nArithmeticFactory::createInstance("OpenSSL", field_size);
+		uint32 num_limbs = reference.getNumLimbs();
+
+		std::vector<GF2nArithmeticElement> a, b, products, inverses;
+		std::vector<ufixn> limbs_a(count * num_limbs), limbs_b(count * num_limbs);
+		for( size_t i=0; i<count; ++i )
+		{
+			a.push_back(randomElement(reference, rng));
+			b.push_back(i == 0 ? reference.getElementFromHex("0") : randomElement(reference, rng));
+			a[i].getLimbs(&limbs_a[i * num_limbs], num_limbs);
+			b[i].getLimbs(&limbs_b[i * num_limbs], num_limbs);
+			products.push_back(a[i] * b[i]);
+			inverses.push_back(b[i].runWithValue("inverse", 0));
+		}
+
+		for( int isa=native::GF2N_ISA_BASELINE; isa<=native::GF2N_ISA_AVX512; ++isa )
+		{
+			native::setIsaLimit(static_cast<native::GF2nIsa>(isa));
+			GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("OpenSSL", field_size);
+			std::vector<ufixn> out(count * num_limbs);
+
+			arithm.mulBatch(&limbs_a[0], &limbs_b[0], &out[0], count);
+			for( size_t i=0; i<count; ++i )
+			{
+				CHECK(equal(arithm.getElementFromLimbs(&out[i * num_limbs]), products[i]));
+				CHECK(equal(arithm.getElementFromLimbs(&limbs_a[i * num_limbs]) * arithm.getElementFromLimbs(&limbs_b[i * num_limbs]), products[i]));
+			}
+
+			for( uint32 k : exponents )
+			{
+				arithm.expBatch(&limbs_a[0], k, &out[0], count);
+				for( size_t i=0; i<count; ++i )
+				{
+					GF2nArithmeticElement power = a[i].runWithValue("exp", k);
+					GF2nArithmeticElement x = arithm.getElementFromLimbs(&limbs_a[i * num_limbs]);
+					CHECK(equal(arithm.getElementFromLimbs(&out[i * num_limbs]), power));
+					CHECK(equal(x.runWithValue("exp", k), power));
+				}
+			}
+
+			// b[0] = 0 has no inverse
+			arithm.runBatch(arithm.resolveOp("inverse"), &limbs_b[0], NULL, 0, &out[0], count);
+			for( size_t i=0; i<count; ++i )
+			{
+				GF2nArithmeticElement x = arithm.getElementFromLimbs(&limbs_b[i * num_limbs]);
+				CHECK(equal(arithm.getElementFromLimbs(&out[i * num_limbs]), inverses[i]));
+				CHECK(equal(x.runWithValue("inverse", 0), inverses[i]));
+			}
+		}
+	}
+
+	native::setIsaLimit(native::GF2N_ISA_AVX512);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* GF2nFixed */
+
+/* GF2nFixed<N, Clmul> against the elements of the OpenSSL backend */
+template<uint32 N, typename Clmul>
+void testFixedField( GF2nArithmetic &arithm, std::mt19937_64 &rng )
+{
+	typedef GF2nFixed<N, Clmul> Fixed;
+	const uint32 exponents[] = {0, 1, 2, 5, 0xffffffff};
+
+	CHECK(arithm.getNumLimbs() == Fixed::num_limbs);
+
+	for( uint32 i=0; i<8; ++i )
+	{
+		GF2nArithmeticElement a = i == 0 ? arithm.getElementFromHex("0") : randomElement(arithm, rng);
+		GF2nArithmeticElement b = randomElement(arithm, rng);
+		Fixed x = Fixed::fromElement(a);
+		Fixed y = Fixed::fromElement(b);
+
+		CHECK(equal(x.toElement(arithm), a));
+		CHECK(equal((x * y).toElement(arithm), a * b));
+		CHECK(equal((x + y).toElement(arithm), a + b));
+		CHECK(equal(x.sqr().toElement(arithm), a * a));
+		CHECK(x.sqr() == x * x);
+
+		for( uint32 k : exponents )
+		{
+			GF2nArithmeticElement power = a.runWithValue("exp", k);
+			CHECK(equal(x.exp(k).toElement(arithm), power));
+		}
+
+		// 0 has no inverse and both return 0
+		GF2nArithmeticElement inverse = a.runWithValue("inverse", 0);
+		CHECK(equal(x.inverse().toElement(arithm), inverse));
+	}
+}
+
+template<uint32 N>
+void testFixedField( std::mt19937_64 &rng )
+{
+	GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("OpenSSL", N);
+
+	testFixedField<N, native::GF2nClmulHost>(arithm, rng);
+	testFixedField<N, native::GF2nClmulBaseline>(arithm, rng);
+
+#ifdef GF2N_NATIVE_X86
+	const uint32 features = native::getCpuFeatures();
+	const uint32 pclmul = native::GF2N_CPU_PCLMUL | native::GF2N_CPU_SSE41;
+	const uint32 avx2 = pclmul | native::GF2N_CPU_AVX2;
+	const uint32 avx512 = avx2 | native::GF2N_CPU_AVX512F | native::GF2N_CPU_VPCLMUL;
+
+	if( (features & pclmul) == pclmul )
+		testFixedField<N, native::GF2nClmulPclmul>(arithm, rng);
+	if( (features & avx2) == avx2 )
+		testFixedField<N, native::GF2nClmulAvx2>(arithm, rng);
+	if( (features & avx512) == avx512 )
+		testFixedField<N, native::GF2nClmulAvx512>(arithm, rng);
+#endif
+}
+
+void testFixed()
+{
+	std::mt19937_64 rng(31);
+
+	// the moduli come from the irreducible table
+	static_assert(GF2nFixedModulus<163>::k1 == 7 && GF2nFixedModulus<163>::k2 == 6 && GF2nFixedModulus<163>::k3 == 3, "modulus of degree 163");
+	static_assert(GF2nFixedModulus<233>::k1 == 74 && GF2nFixedModulus<233>::k2 == 0 && GF2nFixedModulus<233>::k3 == 0, "modulus of degree 233");
+	static_assert(GF2nFixedModulus<2047>::k1 == 3 && GF2nFixedModulus<2047>::k2 == 0, "modulus of degree 2047");
+
+	testFixedField<163>(rng);
+	testFixedField<233>(rng);
+	testFixedField<283>(rng);
+	testFixedField<409>(rng);
+	testFixedField<571>(rng);
+	// no native kernel and beyond the field limit of BN_GF2m_mod_inv
+	testFixedField<2047>(rng);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* GF2nExecutor */
+
+/* runs the tiles in order on the calling thread and counts the calls */
+class SerialExecutor : public GF2nExecutorInterface
+{
+public:
+	SerialExecutor() : num_tiles(0), num_tasks(0) {}
+
+	virtual uint32 getNumWorkers()
+	{
+		return 3;
+	}
+
+	virtual void parallelFor( const size_t count, const size_t tile_size, const GF2nTileFunction &fun )
+	{
+		size_t tile = (tile_size == 0) ? count : tile_size;
+		for( size_t begin=0; begin<count; begin+=tile )
+			fun(begin, std::min(count, begin + tile), static_cast<uint32>(num_tiles++ % getNumWorkers()));
+	}
+
+	virtual void post( const GF2nTaskFunction &task )
+	{
+		task(static_cast<uint32>(num_tasks++ % getNumWorkers()));
+	}
+
+	size_t num_tiles;
+	size_t num_tasks;
+};
+
+/* true if every index of [0, count) was visited exactly once */
+bool coveredOnce( const std::vector<std::atomic<uint32> > &visits )
+{
+	for( size_t i=0; i<visits.size(); ++i )
+		if( visits[i].load() != 1 )
+			return false;
+
+	return true;
+}
+
+void testExecutor()
+{
+	const uint32 num_workers = 4;
+	GF2nWorkStealingExecutor executor(num_workers);
+
+	// every index is in exactly one tile and tiles are not larger than asked
+	for( size_t count : {1, 7, 1000, 1001} )
+	{
+		for( size_t tile_size : {0, 1, 7, 64, 5000} )
+		{
+			std::vector<std::atomic<uint32> > visits(count);
+			std::atomic<bool> tiles_ok(true);
+
+			executor.parallelFor(count, tile_size, [&]( const size_t begin, const size_t end, const uint32 worker ) {
+				if( begin >= end || end > count || worker >= num_workers || (tile_size != 0 && end - begin > tile_size) )
+					tiles_ok = false;
+				for( size_t i=begin; i<end && i<count; ++i )
+					++visits[i];
+			});
+
+			CHECK(tiles_ok.load());
+			CHECK(coveredOnce(visits));
+		}
+	}
+
+	bool called = false;
+	executor.parallelFor(0, 1, [&]( const size_t begin, const size_t end, const uint32 worker ) { called = true; });
+	CHECK(!called);
+
+	// an exception of a tile reaches the caller after all tiles are done,
+	// the executor keeps working
+	{
+		std::atomic<size_t> num_done(0);
+		CHECK(throws<std::runtime_error>([&]() {
+			executor.parallelFor(100, 3, [&]( const size_t begin, const size_t end, const uint32 worker ) {
+				if( begin <= 50 && 50 < end )
+					throw std::runtime_error("tile");
+				num_done += end - begin;
+			});
+		}));
+		CHECK(num_done.load() == 97);
+
+		std::vector<std::atomic<uint32> > visits(100);
+		executor.parallelFor(100, 3, [&]( const size_t begin, const size_t end, const uint32 worker ) {
+			for( size_t i=begin; i<end; ++i )
+				++visits[i];
+		});
+		CHECK(coveredOnce(visits));
+	}
+
+	// a parallelFor of a worker runs on that worker instead of waiting for the pool
+	{
+		const size_t count = 500;
+		std::vector<std::atomic<uint32> > visits(count);
+		std::atomic<bool> same_worker(true);
+		std::promise<void> done;
+
+		executor.post([&]( const uint32 outer ) {
+			try
+			{
+				executor.parallelFor(count, 10, [&]( const size_t begin, const size_t end, const uint32 worker ) {
+					if( worker != outer )
+						same_worker = false;
+					for( size_t i=begin; i<end; ++i )
+						++visits[i];
+				});
+				done.set_value();
+			}
+			catch( ... )
+			{
+				done.set_exception(std::current_exception());
+			}
+		});
+
+		std::future<void> finished = done.get_future();
+		CHECK(finished.wait_for(std::chrono::seconds(30)) == std::future_status::ready);
+		CHECK(same_worker.load());
+		CHECK(coveredOnce(visits));
+	}
+
+	// the tile size of the cache is the same on every thread
+	{
+		size_t tile_size = calcCacheTileSize(64);
+		std::atomic<bool> same(true);
+		std::vector<std::thread> threads;
+
+		for( uint32 t=0; t<4; ++t )
+			threads.push_back(std::thread([&]() {
+				if( calcCacheTileSize(64) != tile_size )
+					same = false;
+			}));
+		for( uint32 t=0; t<threads.size(); ++t )
+			threads[t].join();
+
+		CHECK(same.load());
+		CHECK(tile_size >= 1);
+	}
+
+	// batches run on a custom executor give the result of the calling thread
+	{
+		std::mt19937_64 rng(28);
+		GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("OpenSSL", 571);
+		uint32 num_limbs = arithm.getNumLimbs();
+		size_t count = 3 * calcCacheTileSize(7 * num_limbs * sizeof(ufixn)) + 5;
+
+		std::vector<ufixn> a(count * num_limbs), b(count * num_limbs);
+		for( size_t i=0; i<a.size(); ++i )
+		{
+			a[i] = static_cast<ufixn>(rng());
+			b[i] = static_cast<ufixn>(rng());
+		}
+		for( size_t i=0; i<count; ++i )
+		{
+			a[(i + 1) * num_limbs - 1] &= 0x7FFFFFF;
+			b[(i + 1) * num_limbs - 1] &= 0x7FFFFFF;
+		}
+
+		std::vector<ufixn> expected(count * num_limbs), out(count * num_limbs);
+		arithm.setExecutor(std::shared_ptr<GF2nExecutorInterface>());
+		arithm.mulBatch(&a[0], &b[0], &expected[0], count);
+
+		std::shared_ptr<SerialExecutor> serial(new SerialExecutor());
+		arithm.setExecutor(serial);
+		CHECK(arithm.getExecutor() == serial);
+		arithm.mulBatch(&a[0], &b[0], &out[0], count);
+
+		CHECK(serial->num_tiles > 1);
+		CHECK(out == expected);
+
+		GF2nArithmeticElement x = arithm.getElementFromLimbs(&a[0]);
+		GF2nArithmeticElement y = arithm.getElementFromLimbs(&b[0]);
+		arithm.setFlags(GF2N_FLAG_ASYNC);
+		std::future<GF2nArithmeticElement> product = arithm.submit(GF2nArithmeticOp(GF2N_OP_MUL), x, y);
+		CHECK(serial->num_tasks == 1);
+		CHECK(equal(product.get(), x * y));
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* asynchronous operations */
+
+void testAsync()
+{
+	std::mt19937_64 rng(29);
+	GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("OpenSSL", 163);
+	uint32 num_limbs = arithm.getNumLimbs();
+
+	// one tile and many tiles of the default executor
+	for( size_t count : {static_cast<size_t>(5), 3 * calcCacheTileSize(7 * num_limbs * sizeof(ufixn)) + 5} )
+	{
+		std::vector<ufixn> a(count * num_limbs), b(count * num_limbs);
+		for( size_t i=0; i<count; ++i )
+		{
+			randomElement(arithm, rng).getLimbs(&a[i * num_limbs], num_limbs);
+			randomElement(arithm, rng).getLimbs(&b[i * num_limbs], num_limbs);
+		}
+
+		std::vector<ufixn> sync_mul(a.size()), sync_exp(a.size());
+		arithm.setFlags(0);
+		arithm.mulBatch(&a[0], &b[0], &sync_mul[0], count);
+		arithm.expBatch(&a[0], 5, &sync_exp[0], count);
+
+		arithm.setFlags(GF2N_FLAG_ASYNC);
+		std::vector<ufixn> async_mul(a.size()), async_exp(a.size());
+		std::future<void> mul_done = arithm.submitBatch(GF2nArithmeticOp(GF2N_OP_MUL), &a[0], &b[0], 0, &async_mul[0], count);
+		std::future<void> exp_done = arithm.submitBatch(GF2nArithmeticOp(GF2N_OP_EXP), &a[0], NULL, 5, &async_exp[0], count);
+		mul_done.get();
+		exp_done.get();
+
+		CHECK(async_mul == sync_mul);
+		CHECK(async_exp == sync_exp);
+
+		// the batch interface has no division, every tile throws
+		std::vector<ufixn> out(a.size());
+		std::future<void> failed = arithm.submitBatch(GF2nArithmeticOp(GF2N_OP_DIV), &a[0], &b[0], 0, &out[0], count);
+		CHECK(throws<std::exception>([&]() { failed.get(); }));
+	}
+
+	// single operations, posted and run on the calling thread
+	for( int flags : {0, static_cast<int>(GF2N_FLAG_ASYNC)} )
+	{
+		arithm.setFlags(static_cast<unsigned char>(flags));
+
+		GF2nArithmeticElement x = randomElement(arithm, rng);
+		GF2nArithmeticElement y = randomElement(arithm, rng);
+		std::future<GF2nArithmeticElement> product = arithm.submit(GF2nArithmeticOp(GF2N_OP_MUL), x, y);
+		std::future<GF2nArithmeticElement> power = arithm.submit(GF2nArithmeticOp(GF2N_OP_EXP), x, 5);
+		GF2nArithmeticElement expected_power = x.runWithValue("exp", 5);
+
+		CHECK(equal(product.get(), x * y));
+		CHECK(equal(power.get(), expected_power));
+
+		std::future<GF2nArithmeticElement> failed = arithm.submit(GF2nArithmeticOp(GF2N_OP_DIV), x, 5);
+		CHECK(throws<std::exception>([&]() { failed.get(); }));
+	}
+
+	arithm.setFlags(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* GF2nArena */
+
+/* true if ptr lies in the used bytes of a fresh or reset arena with one block */
+bool inFirstBlock( const void *first, const void *ptr, const size_t block_size )
+{
+	const char *begin = static_cast<const char *>(first);
+	const char *p = static_cast<const char *>(ptr);
+
+	return p >= begin && p < begin + block_size;
+}
+
+void testArena()
+{
+	const size_t block_size = 1024;
+	GF2nArena arena(block_size);
+	GF2nArena inner(block_size);
+
+	// outside of a scope memory comes from the heap
+	CHECK(getThreadArena() == NULL);
+	void *heap = allocElementMemory(40);
+	CHECK(arena.getUsedBytes() == 0 && arena.getReservedBytes() == 0);
+	CHECK(reinterpret_cast<uintptr_t>(heap) % 16 == 0);
+	std::memset(heap, 0xAB, 40);
+
+	const void *first = NULL;
+	{
+		GF2nArenaScope scope(arena);
+		CHECK(getThreadArena() == &arena);
+
+		// every allocation has a header of 16 bytes and is 16 byte aligned
+		void *a = allocElementMemory(40);
+		first = a;
+		CHECK(arena.getUsedBytes() == 16 + 48);
+		CHECK(reinterpret_cast<uintptr_t>(a) % 16 == 0);
+
+		void *b = allocElementMemory(1);
+		CHECK(arena.getUsedBytes() == 16 + 48 + 32);
+		CHECK(inFirstBlock(first, b, block_size));
+
+		// arena memory is only given back by reset
+		freeElementMemory(b);
+		CHECK(arena.getUsedBytes() == 16 + 48 + 32);
+
+		// the heap block of before the scope goes back to the heap
+		freeElementMemory(heap);
+		CHECK(arena.getUsedBytes() == 16 + 48 + 32);
+
+		// nested scopes bind the inner arena until they end
+		{
+			GF2nArenaScope nested(inner);
+			CHECK(getThreadArena() == &inner);
+			allocElementMemory(100);
+			CHECK(inner.getUsedBytes() == 16 + 112);
+			CHECK(arena.getUsedBytes() == 16 + 48 + 32);
+
+			// other threads are not bound to any arena
+			std::atomic<bool> unbound(false);
+			std::thread other([&]() {
+				unbound = getThreadArena() == NULL;
+				freeElementMemory(allocElementMemory(8));
+			});
+			other.join();
+			CHECK(unbound.load());
+			CHECK(inner.getUsedBytes() == 16 + 112);
+		}
+		CHECK(getThreadArena() == &arena);
+
+		// an allocation larger than a block gets a block of its own
+		allocElementMemory(2 * block_size);
+		CHECK(arena.getReservedBytes() == block_size + 2 * block_size + 16);
+		CHECK(arena.getUsedBytes() == block_size + 2 * block_size + 16);
+	}
+	CHECK(getThreadArena() == NULL);
+
+	// reset keeps the blocks and starts at the first block again
+	size_t reserved = arena.getReservedBytes();
+	arena.reset();
+	CHECK(arena.getUsedBytes() == 0);
+	CHECK(arena.getReservedBytes() == reserved);
+	{
+		GF2nArenaScope scope(arena);
+		CHECK(allocElementMemory(40) == first);
+	}
+	CHECK(arena.getReservedBytes() == reserved);
+	arena.reset();
+
+	// elements created in a scope live in the arena and give the same results
+	std::mt19937_64 rng(35);
+	GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("OpenSSL", 163);
+	GF2nArithmeticElement x = randomElement(arithm, rng);
+	GF2nArithmeticElement y = randomElement(arithm, rng);
+	std::string expected = GF2nArithmeticElement(x * y).toString();
+
+	for( uint32 round=0; round<3; ++round )
+	{
+		{
+			GF2nArenaScope scope(arena);
+			GF2nArithmeticElement product = x * y;
+			CHECK(product.toString() == expected);
+			CHECK(arena.getUsedBytes() > 0);
+		}
+		arena.reset();
+	}
+
+	// an element of the heap can be dropped inside a scope
+	{
+		GF2nArithmeticElement sum = x + y;
+		GF2nArenaScope scope(arena);
+		sum = x * y;
+		CHECK(sum.toString() == expected);
+	}
+	arena.reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* GF2nInterop */
+
+/* a backend other than OpenSSL, every call goes to an OpenSSL backend */
+class ForwardingBackend : public GF2nArithmeticInterface
+{
+public:
+	explicit ForwardingBackend( const uint32 field_size )
+		: m_arithm(GF2nArithmeticFactory::createInstance("OpenSSL", field_size))
+		, m_backend(m_arithm.getBackend())
+		{}
+
+	void setFieldSize( const uint32 field_size ) { m_backend->setFieldSize(field_size); }
+	void setDummyParameters( const uint32 field_size, const std::string irred_poly ) { m_backend->setDummyParameters(field_size, irred_poly); }
+	void setDummyParameters( const uint32 field_size, const unsigned char *irred_poly, const uint32 chunks_irred_poly ) { m_backend->setDummyParameters(field_size, irred_poly, chunks_irred_poly); }
+	void setDummyParameters( const uint32 field_size, const void *irred_poly, const uint32 chunks_irred_poly ) { m_backend->setDummyParameters(field_size, irred_poly, chunks_irred_poly); }
+	void setFlags( const unsigned char flags ) { m_backend->setFlags(flags); }
+	bool isAsync() { return m_backend->isAsync(); }
+	int32 resolveOp( const std::string &what ) { return m_backend->resolveOp(what); }
+	uint32 getFieldSize() { return m_backend->getFieldSize(); }
+	void getModulus( std::vector<ufixn> &limbs ) { m_backend->getModulus(limbs); }
+	uint32 getNumLimbs() { return m_backend->getNumLimbs(); }
+	size_t getBatchTileSize() { return m_backend->getBatchTileSize(); }
+	void setNumWorkers( const uint32 num_workers ) { m_backend->setNumWorkers(num_workers); }
+	void runBatch( const int32 op, const ufixn *a, const ufixn *b, const uint32 value, ufixn *out, const size_t count, const uint32 stride, const uint32 worker ) { m_backend->runBatch(op, a, b, value, out, count, stride, worker); }
+	GF2nArithmeticElement getElement( const std::string value ) { return m_backend->getElement(value); }
+	GF2nArithmeticElement getElement( const unsigned char *value, const uint32 chunks_value ) { return m_backend->getElement(value, chunks_value); }
+	GF2nArithmeticElement getElement( const void *value, const uint32 chunks_value ) { return m_backend->getElement(value, chunks_value); }
+	GF2nArithmeticElement getElementFromLimbs( const ufixn *limbs ) { return m_backend->getElementFromLimbs(limbs); }
+
+private:
+	GF2nArithmetic m_arithm;
+	GF2nArithmeticInterface *m_backend;
+};
+
+/* a BIGNUM of OPENSSL_malloc with the bits of element */
+BIGNUM *toBN( GF2nArithmeticElement &element )
+{
+	BIGNUM *value = BN_new();
+	interop::copyTo(element, value);
+	return value;
+}
+
+void testInterop()
+{
+	const uint32 field_size = 163;
+	const uint32 limb_bits = sizeof(ufixn) * 8;
+	std::mt19937_64 rng(43);
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+	CHECK(crypto_hooked);
+#endif
+
+	GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("OpenSSL", field_size);
+	GF2nArithmetic forwarding("Forwarding", new ForwardingBackend(field_size));
+	uint32 num_limbs = arithm.getNumLimbs();
+
+	// an element with the top limb set and one that fits into the lowest limb
+	GF2nArithmeticElement full = arithm.getElementFromHex("4" + std::string((field_size - 1) / 4, '0'));
+	GF2nArithmeticElement small = arithm.getElementFromHex("1234");
+	std::vector<ufixn> limbs(num_limbs);
+	full.getLimbs(&limbs[0], num_limbs);
+	CHECK(limbs[num_limbs - 1] != 0);
+
+	// mpz_t is borrowed if its words cover all limbs, else copied
+	{
+		mpz_t value;
+		mpz_init(value);
+
+		interop::copyTo(full, value);
+		GF2nLimbView view = interop::viewOf(value, num_limbs);
+		CHECK(view.isBorrowed() == (sizeof(mp_limb_t) == sizeof(ufixn)));
+		CHECK(view.getNumLimbs() == num_limbs);
+		CHECK(std::equal(limbs.begin(), limbs.end(), view.get()));
+		if( view.isBorrowed() )
+			CHECK(view.get() == reinterpret_cast<const ufixn *>(mpz_limbs_read(value)));
+		CHECK(equal(interop::getElement(arithm, value), full));
+
+		interop::copyTo(small, value);
+		view = interop::viewOf(value, num_limbs);
+		CHECK(!view.isBorrowed());
+		CHECK(view.get()[0] == 0x1234);
+		CHECK(std::count(view.get() + 1, view.get() + num_limbs, 0) == static_cast<long>(num_limbs - 1));
+		CHECK(equal(interop::getElement(arithm, value), small));
+
+		// too many words or bits above the field
+		mpz_set_ui(value, 1);
+		mpz_mul_2exp(value, value, num_limbs * limb_bits);
+		CHECK(throws<InvalidEncodingException>([&]() { interop::viewOf(value, num_limbs); }));
+		mpz_set_ui(value, 1);
+		mpz_mul_2exp(value, value, field_size);
+		CHECK(throws<InvalidEncodingException>([&]() { interop::getElement(arithm, value); }));
+
+		mpz_clear(value);
+	}
+
+	// BIGNUM is opaque and always copied
+	{
+		BIGNUM *value = toBN(full);
+		GF2nLimbView view = interop::viewOf(value, num_limbs);
+		CHECK(!view.isBorrowed());
+		CHECK(std::equal(limbs.begin(), limbs.end(), view.get()));
+		CHECK(equal(interop::getElement(arithm, value), full));
+		CHECK(equal(interop::getElement(forwarding, value), full));
+
+		BN_zero(value);
+		BN_set_bit(value, num_limbs * limb_bits);
+		CHECK(throws<InvalidEncodingException>([&]() { interop::viewOf(value, num_limbs); }));
+		BN_zero(value);
+		BN_set_bit(value, field_size);
+		CHECK(throws<InvalidEncodingException>([&]() { interop::getElement(arithm, value); }));
+		BN_free(value);
+	}
+
+	// the OpenSSL backend keeps an adopted BIGNUM and pools it with the element
+	for( uint32 i=0; i<4; ++i )
+	{
+		GF2nArithmeticElement x = randomElement(arithm, rng);
+		BIGNUM *value = toBN(x);
+		watchCryptoFree(value);
+
+		{
+			GF2nArithmeticElement adopted = interop::adopt(arithm, value);
+			CHECK(equal(adopted, x));
+		}
+
+		CHECK(!crypto_watched_freed.load());
+		BIGNUM *reused = cpu::openssl::newBN();
+		CHECK(reused == value);
+		CHECK(BN_is_zero(reused));
+		cpu::openssl::freeBN(reused);
+	}
+
+	// other backends copy the limbs and free the BIGNUM
+	{
+		GF2nArithmeticElement x = randomElement(forwarding, rng);
+		BIGNUM *value = toBN(x);
+		watchCryptoFree(value);
+
+		GF2nArithmeticElement adopted = interop::adopt(forwarding, value);
+		CHECK(equal(adopted, x));
+		CHECK(!crypto_hooked || crypto_watched_freed.load());
+	}
+
+	// a value above the field is freed by both
+	for( GF2nArithmetic *target : {&arithm, &forwarding} )
+	{
+		BIGNUM *value = BN_new();
+		BN_set_bit(value, field_size);
+		watchCryptoFree(value);
+
+		CHECK(throws<InvalidEncodingException>([&]() { interop::adopt(*target, value); }));
+		CHECK(!crypto_hooked || crypto_watched_freed.load());
+	}
+	watchCryptoFree(NULL);
+
+#ifdef GF2N_WITH_NTL
+	// NTL::GF2X is borrowed if its words cover all limbs, else copied
+	{
+		NTL::GF2X value;
+		interop::copyTo(full, value);
+		CHECK(NTL::deg(value) == static_cast<long>(field_size - 1));
+
+		GF2nLimbView view = interop::viewOf(value, num_limbs);
+		CHECK(view.isBorrowed() == (sizeof(_ntl_ulong) == sizeof(ufixn)));
+		CHECK(std::equal(limbs.begin(), limbs.end(), view.get()));
+		CHECK(equal(interop::getElement(arithm, value), full));
+
+		interop::copyTo(small, value);
+		view = interop::viewOf(value, num_limbs);
+		CHECK(!view.isBorrowed());
+		CHECK(view.get()[0] == 0x1234);
+		CHECK(equal(interop::getElement(arithm, value), small));
+
+		NTL::GF2X zero;
+		CHECK(equal(interop::getElement(arithm, zero), arithm.getElementFromHex("0")));
+
+		NTL::GF2X large;
+		NTL::SetCoeff(large, num_limbs * limb_bits);
+		CHECK(throws<InvalidEncodingException>([&]() { interop::viewOf(large, num_limbs); }));
+
+		NTL::GF2X above;
+		NTL::SetCoeff(above, field_size);
+		CHECK(throws<InvalidEncodingException>([&]() { interop::getElement(arithm, above); }));
+	}
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* decimal conversions */
+
+/* 2^bits - 1 - offset as decimal string */
+std::string belowPowerOfTwo( const uint32 bits, const uint32 offset )
+{
+	mpz_t value;
+	mpz_init_set_ui(value, 1);
+	mpz_mul_2exp(value, value, bits);
+	mpz_sub_ui(value, value, 1 + offset);
+
+	char *str = mpz_get_str(NULL, 10, value);
+	std::string res(str);
+	free(str);
+	mpz_clear(value);
+
+	return res;
+}
+
+/* true if arr holds the chunks of size_chunk_bits bits of str, most significant first */
+bool chunksOf( const std::string &str, const int size_chunk_bits, const std::vector<std::string> &arr )
+{
+	mpz_t value, chunk, expected;
+	mpz_init_set_str(value, str.c_str(), 10);
+	mpz_init(chunk);
+	mpz_init(expected);
+
+	bool ok = true;
+	for( size_t i=0; i<arr.size() && ok; ++i )
+	{
+		size_t pos = (arr.size() - 1 - i) * size_chunk_bits;
+		mpz_fdiv_q_2exp(expected, value, pos);
+		mpz_fdiv_r_2exp(expected, expected, size_chunk_bits);
+		ok = mpz_set_str(chunk, arr[i].c_str(), 10) == 0 && mpz_cmp(chunk, expected) == 0;
+	}
+
+	// no bits above the chunks
+	mpz_fdiv_q_2exp(expected, value, arr.size() * size_chunk_bits);
+	ok = ok && mpz_sgn(expected) == 0;
+
+	mpz_clear(value);
+	mpz_clear(chunk);
+	mpz_clear(expected);
+
+	return ok;
+}
+
+void testDecimal()
+{
+	const uint32 limb_bits = sizeof(ufixn) * 8;
+	const uint32 num_limbs = 5;
+
+	// 0, one limb, exactly num_limbs limbs and one limb more
+	struct { std::string str; size_t num_limbs; } cases[] = {
+		{ "0", 1 },
+		{ "1", 1 },
+		{ belowPowerOfTwo(limb_bits, 0), 1 },
+		{ belowPowerOfTwo(limb_bits, 0x1234), 1 },
+		{ belowPowerOfTwo(num_limbs * limb_bits, 0), num_limbs },
+		{ belowPowerOfTwo(num_limbs * limb_bits, 77), num_limbs },
+		{ belowPowerOfTwo(num_limbs * limb_bits + 1, 0), num_limbs + 1 }
+	};
+
+	for( uint32 i=0; i<sizeof(cases) / sizeof(cases[0]); ++i )
+	{
+		std::vector<ufixn> limbs;
+		utils::decimalToLimbs(cases[i].str, limbs);
+		CHECK(limbs.size() == cases[i].num_limbs);
+		CHECK(utils::limbsToDecimal(&limbs[0], static_cast<uint32>(limbs.size())) == cases[i].str);
+
+		// leading zero limbs do not change the value
+		limbs.resize(num_limbs + 2, 0);
+		CHECK(utils::limbsToDecimal(&limbs[0], static_cast<uint32>(limbs.size())) == cases[i].str);
+	}
+
+	std::vector<ufixn> all_ones;
+	utils::decimalToLimbs(belowPowerOfTwo(num_limbs * limb_bits, 0), all_ones);
+	CHECK(std::count(all_ones.begin(), all_ones.end(), static_cast<ufixn>(~static_cast<ufixn>(0))) == static_cast<long>(num_limbs));
+
+	for( const char *str : {"", "abc", "12a", "0x12", "-5", "1.5"} )
+	{
+		std::vector<ufixn> limbs;
+		CHECK(throws<InvalidEncodingException>([&]() { utils::decimalToLimbs(str, limbs); }));
+
+		std::vector<std::string> arr;
+		CHECK(throws<InvalidEncodingException>([&]() { utils::convertStringToArray(str, 32, 4, arr); }));
+		CHECK(throws<InvalidEncodingException>([&]() { utils::convertStringToArray(str, 96, 4, arr); }));
+	}
+
+	// chunk widths of the word path, of exactly a word and of the division fallback
+	for( int size_chunk_bits : {1, 8, 31, 32, 63, 64, 65, 96, 128} )
+	{
+		for( uint32 i=0; i<sizeof(cases) / sizeof(cases[0]); ++i )
+		{
+			const std::string &str = cases[i].str;
+			size_t num_bits = str == "0" ? 0 : cases[i].num_limbs * limb_bits;
+			int num_value_chunks = static_cast<int>((num_bits + size_chunk_bits - 1) / size_chunk_bits);
+
+			// padded and not padded
+			for( int num_chunks : {1, num_value_chunks, num_value_chunks + 3} )
+			{
+				std::vector<std::string> arr;
+				utils::convertStringToArray(str, size_chunk_bits, num_chunks, arr);
+				CHECK(arr.size() >= static_cast<size_t>(num_chunks));
+				CHECK(chunksOf(str, size_chunk_bits, arr));
+
+				std::string back;
+				utils::convertArrayToString(arr, size_chunk_bits, static_cast<int>(arr.size()), back);
+				CHECK(back == str);
+			}
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* BIGNUM pools of the OpenSSL backend */
+
+void testBNPool()
+{
+	const size_t count = 300;
+	std::mt19937_64 rng(34);
+
+	// a BIGNUM freed on the thread of its element comes back with the next newBN
+	BIGNUM *value = cpu::openssl::newBN();
+	BN_set_word(value, 77);
+	cpu::openssl::freeBN(value);
+	BIGNUM *reused = cpu::openssl::newBN();
+	CHECK(reused == value);
+	CHECK(BN_is_zero(reused));
+	cpu::openssl::freeBN(reused);
+
+	if( !crypto_hooked )
+		return;
+
+	// elements made on this thread and dropped on others, the BIGNUMs
+	// come back through the shared pool once the first round is done
+	for( uint32 field_size : {163, 1000} )
+	{
+		GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("OpenSSL", field_size);
+		GF2nArithmeticElement x = randomElement(arithm, rng);
+
+		for( uint32 round=0; round<4; ++round )
+		{
+			uint64 allocs_before = crypto_allocs.load();
+
+			std::vector<GF2nArithmeticElement> elements;
+			for( size_t i=0; i<count; ++i )
+				elements.push_back(x * x);
+
+			if( round > 0 )
+				CHECK(crypto_allocs.load() == allocs_before);
+
+			std::thread consumer([&elements]() {
+				elements.clear();
+			});
+			consumer.join();
+		}
+
+		// steady state multiplications of elements and of batches
+		arithm.setExecutor(std::shared_ptr<GF2nExecutorInterface>());
+		uint32 num_limbs = arithm.getNumLimbs();
+		std::vector<ufixn> a(count * num_limbs), out(count * num_limbs);
+		for( size_t i=0; i<count; ++i )
+			randomElement(arithm, rng).getLimbs(&a[i * num_limbs], num_limbs);
+
+		GF2nArithmeticElement y = randomElement(arithm, rng);
+		for( uint32 round=0; round<3; ++round )
+		{
+			uint64 allocs_before = crypto_allocs.load();
+
+			for( size_t i=0; i<count; ++i )
+				y = y * x;
+			arithm.mulBatch(&a[0], &a[0], &out[0], count);
+			arithm.expBatch(&a[0], 5, &out[0], count);
+
+			if( round > 0 )
+				CHECK(crypto_allocs.load() == allocs_before);
+		}
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* GF2nLimbPool */
+
+/* host slabs that count the slabs alive */
+class CountingSlabAllocator : public GF2nHostSlabAllocator
+{
+public:
+	CountingSlabAllocator() : num_slabs(0) {}
+
+	virtual void *allocate( const size_t num_bytes )
+	{
+		++num_slabs;
+		return GF2nHostSlabAllocator::allocate(num_bytes);
+	}
+
+	virtual void free( void *slab )
+	{
+		--num_slabs;
+		GF2nHostSlabAllocator::free(slab);
+	}
+
+	std::atomic<int32> num_slabs;
+};
+
+void testLimbPool()
+{
+	const uint32 num_threads = 8;
+	const uint32 slots_per_thread = 50;
+	const uint32 num_rounds = 200;
+	const uint32 max_slots = 1 << 12;
+
+	std::shared_ptr<CountingSlabAllocator> allocator = std::make_shared<CountingSlabAllocator>();
+
+	{
+		// a small first slab, so the threads grow the pool concurrently
+		GF2nLimbPool pool(3 * sizeof(ufixn), 4, allocator);
+		std::unique_ptr<std::atomic<uint32>[]> owners(new std::atomic<uint32>[max_slots]);
+		for( uint32 i=0; i<max_slots; ++i )
+			owners[i].store(0);
+		std::atomic<uint32> num_errors(0);
+
+		std::vector<std::thread> threads;
+		for( uint32 t=1; t<=num_threads; ++t )
+		{
+			threads.push_back(std::thread([&, t]()
+			{
+				std::vector<uint32> slots;
+
+				for( uint32 round=0; round<num_rounds; ++round )
+				{
+					for( uint32 i=0; i<slots_per_thread; ++i )
+					{
+						uint32 slot = pool.get();
+						uint32 expected = 0;
+
+						// a slot handed out twice already has an owner
+						if( slot >= max_slots || !owners[slot].compare_exchange_strong(expected, t) )
+						{
+							++num_errors;
+							continue;
+						}
+
+						ufixn *data = static_cast<ufixn *>(pool.getData(slot));
+						std::fill(data, data + 3, static_cast<ufixn>(t) << 32 | slot);
+						slots.push_back(slot);
+					}
+
+					for( uint32 slot : slots )
+					{
+						ufixn *data = static_cast<ufixn *>(pool.getData(slot));
+						if( data[0] != (static_cast<ufixn>(t) << 32 | slot) || data[2] != data[0] )
+							++num_errors;
+
+						owners[slot].store(0);
+						pool.free(slot);
+					}
+					slots.clear();
+				}
+			}));
+		}
+
+		for( std::thread &thread : threads )
+			thread.join();
+
+		GF2nLimbPoolStats stats = pool.getStats();
+		CHECK(num_errors == 0);
+		CHECK(stats.in_use == 0);
+		CHECK(stats.peak_in_use >= slots_per_thread);
+		CHECK(stats.peak_in_use <= num_threads * slots_per_thread);
+		CHECK(stats.capacity >= stats.peak_in_use);
+		CHECK(stats.num_slabs > 1);
+		CHECK(allocator->num_slabs == static_cast<int32>(stats.num_slabs));
+
+		// the slots start at cache lines
+		uint32 slot = pool.get();
+		CHECK(reinterpret_cast<uintptr_t>(pool.getData(slot)) % 64 == 0);
+		CHECK(pool.getStats().in_use == 1);
+		pool.free(slot);
+		CHECK(pool.getStats().in_use == 0);
+	}
+
+	// the slabs are released with the pool
+	CHECK(allocator->num_slabs == 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* GF2nPackedArray */
+
+void testPackedArray()
+{
+	std::mt19937_64 rng(38);
+	const size_t count = 37;
+
+	GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("OpenSSL", 233);
+	uint32 num_limbs = arithm.getNumLimbs();
+	uint32 stride = num_limbs + 1;
+
+	std::string path_a = tempPath("a.gf2n");
+	std::string path_b = tempPath("b.gf2n");
+	std::string path_res = tempPath("res.gf2n");
+
+	std::vector<GF2nArithmeticElement> a, b;
+	{
+		GF2nPackedArray packed_a = GF2nPackedArray::create(path_a, arithm, count, stride);
+		GF2nPackedArray packed_b = GF2nPackedArray::create(path_b, arithm, count, stride);
+		CHECK(packed_a.getCount() == count);
+		CHECK(packed_a.getStride() == stride);
+		CHECK(packed_a.isWritable());
+
+		for( size_t i=0; i<count; ++i )
+		{
+			a.push_back(randomElement(arithm, rng));
+			b.push_back(randomElement(arithm, rng));
+			a[i].getLimbs(packed_a.getLimbs() + i * stride, num_limbs);
+			b[i].getLimbs(packed_b.getLimbs() + i * stride, num_limbs);
+		}
+
+		packed_a.sync();
+	}
+
+	{
+		GF2nPackedArray packed_a = GF2nPackedArray::open(path_a, arithm);
+		GF2nPackedArray packed_b = GF2nPackedArray::open(path_b, arithm);
+		GF2nPackedArray packed_res = GF2nPackedArray::create(path_res, arithm, count, stride);
+		CHECK(packed_a.getCount() == count);
+		CHECK(packed_a.getStride() == stride);
+		CHECK(!packed_a.isWritable());
+
+		arithm.mulBatch(packed_a.getLimbs(), packed_b.getLimbs(), packed_res.getLimbs(), count, stride);
+
+		for( size_t i=0; i<count; ++i )
+			CHECK(equal(arithm.getElementFromLimbs(packed_res.getLimbs() + i * stride), a[i] * b[i]));
+	}
+
+	{
+		GF2nPackedArray packed_res = GF2nPackedArray::open(path_res, arithm, GF2N_PACKED_READ_WRITE);
+		CHECK(packed_res.isWritable());
+		CHECK(equal(arithm.getElementFromLimbs(packed_res.getLimbs()), a[0] * b[0]));
+	}
+
+	// another degree and another modulus of the same degree
+	GF2nArithmetic other_size = GF2nArithmeticFactory::createInstance("OpenSSL", 283);
+	GF2nArithmetic other_modulus = GF2nArithmeticFactory::createInstance("OpenSSL", 233);
+	int irred_poly[] = {233, 159, 0};
+	other_modulus.setDummyParameters(233, static_cast<const void *>(irred_poly), 3);
+
+	CHECK(throws<PackedArrayFormatException>([&]() { GF2nPackedArray::open(path_a, other_size); }));
+	CHECK(throws<PackedArrayFormatException>([&]() { GF2nPackedArray::open(path_a, other_modulus); }));
+	CHECK(throws<PackedArrayIOException>([&]() { GF2nPackedArray::open(tempPath("missing.gf2n"), arithm); }));
+
+	std::remove(path_a.c_str());
+	std::remove(path_b.c_str());
+	std::remove(path_res.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* GF2nElementView */
+
+void testElementView()
+{
+	std::mt19937_64 rng(44);
+
+	GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("OpenSSL", 409);
+	uint32 num_limbs = arithm.getNumLimbs();
+
+	GF2nArithmeticElement a = randomElement(arithm, rng);
+	GF2nArithmeticElement b = randomElement(arithm, rng);
+
+	std::vector<ufixn> t(num_limbs), u(num_limbs);
+	GF2nElementView view_t(arithm, &t[0]);
+	GF2nElementView view_b(arithm, &u[0]);
+	view_t.setElement(a);
+	view_b.setElement(b);
+
+	// the result is an operand
+	view_t.mul(view_t, view_b);
+	GF2nArithmeticElement ab = a * b;
+	CHECK(equal(view_t.getElement(), ab));
+	CHECK(view_t.toHex() == ab.toHex());
+
+	view_t.add(view_t, view_b);
+	CHECK(equal(view_t.getElement(), a * b + b));
+
+	view_t.exp(view_t, 3);
+	GF2nArithmeticElement ab_b = a * b + b;
+	GF2nArithmeticElement c = ab_b.runWithValue("exp", 3);
+	CHECK(equal(view_t.getElement(), c));
+
+	view_t.inverse(view_t);
+	CHECK(equal(view_t.getElement(), c.runWithValue("inverse", 0)));
+
+	view_t.mul(view_t, view_t);
+	GF2nArithmeticElement d = c.runWithValue("inverse", 0);
+	CHECK(equal(view_t.getElement(), d * d));
+
+	view_t.add(view_t, view_t);
+	CHECK(equal(view_t.getElement(), arithm.getElementFromHex("0")));
+
+	// a copy shares the arithmetic object, a second instance does not
+	GF2nArithmetic copy = arithm;
+	GF2nConstElementView view_copy(copy, &u[0]);
+	view_t.mul(view_copy, view_b);
+	CHECK(equal(view_t.getElement(), b * b));
+
+	GF2nArithmetic other = GF2nArithmeticFactory::createInstance("OpenSSL", 409);
+	std::vector<ufixn> v(u);
+	GF2nElementView view_other(other, &v[0]);
+
+	CHECK(throws<ElementViewMismatchException>([&]() { view_t.mul(view_t, view_other); }));
+	CHECK(throws<ElementViewMismatchException>([&]() { view_t.add(view_other, view_b); }));
+	CHECK(throws<ElementViewMismatchException>([&]() { view_t.setValue(view_other); }));
+	CHECK(throws<ElementViewMismatchException>([&]() { view_other.inverse(view_t); }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* Cuda example, needs a GPU */
+
+void runCudaExample()
 {
 	GF2nArithmetic arithm = GF2nArithmeticFactory::createInstance("Cuda", 10);
 
@@ -43,6 +1878,76 @@ int main(int argc, char *argv[])
 	std::vector<uint8> res;
 	l.getValue(res);
 	std::cout << (uint32)arr_j[0] << " * " << *((uint32 *)(&arr_k[0])) << " " << *((uint32 *)(&arr_k[4])) << " = " << i << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* runs the tests */
+
+struct TestGroup
+{
+	const char *name;
+	void (*run)();
+	/* run without naming it on the command line */
+	bool by_default;
+};
+
+const TestGroup test_groups[] = {
+	{ "cuda", &runCudaExample, false },
+	{ "graph", &testGraph, true },
+	{ "inverse", &testInverse, true },
+	{ "conversion", &testConversion, true },
+	{ "bulk", &testBulkConversion, true },
+	{ "irreducible", &testIrreducible, true },
+	{ "validation", &testModulusValidation, true },
+	{ "cache", &testFieldCache, true },
+	{ "isa", &testIsa, true },
+	{ "fixed", &testFixed, true },
+	{ "executor", &testExecutor, true },
+	{ "async", &testAsync, true },
+	{ "arena", &testArena, true },
+	{ "interop", &testInterop, true },
+	{ "decimal", &testDecimal, true },
+	{ "bnpool", &testBNPool, true },
+	{ "pool", &testLimbPool, true },
+	{ "packed", &testPackedArray, true },
+	{ "view", &testElementView, true }
+};
+
+int main( int argc, char *argv[] )
+{
+	// the library opens the field cache of the environment, a temporary
+	// one keeps the records of the tests out of the cache of the user
+	std::string cache_path = tempPath("library.cache");
+	setenv(GF2N_FIELD_CACHE_ENV, cache_path.c_str(), 1);
+
+	hookCryptoMemory();
+
+	// the default groups or the ones named on the command line
+	for( uint32 i=0; i<sizeof(test_groups) / sizeof(test_groups[0]); ++i )
+	{
+		bool selected = (argc < 2 && test_groups[i].by_default);
+		for( int j=1; j<argc; ++j )
+			selected = selected || strcmp(argv[j], test_groups[i].name) == 0;
+
+		if( !selected )
+			continue;
+
+		uint32 failures_before = num_failures;
+
+		try
+		{
+			test_groups[i].run();
+		}
+		catch( std::exception &e )
+		{
+			++num_failures;
+			std::cerr << test_groups[i].name << ": " << e.what() << std::endl;
+		}
+
+		std::cout << test_groups[i].name << ": " << (num_failures == failures_before ? "ok" : "FAILED") << std::endl;
+	}
+
+	std::remove(cache_path.c_str());
 
-	return 0;
-}
\ No newline at end of file
+	return num_failures == 0 ? 0 : 1;
+}
@@ -16,102 +16,87 @@
    You should have received a copy of the GNU General Public License
    along with libtrevisan. If not, see <http://www.gnu.org/licenses/>. */
 
+
 // Generate a list of precomputed irreducible polynomials
 
-#include <NTL/GF2X.h>
-#include <NTL/GF2XFactoring.h>
-#include <NTL/tools.h>
 #include <cstring>
 #include <string>
+#include <vector>
 #include <iostream>
-#include <sstream>
-#include <algorithm>
-#include <inttypes.h>
-
-#include <stdlib.h>
-#include <stdio.h>
+#include <cstdlib>
 
 #include "CumffaTypes.h"
-
-NTL_CLIENT
-
-#define MIN_FIELD_ORDER 1 
-#define MAX_FIELD_ORDER 2048 
- 
-void convertCharArrayToIntArray( unsigned char* s_value, ufixn* t_value, int num_chars ) {
-	
-	if(num_chars == 0)
-		return;
-
-	int offset = 0;
-	int size_chunk_bytes = sizeof(ufixn);	
-	double step_size = (double)1 / size_chunk_bytes;
-		
-	int highest_block_idx = (num_chars - 1) / size_chunk_bytes;
-	double j = highest_block_idx + 1 - step_size;
-	
-	for( int i=num_chars-1; i>=0; --i ) 
-	{
-		t_value[(int)j] += ((ufixn)s_value[i] << offset);
-		
-		offset = (offset + 8) % (sizeof(ufixn) * 8);
-		j-=step_size;
-	}
+#include "GF2nExecutor.h"
+#include "GF2nIrreducible.h"
+
+using namespace std;
+using namespace libcumffa;
+
+#define MIN_FIELD_ORDER 1
+#define MAX_FIELD_ORDER 2048
+
+unsigned min_order = MIN_FIELD_ORDER;
+unsigned max_order = MAX_FIELD_ORDER;
+
+// irreps[n - min_order] is the modulus of degree n
+vector<GF2nIrreducibleTerms> irreps;
+
+// Searches all degrees on the workers of the library's executor. A
+// search of a single degree runs on the worker that took the degree.
+// The largest degrees take longest, so they are handed out first.
+void find_irreps() {
+	irreps.resize(max_order - min_order + 1);
+
+	getDefaultExecutor()->parallelFor(irreps.size(), 1,
+		[]( const size_t begin, const size_t end, const uint32 worker ) {
+			for (size_t i = begin; i < end; i++) {
+				size_t idx = irreps.size() - 1 - i;
+				irreps[idx] = utils::findIrreducible(min_order + idx);
+			}
+		});
 }
 
-void clearArray( ufixn* array, int size ) {
-	for(int i=0; i<size; ++i) {
-		array[i] = 0;
-	}
+int num_terms(const GF2nIrreducibleTerms &P) {
+	int i = 0;
+	while (i < (int)GF2N_IRRED_MAX_TERMS && P.exponents[i] >= 0)
+		i++;
+	return i;
 }
 
-void printbincharpad(unsigned char* ca, unsigned int n)
-{
-	for(int j=0; j<n; j++) {
-		char c = ca[j];
-	    for (int i = 7; i >= 0; --i)
-	    {
-	        putchar( (c & (1 << i)) ? '1' : '0' );
-	    }
-	    putchar(' ');
-	}
-	putchar('\n');
-}
+// the bytes of P, least significant first
+vector<unsigned char> to_bytes(const GF2nIrreducibleTerms &P) {
+	vector<unsigned char> bytes(P.exponents[0] / 8 + 1, 0);
 
-void printbincharpad(int* ca, unsigned int n)
-{
-	for(int j=0; j<n; j++) {
-		int c = ca[j];
-	    for (int i = 31; i >= 0; --i)
-	    {
-	        putchar( (c & (1 << i)) ? '1' : '0' );
-	    }
-	    putchar(' ');
-	}
-	putchar('\n');
+	for (int i = 0; i < num_terms(P); i++)
+		bytes[P.exponents[i] / 8] |= 1 << (P.exponents[i] % 8);
+
+	return bytes;
 }
 
 void gen_irreps_ntl() {
-	stringstream ss;
 	cout << "// This file is auto-generated by gen_irreps.cc, don't modify" << endl;
 	cout << "#include <NTL/GF2X.h>" << endl;
 	cout << "#include <sstream>" << endl;
 	cout << "#include <iostream>" << endl;
-    cout << "#include <cstdlib>" << endl;
+	cout << "#include <cstdlib>" << endl;
 	cout << "NTL_CLIENT" << endl;
 	cout << "void set_irrep(GF2X &P, unsigned n) {" << endl;
 	cout << "stringstream ss;" << endl;
 	cout << "switch (n) {" << endl;
 
-	for (unsigned n = MIN_FIELD_ORDER; n <= MAX_FIELD_ORDER; n++) {
-		GF2X P;
-		BuildSparseIrred(P, n);
+	for (unsigned n = min_order; n <= max_order; n++) {
+		const GF2nIrreducibleTerms &P = irreps[n - min_order];
+
+		// NTL's notation of a GF2X, the coefficients of x^0 to x^n
+		vector<char> coeffs(n + 1, '0');
+		for (int i = 0; i < num_terms(P); i++)
+			coeffs[P.exponents[i]] = '1';
 
-		// This way of storage is extremely inefficient. But since
-		// we're only talking about a few bytes on a big iron machine,
-		// who cares...
 		cout << "case " << n << ":" << endl;
-		cout << "ss << \"" << P  << "\";" << endl;
+		cout << "ss << \"[";
+		for (unsigned i = 0; i <= n; i++)
+			cout << (i == 0 ? "" : " ") << coeffs[i];
+		cout << "]\";" << endl;
 		cout << "ss >> P;" << endl;
 		cout << "break;" << endl;
 	}
@@ -124,28 +109,21 @@ void gen_irreps_ntl() {
 }
 
 void gen_irreps_openssl() {
-	stringstream ss;
 	cout << "// This file is auto-generated by gen_irreps.cc, don't modify" << endl;
 	cout << "#include <openssl/bn.h>" << endl;
 	cout << "#include <iostream>" << endl;
-    cout << "#include <cstdlib>" << endl;
-    cout << "#include <vector>" << endl;
+	cout << "#include <cstdlib>" << endl;
+	cout << "#include <vector>" << endl;
 	cout << "using namespace std;" << endl;
 	cout << "void set_irrep(vector<int> &p, unsigned n) {" << endl;
 	cout << "switch (n) {" << endl;
 
-	for (unsigned n = MIN_FIELD_ORDER; n <= MAX_FIELD_ORDER; n++) {
-		GF2X P;
-		BuildSparseIrred(P, n);
+	for (unsigned n = min_order; n <= max_order; n++) {
+		const GF2nIrreducibleTerms &P = irreps[n - min_order];
 
-		// Sure, there are much more efficient ways to detect the number
-		// of set bits
 		cout << "case " << n << ": {" << endl;
-		
-		for (long i = deg(P); i >= 0; i--) {
-			if (coeff(P, i) == 1)
-				cout << "p.push_back("  << i << ");" << endl;
-		}
+		for (int i = 0; i < num_terms(P); i++)
+			cout << "p.push_back("  << P.exponents[i] << ");" << endl;
 		cout << "} break;" << endl;
 	}
 
@@ -157,46 +135,30 @@ void gen_irreps_openssl() {
 }
 
 void gen_irreps_cuda() {
-	stringstream ss;
 	cout << "// This file is auto-generated by gen_irreps.cc, don't modify" << endl;
 	cout << "#include \"CumffaTypes.h\"" << endl;
 	cout << "#include \"Bug.h\"" << endl;
 	cout << "#include <iostream>" << endl;
-    cout << "#include <cstdlib>" << endl;
-    cout << "#include <vector>" << endl;
+	cout << "#include <cstdlib>" << endl;
+	cout << "#include <vector>" << endl;
 	cout << "using namespace std;" << endl;
 
 	cout << "void set_irrep_cuda(vector<ufixn> &p, uint32 n) {" << endl;
 	cout << "switch (n) {" << endl;
 
-	for( unsigned n = MIN_FIELD_ORDER; n <= MAX_FIELD_ORDER; n++ ) 
-	{
-		GF2X P;
-		BuildSparseIrred(P, n);
-
-		// Sure, there are much more efficient ways to detect the number
-		// of set bits
-		cout << "case " << n << ": {" << endl;
-
-		long num_bytes = NumBytes(P);
-		unsigned char bytes[num_bytes];
-		int num_chunks = (num_bytes - 1) / sizeof(ufixn) + 1;
-		ufixn bytes_as_ufixn[num_chunks];
-		clearArray(bytes_as_ufixn, num_chunks);
+	for (unsigned n = min_order; n <= max_order; n++) {
+		vector<unsigned char> bytes = to_bytes(irreps[n - min_order]);
 
-		BytesFromGF2X(bytes, P, num_bytes);
+		// the chunks of the modulus, most significant first
+		int num_chunks = (bytes.size() - 1) / sizeof(ufixn) + 1;
+		vector<ufixn> chunks(num_chunks, 0);
 
-		reverse(bytes, bytes+num_bytes);
-		
-		long offset = 0;
-		long i = 0;
-		
-		convertCharArrayToIntArray(bytes, bytes_as_ufixn, num_bytes);
-
-		for(int i=0; i<num_chunks; i++) {
-			cout << "p.push_back("  << bytes_as_ufixn[i] << "ULL);" << endl;
-		}
+		for (size_t i = 0; i < bytes.size(); i++)
+			chunks[num_chunks - 1 - i / sizeof(ufixn)] |= (ufixn)bytes[i] << (8 * (i % sizeof(ufixn)));
 
+		cout << "case " << n << ": {" << endl;
+		for (int i = 0; i < num_chunks; i++)
+			cout << "p.push_back("  << chunks[i] << "ULL);" << endl;
 		cout << "} break;" << endl;
 	}
 
@@ -207,8 +169,23 @@ void gen_irreps_cuda() {
 	cout << "}" << endl;
 }
 
+// Rows of GF2nIrreducibleTable.inc, the exponents of the nonzero
+// terms in descending order, padded with -1. Every backend derives its
+// own form of the modulus from them.
+void gen_irreps_table() {
+	cout << "// This file is auto-generated by gen_irreps.cc, don't modify" << endl;
+
+	for (unsigned n = min_order; n <= max_order; n++) {
+		const GF2nIrreducibleTerms &P = irreps[n - min_order];
+
+		cout << "{ ";
+		for (unsigned i = 0; i < GF2N_IRRED_MAX_TERMS; i++)
+			cout << (i == 0 ? "" : ", ") << P.exponents[i];
+		cout << " }," << endl;
+	}
+}
+
 void gen_irreps_cuda_for_py() {
-	stringstream ss;
 	cout << "# This file is auto-generated by gen_irreps.cc, don't modify" << endl;
 	cout << endl;
 
@@ -218,41 +195,52 @@ void gen_irreps_cuda_for_py() {
 	cout << "\tres = 0" << endl;
 	cout << endl;
 
-	for (unsigned n = MIN_FIELD_ORDER; n <= MAX_FIELD_ORDER; n++) {
-		GF2X P;
-		BuildSparseIrred(P, n);
+	for (unsigned n = min_order; n <= max_order; n++) {
+		vector<unsigned char> bytes = to_bytes(irreps[n - min_order]);
 
-		// Sure, there are much more efficient ways to detect the number
-		// of set bits
-		if( n == 1 )
+		if( n == min_order )
 			cout << "\tif n == " << n << ":" << endl;
 		else
 			cout << "\telif n == " << n << ":" << endl;
 
-		long num_bytes = NumBytes(P);
-		unsigned char bytes[num_bytes];
-
-		BytesFromGF2X(bytes, P, num_bytes);
-
-		reverse(bytes, bytes+num_bytes);
-		
-		long shift = 0;
-
-		for( int i=num_bytes-1; i>=0; --i ) {
-			cout << "\t\tres = res + (" << +bytes[i] << " << " << shift << ")" << endl;
-			shift = shift + 8;
-		}
+		for (size_t i = 0; i < bytes.size(); i++)
+			cout << "\t\tres = res + (" << +bytes[i] << " << " << 8 * i << ")" << endl;
 	}
 
 	cout << endl;
 	cout << "\treturn res" << endl;
 }
 
+void print_usage() {
+	cerr << "Generate the irreducible polynomials of the degrees min to max by calling" << endl;
+	cerr << "./gen_irreps <TABLE|OSSL|CUDA|NTL|PYTHON> [<min> <max>]" << endl;
+	cerr << "The degrees default to " << MIN_FIELD_ORDER << " to " << MAX_FIELD_ORDER << "." << endl;
+}
+
 int main(int argc, char **argv) {
+	if (argc != 2 && argc != 4) {
+		print_usage();
+		return 1;
+	}
+
+	if (argc == 4) {
+		min_order = strtoul(argv[2], NULL, 0);
+		max_order = strtoul(argv[3], NULL, 0);
+	}
+
+	if (min_order < 1 || max_order < min_order) {
+		print_usage();
+		return 1;
+	}
+
+	find_irreps();
+
 	if(strcmp(argv[1], "NTL") == 0) {
 		gen_irreps_ntl();
 	} else if(strcmp(argv[1], "CUDA") == 0) {
 		gen_irreps_cuda();
+	} else if(strcmp(argv[1], "TABLE") == 0) {
+		gen_irreps_table();
 	} else if(strcmp(argv[1], "PYTHON") == 0) {
 		gen_irreps_cuda_for_py();
 	} else {
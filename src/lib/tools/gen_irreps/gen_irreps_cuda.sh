@@ -1,2 +0,0 @@
-make
-./gen_irreps CUDA >> ../../lib/gpu_code/src/irred_cuda.cc
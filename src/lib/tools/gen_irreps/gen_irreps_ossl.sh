@@ -1,2 +0,0 @@
-make
-./gen_irreps OSSL >../../lib/cpu_code/src/irred_ossl.cc
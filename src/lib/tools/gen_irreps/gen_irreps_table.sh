@@ -0,0 +1,2 @@
+make
+./gen_irreps TABLE > ../../include/GF2nIrreducibleTable.inc
@@ -18,13 +18,14 @@
 
 // Generate a list of precomputed irreducible polynomials
 
-#include <NTL/GF2X.h>
-#include <NTL/GF2XFactoring.h>
-#include <NTL/tools.h>
 #include <iostream>
+#include <string>
 #include <sys/time.h>
 
-NTL_CLIENT
+#include "GF2nIrreducible.h"
+
+using namespace std;
+using namespace libcumffa;
 
 unsigned int field_sizes[] = {8192, 16382, 32768, 65536, 131072, 262144, 524288};
 
@@ -38,16 +39,14 @@ double cpuSecond()
 
 void gen_irreps() 
 {
-	for( unsigned n = 0; n <= sizeof(field_sizes)/sizeof(unsigned int); n++ ) 
+	for( unsigned n = 0; n < sizeof(field_sizes)/sizeof(unsigned int); n++ ) 
 	{
-		GF2X P;
-
 		double iStart, iElaps;
 		iStart = cpuSecond();
 
 		clog << "calculating irreducible polynomial of size " << std::to_string(field_sizes[n]) << " Bit takes ... ";
 
-		BuildSparseIrred(P, field_sizes[n]);
+		utils::findIrreducible(field_sizes[n]);
 				
 		iElaps = cpuSecond() - iStart;
 		clog << std::to_string(iElaps) << "s" << std::endl;
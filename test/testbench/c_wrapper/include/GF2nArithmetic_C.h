@@ -141,6 +141,8 @@ void *createInstance( const char *mode );
 void setFieldSize( void *inst, const unsigned long field_size );
 void setDummyParameters( void *inst, const unsigned long field_size, const unsigned char *irred_poly, const unsigned long chunks_irred_poly );
 void run( void *inst, const unsigned char *what, const unsigned long value, const unsigned long field_size, unsigned char flags, int runs, double *results );
+void runBatch( void *inst, const unsigned char *what, const unsigned long value, const unsigned long count, const unsigned char *a, const unsigned char *b, unsigned char *res );
+unsigned long getNumLimbs( void *inst );
 void getResult( unsigned long num_chunks, char *c );
 int getMetricsSize( const unsigned char *value_name );
 void getMetrics( const unsigned char *value_name, char *metrics );
@@ -93,7 +93,7 @@ extern "C"
 		int runs, 
 		double *results )
 	{
-		std::string what_str((const char*)what);
+		GF2nArithmeticOp op = reinterpret_cast<GF2nArithmetic *>(inst)->resolveOp((const char*)what);
 		 
 		if( (flags & 0x2) > 0 )
 		{
@@ -120,7 +120,7 @@ extern "C"
 		{
 			for( int i=0; i<runs; ++i )
 			{
-				res = bn_a.runWithValue(what_str, value);
+				res = op(bn_a, value);
 				res_vec[i] = std::stod(res.getMetrics("creation_time"));
 			}
 		}
@@ -128,7 +128,7 @@ extern "C"
 		{
 			for( int i=0; i<runs; ++i )
 			{
-				res = bn_a.runWithElement(what_str, bn_b);
+				res = op(bn_a, bn_b);
 				res_vec[i] = std::stod(res.getMetrics("creation_time"));
 			}
 		}
@@ -136,6 +136,26 @@ extern "C"
 		memcpy(results, &res_vec[0], sizeof(res_vec));
 	}
 
+	void runBatch( 
+		void *inst, 
+		const unsigned char *what, 
+		const unsigned long value, 
+		const unsigned long count, 
+		const unsigned char *a, 
+		const unsigned char *b, 
+		unsigned char *res )
+	{
+		GF2nArithmetic *arithm = reinterpret_cast<GF2nArithmetic *>(inst);
+		GF2nArithmeticOp op = arithm->resolveOp((const char*)what);
+
+		arithm->runBatch(op, (const ufixn *)a, (const ufixn *)b, value, (ufixn *)res, count);
+	}
+
+	unsigned long getNumLimbs( void *inst )
+	{
+		return reinterpret_cast<GF2nArithmetic *>(inst)->getNumLimbs();
+	}
+
 	void getResult( unsigned long num_chunks, char *c )
 	{
 		std::vector<uint8> res_vec;
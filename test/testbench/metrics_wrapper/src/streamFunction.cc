@@ -0,0 +1,408 @@
+#include <GF2nArithmetic.h>
+#include <GF2nAlignedMemory.h>
+#include <GF2nPackedArray.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <unistd.h>
+
+using namespace libcumffa;
+
+/* bytes of an operand buffer of a chunk */
+const size_t CHUNK_BYTES = 8 * 1024 * 1024;
+
+/* chunks in flight, one per stage plus one to refill while the others run */
+const size_t PIPELINE_DEPTH = 4;
+
+/*
+	a queue with a fixed capacity, push blocks while it is full and pop
+	while it is empty. After close both return false once it is drained.
+*/
+template<typename T>
+class BoundedQueue
+{
+public:
+	explicit BoundedQueue( const size_t capacity )
+		: m_capacity(capacity)
+		, m_closed(false)
+		{}
+
+	bool push( const T &value )
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_not_full.wait(lock, [this] { return m_closed || m_items.size() < m_capacity; });
+
+		if( m_closed )
+			return false;
+
+		m_items.push_back(value);
+		m_not_empty.notify_one();
+		return true;
+	}
+
+	bool pop( T &value )
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_not_empty.wait(lock, [this] { return m_closed || !m_items.empty(); });
+
+		if( m_items.empty() )
+			return false;
+
+		value = m_items.front();
+		m_items.pop_front();
+		m_not_full.notify_one();
+		return true;
+	}
+
+	void close()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_closed = true;
+		m_not_full.notify_all();
+		m_not_empty.notify_all();
+	}
+
+private:
+	size_t m_capacity;
+	bool m_closed;
+	std::deque<T> m_items;
+	std::mutex m_mutex;
+	std::condition_variable m_not_full;
+	std::condition_variable m_not_empty;
+};
+
+/* elements [first, first + count) of the operands and the result */
+struct Chunk
+{
+	size_t first;
+	size_t count;
+	const ufixn *a;
+	const ufixn *b;
+	ufixn *out;
+	GF2nBatchBuffer a_buf;
+	GF2nBatchBuffer b_buf;
+	GF2nBatchBuffer out_buf;
+};
+
+void readAll( const int fd, void *data, const size_t num_bytes, const std::string &name )
+{
+	char *bytes = static_cast<char *>(data);
+
+	for( size_t done = 0; done < num_bytes; )
+	{
+		ssize_t res = ::read(fd, bytes + done, num_bytes - done);
+
+		if( res < 0 && errno == EINTR )
+			continue;
+		if( res < 0 )
+			throw PackedArrayIOException(name, strerror(errno));
+		if( res == 0 )
+			throw PackedArrayFormatException(name, "the stream is truncated");
+
+		done += static_cast<size_t>(res);
+	}
+}
+
+void writeAll( const int fd, const void *data, const size_t num_bytes, const std::string &name )
+{
+	const char *bytes = static_cast<const char *>(data);
+
+	for( size_t done = 0; done < num_bytes; )
+	{
+		ssize_t res = ::write(fd, bytes + done, num_bytes - done);
+
+		if( res < 0 && errno == EINTR )
+			continue;
+		if( res < 0 )
+			throw PackedArrayIOException(name, strerror(errno));
+
+		done += static_cast<size_t>(res);
+	}
+}
+
+/*
+	an operand, either a mapped packed array or the packed format on
+	stdin ("-")
+*/
+class Source
+{
+public:
+	Source( const std::string &name, GF2nArithmetic &arithmetic )
+		: m_name(name)
+	{
+		if( name.compare("-") != 0 )
+		{
+			m_array = GF2nPackedArray::open(name, arithmetic);
+			m_header = m_array.getHeader();
+			return;
+		}
+
+		readAll(STDIN_FILENO, &m_header, sizeof(m_header), "stdin");
+		GF2nPackedArray::checkHeader("stdin", m_header, arithmetic);
+
+		// skip the header fields of newer writers
+		std::vector<char> rest(m_header.header_bytes - sizeof(m_header));
+		if( !rest.empty() )
+			readAll(STDIN_FILENO, &rest[0], rest.size(), "stdin");
+	}
+
+	size_t getCount() const { return static_cast<size_t>(m_header.count); }
+	uint32 getStride() const { return m_header.stride; }
+
+	/* the limbs of elements [first, first + count), read into buf if streamed */
+	const ufixn *read( const size_t first, const size_t count, GF2nBatchBuffer &buf )
+	{
+		if( m_array.getLimbs() )
+		{
+			// let the kernel read the next chunk while this one is computed
+			m_array.prefetch(first + count, count);
+			return m_array.getLimbs() + first * getStride();
+		}
+
+		readAll(STDIN_FILENO, buf.get(), count * getStride() * sizeof(ufixn), m_name);
+		return buf.get();
+	}
+
+	/* elements [first, first + count) are not read again */
+	void done( const size_t first, const size_t count )
+	{
+		m_array.evict(first, count);
+	}
+
+private:
+	std::string m_name;
+	GF2nPackedArrayHeader m_header;
+	GF2nPackedArray m_array;
+};
+
+/*
+	the result, either a new packed array or the packed format on
+	stdout ("-")
+*/
+class Sink
+{
+public:
+	Sink( const std::string &name, GF2nArithmetic &arithmetic, const size_t count, const uint32 stride )
+		: m_name(name)
+		, m_stride(stride)
+	{
+		if( name.compare("-") != 0 )
+		{
+			m_array = GF2nPackedArray::create(name, arithmetic, count, stride);
+			return;
+		}
+
+		GF2nPackedArrayHeader header = GF2nPackedArray::makeHeader(arithmetic, count, stride);
+		writeAll(STDOUT_FILENO, &header, sizeof(header), "stdout");
+	}
+
+	/* where the batch stores elements [first, first + count) */
+	ufixn *getOutput( const size_t first, GF2nBatchBuffer &buf )
+	{
+		if( m_array.getLimbs() )
+			return m_array.getLimbs() + first * m_array.getStride();
+
+		return buf.get();
+	}
+
+	void write( const size_t first, const size_t count, const ufixn *out )
+	{
+		// the dirty pages of a mapping are written back by the kernel
+		if( m_array.getLimbs() )
+			m_array.evict(first, count);
+		else
+			writeAll(STDOUT_FILENO, out, count * m_stride * sizeof(ufixn), m_name);
+	}
+
+	void finish()
+	{
+		m_array.sync();
+	}
+
+private:
+	std::string m_name;
+	uint32 m_stride;
+	GF2nPackedArray m_array;
+};
+
+void printUsage()
+{
+	std::cerr << "Run a batch operation on streams of elements by calling" << std::endl;
+	std::cerr << "./streamFunction <mode> <fcn> <bits> <out> <a> [<b> | <value>]" << std::endl;
+	std::cerr << "<out>, <a> and <b> are packed arrays, - reads stdin or writes stdout." << std::endl;
+	std::cerr << "add, sub and mul take <b>, exp takes <value>." << std::endl;
+	std::cerr << "Example: ./streamFunction OpenSSL mul 233 c.pk a.pk b.pk" << std::endl;
+}
+
+int main( int argc, char *argv[] )
+{
+	if( argc < 6 )
+	{
+		printUsage();
+		return 1;
+	}
+
+	try
+	{
+		GF2nArithmetic inst = GF2nArithmeticFactory::createInstance(argv[1]);
+		inst.setFieldSize(atoi(argv[3]));
+
+		GF2nArithmeticOp op = inst.resolveOp(argv[2]);
+		int32 opcode = op.getOpcode();
+		bool binary = (opcode == GF2N_OP_ADD || opcode == GF2N_OP_SUB || opcode == GF2N_OP_MUL || opcode == GF2N_OP_DIV);
+		uint32 value = 0;
+
+		if( (binary || opcode == GF2N_OP_EXP) && argc != 7 )
+		{
+			printUsage();
+			return 1;
+		}
+
+		if( binary && std::string(argv[5]).compare("-") == 0 && std::string(argv[6]).compare("-") == 0 )
+		{
+			std::cerr << "Only one operand can be read from stdin!" << std::endl;
+			return 1;
+		}
+
+		if( opcode == GF2N_OP_EXP )
+			value = static_cast<uint32>(strtoul(argv[6], NULL, 0));
+
+		Source a(argv[5], inst);
+		std::unique_ptr<Source> b(binary ? new Source(argv[6], inst) : NULL);
+
+		size_t count = a.getCount();
+		uint32 stride = a.getStride();
+
+		if( b && (b->getCount() != count || b->getStride() != stride) )
+			throw PackedArrayFormatException(argv[6], "the operands differ in count or stride");
+
+		Sink out(argv[4], inst, count, stride);
+
+		size_t chunk_count = std::max<size_t>(1, CHUNK_BYTES / (stride * sizeof(ufixn)));
+		size_t chunk_limbs = chunk_count * stride;
+
+		// the buffers of all chunks are allocated up front, a stage that
+		// runs ahead waits for a free chunk, which bounds the memory
+		std::vector<std::unique_ptr<Chunk> > chunks;
+		BoundedQueue<Chunk *> free_chunks(PIPELINE_DEPTH);
+		BoundedQueue<Chunk *> read_chunks(PIPELINE_DEPTH);
+		BoundedQueue<Chunk *> computed_chunks(PIPELINE_DEPTH);
+
+		for( size_t i=0; i<PIPELINE_DEPTH; ++i )
+		{
+			chunks.push_back(std::unique_ptr<Chunk>(new Chunk()));
+			chunks.back()->a_buf = GF2nBatchBuffer(chunk_limbs, GF2N_PAGES_TRANSPARENT);
+			if( b )
+				chunks.back()->b_buf = GF2nBatchBuffer(chunk_limbs, GF2N_PAGES_TRANSPARENT);
+			chunks.back()->out_buf = GF2nBatchBuffer(chunk_limbs, GF2N_PAGES_TRANSPARENT);
+			free_chunks.push(chunks.back().get());
+		}
+
+		std::exception_ptr reader_error, writer_error;
+		auto abort = [&]() {
+			free_chunks.close();
+			read_chunks.close();
+			computed_chunks.close();
+		};
+
+		auto start = std::chrono::steady_clock::now();
+
+		std::thread reader([&]() {
+			try
+			{
+				Chunk *chunk = NULL;
+				for( size_t first=0; first<count && free_chunks.pop(chunk); first+=chunk_count )
+				{
+					chunk->first = first;
+					chunk->count = std::min(chunk_count, count - first);
+					chunk->a = a.read(first, chunk->count, chunk->a_buf);
+					chunk->b = b ? b->read(first, chunk->count, chunk->b_buf) : NULL;
+					chunk->out = out.getOutput(first, chunk->out_buf);
+
+					if( !read_chunks.push(chunk) )
+						break;
+				}
+				read_chunks.close();
+			}
+			catch( ... )
+			{
+				reader_error = std::current_exception();
+				abort();
+			}
+		});
+
+		std::thread writer([&]() {
+			try
+			{
+				Chunk *chunk = NULL;
+				while( computed_chunks.pop(chunk) )
+				{
+					out.write(chunk->first, chunk->count, chunk->out);
+					a.done(chunk->first, chunk->count);
+					if( b )
+						b->done(chunk->first, chunk->count);
+
+					free_chunks.push(chunk);
+				}
+			}
+			catch( ... )
+			{
+				writer_error = std::current_exception();
+				abort();
+			}
+		});
+
+		// the calling thread computes, the batch spreads every chunk over
+		// the executor
+		try
+		{
+			Chunk *chunk = NULL;
+			while( read_chunks.pop(chunk) )
+			{
+				inst.runBatch(op, chunk->a, chunk->b, value, chunk->out, chunk->count, stride);
+
+				if( !computed_chunks.push(chunk) )
+					break;
+			}
+			computed_chunks.close();
+		}
+		catch( ... )
+		{
+			abort();
+			reader.join();
+			writer.join();
+			throw;
+		}
+
+		reader.join();
+		writer.join();
+
+		if( reader_error )
+			std::rethrow_exception(reader_error);
+		if( writer_error )
+			std::rethrow_exception(writer_error);
+
+		out.finish();
+
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		std::cerr << count << " elements in " << seconds << " s, " << (seconds > 0 ? count / seconds : 0) << " elements/s" << std::endl;
+	}
+	catch( std::exception &e )
+	{
+		std::cerr << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -182,6 +182,38 @@ def run(what, a, b, flags=0, runs=1):
     return _GF2nStubElement(-1, a._field)
 
 
+def runBatch(what, field, a, b):
+    num_limbs = libcumffa.getNumLimbs(c_void_p(field._inst))
+    num_bytes = num_limbs * getRegisterSize() / 8
+
+    # every element is stored as little endian limbs of num_bytes bytes
+    def pack(values):
+        return ''.join([binascii.unhexlify('%0*x' % (num_bytes * 2, v))[::-1]
+                        for v in values])
+
+    buf_a = create_string_buffer(pack(a), len(a) * num_bytes)
+    buf_res = create_string_buffer(len(a) * num_bytes)
+
+    if isinstance(b, list):
+        buf_b = create_string_buffer(pack(b), len(b) * num_bytes)
+        value = 0
+    else:
+        buf_b = None
+        value = b
+
+    libcumffa.runBatch(
+        c_void_p(field._inst),
+        c_char_p(what),
+        c_ulong(value),
+        c_ulong(len(a)),
+        buf_a,
+        buf_b,
+        buf_res)
+
+    return [int(binascii.hexlify(buf_res.raw[i:i+num_bytes][::-1]), 16)
+            for i in range(0, len(a) * num_bytes, num_bytes)]
+
+
 def getRandomNumber(num_bits, seed):
     num_chunks = ((num_bits - 1) / 8) + 1
     c_ubyte_arr_value = (c_ubyte * num_chunks).from_buffer(
@@ -88,6 +88,29 @@ class TestOpenSSLMultiplication( GF2nTest ):
 		self.assertEqual(res_cpu, res_ref)
 
 
+class TestOpenSSLBatchMultiplication( GF2nTest ):
+
+	@SetIterateValue(bits=[100, 1000, 2000])
+	@UnitTest()
+	def testOpenSSLBatchMultiplication( self, bits ):
+
+		# do OpenSSL arithmetic
+		f_cpu = GF2nStub.GF2nStub("OpenSSL", bits)
+
+		a = [random.getrandbits(bits) for i in range(0, 16)]
+		b = [random.getrandbits(bits) for i in range(0, 16)]
+
+		res_cpu = GF2nStub.runBatch("mul", f_cpu, a, b)
+
+		# calcualte reference
+		f_ref = GF2n.GF2n(bits)
+
+		res_ref = [(f_ref(a[i]) * f_ref(b[i]))._value for i in range(0, 16)]
+
+		# compare results
+		self.assertEqual(res_cpu, res_ref)
+
+
 class TestOpenSSLExponentiation(GF2nTest):
 
     @SetIterateValue(bits=[10, 100, 1000, 2000])